@@ -59,12 +59,61 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
     const int nRasterYSize = pBand->GetYSize();
     const bool bIsComplex =
         CPL_TO_BOOL(GDALDataTypeIsComplex(pBand->GetRasterDataType()));
+    constexpr int nTypeFactor = sizeof(T) / sizeof(double);
 
+    // Fetch the cached blocks, and read the missing ones in a single request
+    std::vector<std::shared_ptr<std::vector<double>>> apoValues(
+        static_cast<size_t>(nXIters) * nYIters);
+    std::vector<GDALRasterIOWindow> asWindows;
+    std::vector<std::pair<uint64_t, size_t>> anMissingKeyAndIdx;
     for (int iY = 0; iY < nYIters; iY++)
     {
         const int nBlockY = nY / BLOCK_SIZE + iY;
         const int nReqYSize =
             std::min(nRasterYSize - nBlockY * BLOCK_SIZE, BLOCK_SIZE);
+        for (int iX = 0; iX < nXIters; iX++)
+        {
+            const int nBlockX = nX / BLOCK_SIZE + iX;
+            const int nReqXSize =
+                std::min(nRasterXSize - nBlockX * BLOCK_SIZE, BLOCK_SIZE);
+            const uint64_t nKey =
+                (static_cast<uint64_t>(nBlockY) << 32) | nBlockX;
+            const size_t nIdx = static_cast<size_t>(iY) * nXIters + iX;
+            auto &poValue = apoValues[nIdx];
+            if (!cache->tryGet(nKey, poValue))
+            {
+                const size_t nVectorSize =
+                    size_t(nReqXSize) * nReqYSize * nTypeFactor;
+                poValue = std::make_shared<std::vector<double>>(nVectorSize);
+                GDALRasterIOWindow sWindow;
+                sWindow.nXOff = nBlockX * BLOCK_SIZE;
+                sWindow.nYOff = nBlockY * BLOCK_SIZE;
+                sWindow.nXSize = nReqXSize;
+                sWindow.nYSize = nReqYSize;
+                sWindow.pData = poValue->data();
+                sWindow.nPixelSpace = 0;
+                sWindow.nLineSpace = 0;
+                sWindow.nBandSpace = 0;
+                asWindows.push_back(sWindow);
+                anMissingKeyAndIdx.emplace_back(nKey, nIdx);
+            }
+        }
+    }
+    if (!asWindows.empty())
+    {
+        const GDALDataType eDataType = bIsComplex ? GDT_CFloat64 : GDT_Float64;
+        if (pBand->MultiRangeRasterIO(static_cast<int>(asWindows.size()),
+                                      asWindows.data(),
+                                      eDataType) != CE_None)
+        {
+            return false;
+        }
+        for (const auto &[nKey, nIdx] : anMissingKeyAndIdx)
+            cache->insert(nKey, apoValues[nIdx]);
+    }
+
+    for (int iY = 0; iY < nYIters; iY++)
+    {
         const int nFirstLineInCachedBlock = (iY == 0) ? nY % BLOCK_SIZE : 0;
         const int nFirstLineInOutput =
             (iY == 0) ? 0
@@ -79,8 +128,6 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
             const int nBlockX = nX / BLOCK_SIZE + iX;
             const int nReqXSize =
                 std::min(nRasterXSize - nBlockX * BLOCK_SIZE, BLOCK_SIZE);
-            const uint64_t nKey =
-                (static_cast<uint64_t>(nBlockY) << 32) | nBlockX;
             const int nFirstColInCachedBlock = (iX == 0) ? nX % BLOCK_SIZE : 0;
             const int nFirstColInOutput =
                 (iX == 0)
@@ -96,29 +143,12 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
             CPLDebug("RPC", "nY=%d nX=%d nBlockY=%d nBlockX=%d "
                      "nFirstLineInCachedBlock=%d nFirstLineInOutput=%d nLinesToCopy=%d "
                      "nFirstColInCachedBlock=%d nFirstColInOutput=%d nColsToCopy=%d",
-                     nY, nX, nBlockY, nBlockX, nFirstLineInCachedBlock, nFirstLineInOutput, nLinesToCopy,
+                     nY, nX, nY / BLOCK_SIZE + iY, nBlockX, nFirstLineInCachedBlock, nFirstLineInOutput, nLinesToCopy,
                      nFirstColInCachedBlock, nFirstColInOutput, nColsToCopy);
 #endif
 
-            constexpr int nTypeFactor = sizeof(T) / sizeof(double);
-            std::shared_ptr<std::vector<double>> poValue;
-            if (!cache->tryGet(nKey, poValue))
-            {
-                const GDALDataType eDataType =
-                    bIsComplex ? GDT_CFloat64 : GDT_Float64;
-                const size_t nVectorSize =
-                    size_t(nReqXSize) * nReqYSize * nTypeFactor;
-                poValue = std::make_shared<std::vector<double>>(nVectorSize);
-                CPLErr eErr = pBand->RasterIO(
-                    GF_Read, nBlockX * BLOCK_SIZE, nBlockY * BLOCK_SIZE,
-                    nReqXSize, nReqYSize, poValue->data(), nReqXSize, nReqYSize,
-                    eDataType, 0, 0, nullptr);
-                if (eErr != CE_None)
-                {
-                    return false;
-                }
-                cache->insert(nKey, poValue);
-            }
+            const auto &poValue =
+                apoValues[static_cast<size_t>(iY) * nXIters + iX];
 
             double *padfAsDouble = reinterpret_cast<double *>(padfOut);
             // Compose the cached block to the final buffer
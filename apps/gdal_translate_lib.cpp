@@ -2595,6 +2595,14 @@ GDALDatasetH GDALTranslate(const char *pszDest, GDALDatasetH hSrcDataset,
     }
     else
     {
+        // The VRT hides the characteristics of the source dataset, so let
+        // GDALDatasetCopyWholeRaster() know whether it is worth reading it
+        // in a worker thread.
+        CPLConfigOptionSetter oAsyncReadSetter(
+            "GDAL_COPY_WHOLE_RASTER_ASYNC_READ",
+            GDALCopyWholeRasterIsSlowSource(poSrcDS) ? "YES" : "NO",
+            /* bSetOnlyIfUndefined = */ true);
+
         hOutDS = GDALCreateCopy(
             hDriver, pszDest, GDALDataset::ToHandle(poVDS), psOptions->bStrict,
             psOptions->aosCreateOptions.List(), psOptions->pfnProgress,
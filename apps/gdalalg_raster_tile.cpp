@@ -154,6 +154,13 @@ GDALRasterTileAlgorithm::GDALRasterTileAlgorithm()
     AddArg("resume", 0, _("Generate only missing files"), &m_resume);
 
     AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
+    AddArg("metatile-size", 0,
+           _("Size, in tiles, of the blocks of max zoom level tiles "
+             "processed by each thread"),
+           &m_metatileSize)
+        .SetDefault(m_metatileSize)
+        .SetMinValueIncluded(1)
+        .SetMaxValueIncluded(1024);
 
     constexpr const char *ADVANCED_RESAMPLING_CATEGORY = "Advanced Resampling";
     auto &excludedValuesArg =
@@ -232,6 +239,13 @@ GDALRasterTileAlgorithm::GDALRasterTileAlgorithm()
                 return false;
             }
 
+            if ((m_metatileSize & (m_metatileSize - 1)) != 0)
+            {
+                ReportError(CE_Failure, CPLE_IllegalArg,
+                            "'metatile-size' must be a power of two");
+                return false;
+            }
+
             if (m_addalpha && dstNoDataArg.IsExplicitlySet())
             {
                 ReportError(
@@ -2064,6 +2078,59 @@ class PerThreadLowerZoomResourceManager final
     const MosaicDataset &m_oSrcDS;
 };
 
+/************************************************************************/
+/*                         MetatileOverviewLevel                        */
+/************************************************************************/
+
+// Zoom level < max whose tiles are generated by the jobs processing blocks
+// of max zoom level tiles ("metatiles"), as soon as their children tiles
+// have been generated by the same job.
+struct MetatileOverviewLevel
+{
+    gdal::TileMatrixSet::TileMatrix srcTileMatrix{};
+    gdal::TileMatrixSet::TileMatrix ovrTileMatrix{};
+    int nSrcMinTileX = 0;
+    int nSrcMinTileY = 0;
+    int nSrcMaxTileX = 0;
+    int nSrcMaxTileY = 0;
+    int nOvrMinTileX = 0;
+    int nOvrMinTileY = 0;
+    int nOvrMaxTileX = 0;
+    int nOvrMaxTileY = 0;
+    CPLStringList aosCreationOptions{};
+    std::unique_ptr<MosaicDataset> poSrcDS{};
+    std::unique_ptr<PerThreadLowerZoomResourceManager> poResourceManager{};
+
+    // Whether each tile of the level has been generated. Each entry is
+    // only written by the job processing the metatile containing the tile,
+    // and only read by it until all jobs have completed.
+    std::vector<uint8_t> abGenerated{};
+
+    bool IsInSrcRange(int iX, int iY) const
+    {
+        return iX >= nSrcMinTileX && iX <= nSrcMaxTileX &&
+               iY >= nSrcMinTileY && iY <= nSrcMaxTileY;
+    }
+
+    bool IsInRange(int iX, int iY) const
+    {
+        return iX >= nOvrMinTileX && iX <= nOvrMaxTileX &&
+               iY >= nOvrMinTileY && iY <= nOvrMaxTileY;
+    }
+
+    size_t GetIndex(int iX, int iY) const
+    {
+        return static_cast<size_t>(iY - nOvrMinTileY) *
+                   (nOvrMaxTileX - nOvrMinTileX + 1) +
+               (iX - nOvrMinTileX);
+    }
+
+    bool IsGenerated(int iX, int iY) const
+    {
+        return IsInRange(iX, iY) && abGenerated[GetIndex(iX, iY)] != 0;
+    }
+};
+
 }  // namespace
 
 /************************************************************************/
@@ -2912,6 +2979,7 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
     }
 
     CPLWorkerThreadPool oThreadPool;
+    std::vector<MetatileOverviewLevel> aoLevels;
 
     {
         PerThreadMaxZoomResourceManager oResourceManager(
@@ -2934,10 +3002,265 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
             bRet = oThreadPool.Setup(m_numThreads, nullptr, nullptr);
         }
 
+        // When all zoom levels are aligned on each other, each job processes
+        // a square of 2^nMetatileDepth max zoom level tiles, and generates
+        // the tiles of the nMetatileDepth immediately lower zoom levels whose
+        // children tiles it has generated itself, while they are still hot
+        // in the file system cache.
+        int nMetatileDepth = 0;
+        if (bRet && m_numThreads > 1 && poTMS->haveAllLevelsSameTopLeft() &&
+            poTMS->haveAllLevelsSameTileSize() &&
+            poTMS->hasOnlyPowerOfTwoVaryingScales())
+        {
+            while ((2 << nMetatileDepth) <= m_metatileSize &&
+                   nMetatileDepth < m_maxZoomLevel - m_minZoomLevel)
+            {
+                ++nMetatileDepth;
+            }
+
+            // Make sure there are enough metatiles to keep threads busy
+            const auto GetMetatileCount =
+                [nMinTileX, nMinTileY, nMaxTileX, nMaxTileY](int nDepth)
+            {
+                return static_cast<uint64_t>((nMaxTileX >> nDepth) -
+                                             (nMinTileX >> nDepth) + 1) *
+                       ((nMaxTileY >> nDepth) - (nMinTileY >> nDepth) + 1);
+            };
+            while (nMetatileDepth > 0 &&
+                   GetMetatileCount(nMetatileDepth) <
+                       static_cast<uint64_t>(m_numThreads))
+            {
+                --nMetatileDepth;
+            }
+        }
+
+        // Sized once, as MosaicDataset keeps a reference to srcTileMatrix
+        aoLevels.resize(nMetatileDepth);
+        for (int j = 1; j <= nMetatileDepth; ++j)
+        {
+            const int iZ = m_maxZoomLevel - j;
+            auto &oLevel = aoLevels[j - 1];
+            oLevel.srcTileMatrix = tileMatrixList[iZ + 1];
+            oLevel.ovrTileMatrix = tileMatrixList[iZ];
+            bool bLevelIntersects = false;
+            {
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                CPL_IGNORE_RET_VAL(GetTileIndices(
+                    oLevel.srcTileMatrix, bInvertAxisTMS, m_tileSize,
+                    adfExtent, oLevel.nSrcMinTileX, oLevel.nSrcMinTileY,
+                    oLevel.nSrcMaxTileX, oLevel.nSrcMaxTileY,
+                    m_noIntersectionIsOK, bLevelIntersects));
+                if (bLevelIntersects)
+                {
+                    CPL_IGNORE_RET_VAL(GetTileIndices(
+                        oLevel.ovrTileMatrix, bInvertAxisTMS, m_tileSize,
+                        adfExtent, oLevel.nOvrMinTileX, oLevel.nOvrMinTileY,
+                        oLevel.nOvrMaxTileX, oLevel.nOvrMaxTileY,
+                        m_noIntersectionIsOK, bLevelIntersects));
+                }
+            }
+            if (!bLevelIntersects)
+            {
+                // Let the per-level pass deal with that situation
+                nMetatileDepth = j - 1;
+                aoLevels.resize(nMetatileDepth);
+                break;
+            }
+
+            oLevel.poSrcDS = std::make_unique<MosaicDataset>(
+                CPLFormFilenameSafe(m_outputDirectory.c_str(),
+                                    CPLSPrintf("%d", iZ + 1), nullptr),
+                pszExtension, m_outputFormat, poSrcDS, oLevel.srcTileMatrix,
+                oSRS_TMS, oLevel.nSrcMinTileX, oLevel.nSrcMinTileY,
+                oLevel.nSrcMaxTileX, oLevel.nSrcMaxTileY, m_convention,
+                nDstBands, psWO->eWorkingDataType,
+                psWO->padfDstNoDataReal ? &(psWO->padfDstNoDataReal[0])
+                                        : nullptr,
+                m_metadata, poColorTable);
+            oLevel.poResourceManager =
+                std::make_unique<PerThreadLowerZoomResourceManager>(
+                    *(oLevel.poSrcDS.get()));
+            oLevel.aosCreationOptions =
+                GetUpdatedCreationOptions(oLevel.ovrTileMatrix);
+            oLevel.abGenerated.resize(
+                static_cast<size_t>(oLevel.nOvrMaxTileY - oLevel.nOvrMinTileY +
+                                    1) *
+                (oLevel.nOvrMaxTileX - oLevel.nOvrMinTileX + 1));
+        }
+
+        // Resampling kernels read pixels of the neighbouring children tiles
+        const int nMargin = m_overviewResampling == "nearest" ? 0 : 1;
+
         std::atomic<bool> bFailure = false;
         std::atomic<int> nQueuedJobs = 0;
 
-        for (int iY = nMinTileY; bRet && iY <= nMaxTileY; ++iY)
+        if (nMetatileDepth > 0)
+        {
+            CPLDebug("gdal_raster_tile",
+                     "Using metatiles of %dx%d tiles, generating zoom levels "
+                     "%d to %d",
+                     1 << nMetatileDepth, 1 << nMetatileDepth,
+                     m_maxZoomLevel - nMetatileDepth, m_maxZoomLevel);
+        }
+
+        for (int iMetaY = nMinTileY >> nMetatileDepth;
+             bRet && nMetatileDepth > 0 &&
+             iMetaY <= nMaxTileY >> nMetatileDepth;
+             ++iMetaY)
+        {
+            for (int iMetaX = nMinTileX >> nMetatileDepth;
+                 bRet && iMetaX <= nMaxTileX >> nMetatileDepth; ++iMetaX)
+            {
+                auto job = [this, &oResourceManager, &aoLevels, &bFailure,
+                            &nCurTile, &nQueuedJobs, poDstDriver, pszExtension,
+                            &aosCreationOptions, &aosWarpOptions, &psWO,
+                            &tileMatrix, nDstBands, nMinTileX, nMinTileY,
+                            nMaxTileX, nMaxTileY, nMetatileDepth, nMargin,
+                            iMetaX, iMetaY, poColorTable, bUserAskedForAlpha]()
+                {
+                    CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+
+                    --nQueuedJobs;
+
+                    // Extent of the metatile, in max zoom level tile indices
+                    const int nX0 = iMetaX << nMetatileDepth;
+                    const int nY0 = iMetaY << nMetatileDepth;
+                    const int nX1 = nX0 + (1 << nMetatileDepth) - 1;
+                    const int nY1 = nY0 + (1 << nMetatileDepth) - 1;
+
+                    bool bOK;
+                    {
+                        auto resources = oResourceManager.AcquireResources();
+                        bOK = resources != nullptr;
+                        for (int iY = std::max(nY0, nMinTileY);
+                             bOK && !bFailure && iY <= std::min(nY1, nMaxTileY);
+                             ++iY)
+                        {
+                            for (int iX = std::max(nX0, nMinTileX);
+                                 bOK && iX <= std::min(nX1, nMaxTileX); ++iX)
+                            {
+                                bOK = GenerateTile(
+                                    resources->poSrcDS.get(), poDstDriver,
+                                    pszExtension, aosCreationOptions.List(),
+                                    *(resources->poWO.get()),
+                                    *(resources->poFakeMaxZoomDS
+                                          ->GetSpatialRef()),
+                                    psWO->eWorkingDataType, tileMatrix,
+                                    m_outputDirectory, nDstBands,
+                                    psWO->padfDstNoDataReal
+                                        ? &(psWO->padfDstNoDataReal[0])
+                                        : nullptr,
+                                    m_maxZoomLevel, iX, iY, m_convention,
+                                    nMinTileX, nMinTileY, m_skipBlank,
+                                    bUserAskedForAlpha, m_auxXML, m_resume,
+                                    m_metadata, poColorTable,
+                                    resources->dstBuffer);
+                                ++nCurTile;
+                            }
+                        }
+                        if (bOK)
+                            oResourceManager.ReleaseResources(
+                                std::move(resources));
+                        else
+                            oResourceManager.SetError();
+                    }
+
+                    // Whether a tile of the source level of the j-th
+                    // overview level is either out of the extent of that
+                    // source level, or has been generated by this job.
+                    const auto IsSrcTileReady =
+                        [&aoLevels, nX0, nY0, nX1, nY1](int j, int iX, int iY)
+                    {
+                        if (!aoLevels[j - 1].IsInSrcRange(iX, iY))
+                            return true;
+                        if (iX < (nX0 >> (j - 1)) || iX > (nX1 >> (j - 1)) ||
+                            iY < (nY0 >> (j - 1)) || iY > (nY1 >> (j - 1)))
+                            return false;
+                        return j == 1 || aoLevels[j - 2].IsGenerated(iX, iY);
+                    };
+
+                    for (int j = 1; bOK && !bFailure && j <= nMetatileDepth;
+                         ++j)
+                    {
+                        auto &oLevel = aoLevels[j - 1];
+                        auto resources =
+                            oLevel.poResourceManager->AcquireResources();
+                        bOK = resources != nullptr;
+                        for (int iY = std::max(nY0 >> j, oLevel.nOvrMinTileY);
+                             bOK && !bFailure &&
+                             iY <= std::min(nY1 >> j, oLevel.nOvrMaxTileY);
+                             ++iY)
+                        {
+                            for (int iX =
+                                     std::max(nX0 >> j, oLevel.nOvrMinTileX);
+                                 bOK &&
+                                 iX <= std::min(nX1 >> j, oLevel.nOvrMaxTileX);
+                                 ++iX)
+                            {
+                                bool bReady = true;
+                                for (int iSrcY = 2 * iY - nMargin;
+                                     bReady && iSrcY <= 2 * iY + 1 + nMargin;
+                                     ++iSrcY)
+                                {
+                                    for (int iSrcX = 2 * iX - nMargin;
+                                         bReady &&
+                                         iSrcX <= 2 * iX + 1 + nMargin;
+                                         ++iSrcX)
+                                    {
+                                        bReady =
+                                            IsSrcTileReady(j, iSrcX, iSrcY);
+                                    }
+                                }
+                                // Otherwise left to the per-level pass
+                                if (!bReady)
+                                    continue;
+
+                                bOK = GenerateOverviewTile(
+                                    *(resources->poSrcDS.get()), poDstDriver,
+                                    m_outputFormat, pszExtension,
+                                    oLevel.aosCreationOptions.List(),
+                                    aosWarpOptions.List(), m_overviewResampling,
+                                    oLevel.ovrTileMatrix, m_outputDirectory,
+                                    m_maxZoomLevel - j, iX, iY, m_convention,
+                                    m_skipBlank, bUserAskedForAlpha, m_auxXML,
+                                    m_resume);
+                                if (bOK)
+                                    oLevel.abGenerated[oLevel.GetIndex(
+                                        iX, iY)] = 1;
+                                ++nCurTile;
+                            }
+                        }
+                        if (bOK)
+                            oLevel.poResourceManager->ReleaseResources(
+                                std::move(resources));
+                        else
+                            oLevel.poResourceManager->SetError();
+                    }
+
+                    if (!bOK)
+                        bFailure = true;
+                };
+
+                // Avoid queueing too many jobs at once
+                while (bRet && nQueuedJobs > 2 * m_numThreads)
+                {
+                    oThreadPool.WaitEvent();
+
+                    bRet &=
+                        !bFailure &&
+                        (!pfnProgress ||
+                         pfnProgress(static_cast<double>(nCurTile) /
+                                         static_cast<double>(nTotalTiles),
+                                     "", pProgressData));
+                }
+
+                ++nQueuedJobs;
+                oThreadPool.SubmitJob(std::move(job));
+            }
+        }
+
+        for (int iY = nMinTileY; bRet && nMetatileDepth == 0 && iY <= nMaxTileY;
+             ++iY)
         {
             for (int iX = nMinTileX; bRet && iX <= nMaxTileX; ++iX)
             {
@@ -3043,6 +3366,17 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
                 ReportError(CE_Failure, CPLE_AppDefined, "%s",
                             oResourceManager.GetErrorMsg().c_str());
             }
+            for (auto &oLevel : aoLevels)
+            {
+                if (!oLevel.poResourceManager->GetErrorMsg().empty())
+                {
+                    ReportError(
+                        CE_Failure, CPLE_AppDefined, "%s",
+                        oLevel.poResourceManager->GetErrorMsg().c_str());
+                }
+                oLevel.poResourceManager.reset();
+                oLevel.poSrcDS.reset();
+            }
         }
 
         if (m_kml && bRet)
@@ -3124,6 +3458,12 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
         std::atomic<bool> bFailure = false;
         std::atomic<int> nQueuedJobs = 0;
 
+        // Tiles already generated with the max zoom level metatiles
+        const MetatileOverviewLevel *poMetatileLevel =
+            m_maxZoomLevel - iZ <= static_cast<int>(aoLevels.size())
+                ? &aoLevels[m_maxZoomLevel - iZ - 1]
+                : nullptr;
+
         const bool bUseThreads =
             m_numThreads > 1 &&
             (nOvrMaxTileY > nOvrMinTileY || nOvrMaxTileX > nOvrMinTileX);
@@ -3132,6 +3472,9 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
         {
             for (int iX = nOvrMinTileX; bRet && iX <= nOvrMaxTileX; ++iX)
             {
+                if (poMetatileLevel && poMetatileLevel->IsGenerated(iX, iY))
+                    continue;
+
                 if (bUseThreads)
                 {
                     auto job = [this, &oResourceManager, poDstDriver, &bFailure,
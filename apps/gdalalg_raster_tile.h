@@ -63,6 +63,7 @@ class GDALRasterTileAlgorithm final : public GDALAlgorithm
     bool m_auxXML = false;
     bool m_resume = false;
     int m_numThreads = 0;
+    int m_metatileSize = 8;
     bool m_kml = false;
 
     std::string m_excludedValues{};
@@ -20,6 +20,7 @@
 #include "ogr_spatialref.h"
 #include "gdalargumentparser.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <vector>
@@ -460,6 +461,40 @@ MAIN_START(argc, argv)
             nRetCode = 1;
         }
 
+        /* --------------------------------------------------------------------
+         */
+        /*      With nearest neighbour on full resolution bands, read the */
+        /*      values of all bands in a single request. */
+        /* --------------------------------------------------------------------
+         */
+        std::vector<double> adfBandValues;
+        if (bPixelReport && nOverview < 0 &&
+            eInterpolation == GRIORA_NearestNeighbour)
+        {
+            // Locations right at the right or bottom edge are accepted.
+            GDALRasterIOWindow sWindow;
+            sWindow.nXOff = std::min(iPixel, GDALGetRasterXSize(hSrcDS) - 1);
+            sWindow.nYOff = std::min(iLine, GDALGetRasterYSize(hSrcDS) - 1);
+            sWindow.nXSize = 1;
+            sWindow.nYSize = 1;
+            adfBandValues.resize(2 * anBandList.size());
+            sWindow.pData = adfBandValues.data();
+            sWindow.nPixelSpace = 0;
+            sWindow.nLineSpace = 0;
+            sWindow.nBandSpace = 2 * sizeof(double);
+
+            // On failure, fallback to the band per band code path, which
+            // reports errors.
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            if (GDALDatasetMultiRangeRasterIO(
+                    hSrcDS, 1, &sWindow, GDT_CFloat64,
+                    static_cast<int>(anBandList.size()),
+                    anBandList.data()) != CE_None)
+            {
+                adfBandValues.clear();
+            }
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      Process each band. */
@@ -578,9 +613,28 @@ MAIN_START(argc, argv)
                 GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
 
             CPLErr err;
-            err = GDALRasterInterpolateAtPoint(hBand, dfPixelToQuery,
-                                               dfLineToQuery, eInterpolation,
-                                               &adfPixel[0], &adfPixel[1]);
+            if (!adfBandValues.empty())
+            {
+                adfPixel[0] = adfBandValues[2 * i];
+                adfPixel[1] = adfBandValues[2 * i + 1];
+
+                // Consistent with GDALRasterInterpolateAtPoint()
+                int bHasNoData = FALSE;
+                const double dfNoData =
+                    GDALGetRasterNoDataValue(hBand, &bHasNoData);
+                err = (bHasNoData &&
+                       (std::isnan(dfNoData) ? std::isnan(adfPixel[0])
+                                             : ARE_REAL_EQUAL(dfNoData,
+                                                              adfPixel[0])))
+                          ? CE_Failure
+                          : CE_None;
+            }
+            else
+            {
+                err = GDALRasterInterpolateAtPoint(
+                    hBand, dfPixelToQuery, dfLineToQuery, eInterpolation,
+                    &adfPixel[0], &adfPixel[1]);
+            }
 
             if (err == CE_None)
             {
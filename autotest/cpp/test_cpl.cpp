@@ -4310,6 +4310,63 @@ TEST_F(test_cpl, VSIGetMemFileBuffer_unlink_and_size)
     VSIFCloseL(fp);
 }
 
+// Test VSIVisitMemFileBuffer() and VSIGetMemFileBuffer() on a file made of
+// several chunks
+TEST_F(test_cpl, VSIVisitMemFileBuffer)
+{
+    const char *pszFilename = "/vsimem/test_visit_mem_file_buffer.bin";
+    std::string osExpected;
+    VSILFILE *fp = VSIFOpenL(pszFilename, "wb+");
+    ASSERT_NE(fp, nullptr);
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::string osVal(CPLSPrintf("%d,", i));
+        ASSERT_EQ(VSIFWriteL(osVal.data(), 1, osVal.size(), fp),
+                  osVal.size());
+        osExpected += osVal;
+    }
+    // Overwrite a range spanning several chunks
+    const std::string osPattern(300000, 'x');
+    ASSERT_EQ(VSIFSeekL(fp, 1000, SEEK_SET), 0);
+    ASSERT_EQ(VSIFWriteL(osPattern.data(), 1, osPattern.size(), fp),
+              osPattern.size());
+    osExpected.replace(1000, osPattern.size(), osPattern);
+
+    std::string osRead(osExpected.size(), '\0');
+    ASSERT_EQ(VSIFSeekL(fp, 0, SEEK_SET), 0);
+    ASSERT_EQ(VSIFReadL(osRead.data(), 1, osRead.size(), fp), osRead.size());
+    EXPECT_EQ(osRead, osExpected);
+
+    std::string osVisited;
+    EXPECT_TRUE(VSIVisitMemFileBuffer(
+        pszFilename,
+        [](const GByte *pabyData, size_t nSize, void *pUserData)
+        {
+            static_cast<std::string *>(pUserData)->append(
+                reinterpret_cast<const char *>(pabyData), nSize);
+            return TRUE;
+        },
+        &osVisited));
+    EXPECT_EQ(osVisited, osExpected);
+
+    EXPECT_FALSE(VSIVisitMemFileBuffer(
+        pszFilename, [](const GByte *, size_t, void *) { return FALSE; },
+        nullptr));
+    EXPECT_FALSE(VSIVisitMemFileBuffer(
+        "/vsimem/i_do_not_exist", [](const GByte *, size_t, void *)
+        { return TRUE; }, nullptr));
+
+    vsi_l_offset nLength = 0;
+    const GByte *pabyData =
+        VSIGetMemFileBuffer(pszFilename, &nLength, false);
+    ASSERT_NE(pabyData, nullptr);
+    ASSERT_EQ(nLength, osExpected.size());
+    EXPECT_EQ(memcmp(pabyData, osExpected.data(), osExpected.size()), 0);
+
+    VSIFCloseL(fp);
+    VSIUnlink(pszFilename);
+}
+
 // Test CPLLoadConfigOptionsFromFile() for VSI credentials
 TEST_F(test_cpl, CPLLoadConfigOptionsFromFile_VSI_credentials)
 {
@@ -4881,6 +4938,90 @@ TEST_F(test_cpl, file_system_pread)
     VSIUnlink("temp_test_64.bin");
 }
 
+// Test /vsicrypt/ ReadMultiRange() and reads of truncated files
+TEST_F(test_cpl, vsicrypt_read_multi_range)
+{
+    const char *pszBaseFilename = "/vsimem/vsicrypt_read_multi_range.bin";
+    const std::string osFilename =
+        std::string("/vsicrypt/key=DONT_USE_IN_PROD,mode=CTR,"
+                    "sector_size=512,file=") +
+        pszBaseFilename;
+    constexpr size_t SIZE = 100000;
+    std::vector<GByte> abyData(SIZE);
+    for (size_t i = 0; i < SIZE; ++i)
+        abyData[i] = static_cast<GByte>((i * 7 + i / 256) % 256);
+
+    VSILFILE *fp;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        fp = VSIFOpenL(osFilename.c_str(), "wb");
+    }
+    if (fp == nullptr)
+    {
+        GTEST_SKIP() << "/vsicrypt/ not available";
+    }
+    ASSERT_EQ(VSIFWriteL(abyData.data(), 1, SIZE, fp), SIZE);
+    VSIFCloseL(fp);
+
+    CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "4", false);
+    fp = VSIFOpenL(osFilename.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    {
+        const vsi_l_offset anOffsets[] = {10, 5000, 5000, 60000, 99990};
+        const size_t anSizes[] = {100, 0, 2000, 30000, 10};
+        constexpr int nRanges = static_cast<int>(CPL_ARRAYSIZE(anOffsets));
+        std::vector<std::vector<GByte>> aabyBuffers(nRanges);
+        std::vector<void *> apData(nRanges);
+        for (int i = 0; i < nRanges; ++i)
+        {
+            aabyBuffers[i].resize(anSizes[i] + 1);
+            apData[i] = aabyBuffers[i].data();
+        }
+        VSIFSeekL(fp, 1234, SEEK_SET);
+        ASSERT_EQ(VSIFReadMultiRangeL(nRanges, apData.data(), anOffsets,
+                                      anSizes, fp),
+                  0);
+        EXPECT_EQ(VSIFTellL(fp), 1234U);
+        for (int i = 0; i < nRanges; ++i)
+        {
+            EXPECT_TRUE(memcmp(aabyBuffers[i].data(),
+                               abyData.data() + anOffsets[i],
+                               anSizes[i]) == 0)
+                << i;
+        }
+
+        // Range beyond end of file
+        const vsi_l_offset nOffset = SIZE - 10;
+        const size_t nSize = 20;
+        void *pData = aabyBuffers[0].data();
+        EXPECT_NE(VSIFReadMultiRangeL(1, &pData, &nOffset, &nSize, fp), 0);
+    }
+    VSIFCloseL(fp);
+
+    // Truncate the underlying file in the middle of its last sectors: the
+    // sectors before must still be returned.
+    VSIStatBufL sStat;
+    ASSERT_EQ(VSIStatL(pszBaseFilename, &sStat), 0);
+    fp = VSIFOpenL(pszBaseFilename, "rb+");
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(VSIFTruncateL(fp, sStat.st_size - 2000), 0);
+    VSIFCloseL(fp);
+
+    fp = VSIFOpenL(osFilename.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    {
+        std::vector<GByte> abyBuffer(SIZE);
+        const size_t nRead = VSIFReadL(abyBuffer.data(), 1, SIZE, fp);
+        EXPECT_EQ(nRead % 512, 0U);
+        EXPECT_GE(nRead, SIZE - 4 * 512);
+        EXPECT_LT(nRead, SIZE);
+        EXPECT_TRUE(memcmp(abyBuffer.data(), abyData.data(), nRead) == 0);
+    }
+    VSIFCloseL(fp);
+
+    VSIUnlink(pszBaseFilename);
+}
+
 // Test CPLMask implementation
 TEST_F(test_cpl, CPLMask)
 {
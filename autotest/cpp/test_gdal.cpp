@@ -3813,6 +3813,80 @@ TEST_F(test_gdal, GDALDeinterleave4ComponentsUInt16)
     VSIFree(panDest3);
 }
 
+// Test GDALDeinterleave() and GDALInterleave() with an arbitrary number of
+// components
+TEST_F(test_gdal, GDALDeinterleaveInterleaveNComponents)
+{
+    for (const char *pszUseAVX2 : {"YES", "NO"})
+    {
+        CPLConfigOptionSetter oSetter("GDAL_USE_AVX2", pszUseAVX2, false);
+        for (GDALDataType eDT :
+             {GDT_Byte, GDT_UInt16, GDT_Float32, GDT_Float64})
+        {
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+            for (int nComponents : {2, 3, 5, 8, 9, 13, 17})
+            {
+                for (size_t nIters : {1, 7, 8, 31, 1027})
+                {
+                    std::vector<GByte> abySrc(nComponents * nIters * nDTSize);
+                    for (size_t i = 0; i < abySrc.size(); ++i)
+                        abySrc[i] = static_cast<GByte>(i * 7 + i / 251);
+
+                    std::vector<std::vector<GByte>> aabyComp(nComponents);
+                    std::vector<void *> apComp(nComponents);
+                    for (int iComp = 0; iComp < nComponents; ++iComp)
+                    {
+                        aabyComp[iComp].resize(nIters * nDTSize);
+                        apComp[iComp] = aabyComp[iComp].data();
+                    }
+                    GDALDeinterleave(abySrc.data(), eDT, nComponents,
+                                     apComp.data(), eDT, nIters);
+                    for (int iComp = 0; iComp < nComponents; ++iComp)
+                    {
+                        for (size_t i = 0; i < nIters; ++i)
+                        {
+                            ASSERT_EQ(memcmp(aabyComp[iComp].data() +
+                                                 i * nDTSize,
+                                             abySrc.data() +
+                                                 (i * nComponents + iComp) *
+                                                     nDTSize,
+                                             nDTSize),
+                                      0)
+                                << GDALGetDataTypeName(eDT) << " "
+                                << nComponents << " " << nIters;
+                        }
+                    }
+
+                    std::vector<GByte> abyInterleaved(abySrc.size());
+                    std::vector<const void *> apConstComp(apComp.begin(),
+                                                          apComp.end());
+                    GDALInterleave(apConstComp.data(), eDT, nComponents,
+                                   abyInterleaved.data(), eDT, nIters);
+                    ASSERT_EQ(abyInterleaved, abySrc)
+                        << GDALGetDataTypeName(eDT) << " " << nComponents
+                        << " " << nIters;
+                }
+            }
+        }
+    }
+}
+
+// Test GDALInterleave() with data type conversion
+TEST_F(test_gdal, GDALInterleaveGeneralCase)
+{
+    const GByte abySrc0[] = {0, 2, 4};
+    const GByte abySrc1[] = {1, 3, 255};
+    const void *apSrc[] = {abySrc0, abySrc1};
+    GUInt16 anDest[6] = {0};
+    GDALInterleave(apSrc, GDT_Byte, 2, anDest, GDT_UInt16, 3);
+    EXPECT_EQ(anDest[0], 0);
+    EXPECT_EQ(anDest[1], 1);
+    EXPECT_EQ(anDest[2], 2);
+    EXPECT_EQ(anDest[3], 3);
+    EXPECT_EQ(anDest[4], 4);
+    EXPECT_EQ(anDest[5], 255);
+}
+
 // Test GDALDataset::ReportError()
 TEST_F(test_gdal, GDALDatasetReportError)
 {
@@ -5276,6 +5350,48 @@ TEST_F(test_gdal, GDALTranspose2D_Byte_optims)
     }
 }
 
+TEST_F(test_gdal, GDALTranspose2D_AVX2_optims)
+{
+    for (const char *pszUseAVX2 : {"YES", "NO"})
+    {
+        CPLConfigOptionSetter oSetter("GDAL_USE_AVX2", pszUseAVX2, false);
+        for (const auto &[W, H] : std::vector<std::pair<int, int>>{
+                 {8, 8}, {67, 13}, {100, 9}, {9, 100}, {130, 71}})
+        {
+            {
+                std::vector<GUInt16> in(W * H);
+                for (int i = 0; i < W * H; ++i)
+                    in[i] = static_cast<GUInt16>(i * 3);
+                std::vector<GUInt16> out(in.size());
+                GDALTranspose2D(in.data(), GDT_UInt16, out.data(), GDT_UInt16,
+                                W, H);
+                for (int y = 0; y < H; ++y)
+                {
+                    for (int x = 0; x < W; ++x)
+                    {
+                        ASSERT_EQ(out[x * H + y], in[y * W + x]);
+                    }
+                }
+            }
+            {
+                std::vector<float> in(W * H);
+                for (int i = 0; i < W * H; ++i)
+                    in[i] = static_cast<float>(i);
+                std::vector<float> out(in.size());
+                GDALTranspose2D(in.data(), GDT_Float32, out.data(),
+                                GDT_Float32, W, H);
+                for (int y = 0; y < H; ++y)
+                {
+                    for (int x = 0; x < W; ++x)
+                    {
+                        ASSERT_EQ(out[x * H + y], in[y * W + x]);
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST_F(test_gdal, GDALExpandPackedBitsToByteAt0Or1)
 {
     unsigned next = 1;
@@ -5433,4 +5549,311 @@ TEST_F(test_gdal, GDALRegenerateOverviewsMultiBand_very_large_block_size)
               CE_Failure);
 }
 
+// Test GDALDatasetCopyWholeRaster() and GDALRasterBandCopyWholeRaster()
+// with reading done in a worker thread
+TEST_F(test_gdal, GDALDatasetCopyWholeRaster_async_read)
+{
+    auto poDriver = GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+    GDALDatasetUniquePtr poSrcDS(
+        poDriver->Create("", 100, 50, 3, GDT_UInt16, nullptr));
+    std::vector<uint16_t> anValues(100 * 50 * 3);
+    for (size_t i = 0; i < anValues.size(); ++i)
+        anValues[i] = static_cast<uint16_t>(i);
+    ASSERT_EQ(poSrcDS->RasterIO(GF_Write, 0, 0, 100, 50, anValues.data(), 100,
+                                50, GDT_UInt16, 3, nullptr, 0, 0, 0, nullptr),
+              CE_None);
+
+    // Force several swaths
+    CPLConfigOptionSetter oSwathSize("GDAL_SWATH_SIZE", "1000", false);
+
+    for (const char *pszInterleave : {"BAND", "PIXEL"})
+    {
+        for (const char *pszReadAhead : {"1", "3"})
+        {
+            CPLConfigOptionSetter oReadAhead(
+                "GDAL_COPY_WHOLE_RASTER_ASYNC_READ_AHEAD", pszReadAhead,
+                false);
+            GDALDatasetUniquePtr poDstDS(
+                poDriver->Create("", 100, 50, 3, GDT_UInt16, nullptr));
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("INTERLEAVE", pszInterleave);
+            aosOptions.SetNameValue("ASYNC_READ", "YES");
+            double dfLastProgress = 0;
+            const auto Progress = [](double dfComplete, const char *,
+                                     void *pData)
+            {
+                double *pdfLastProgress = static_cast<double *>(pData);
+                EXPECT_GE(dfComplete, *pdfLastProgress);
+                *pdfLastProgress = dfComplete;
+                return TRUE;
+            };
+            ASSERT_EQ(GDALDatasetCopyWholeRaster(
+                          GDALDataset::ToHandle(poSrcDS.get()),
+                          GDALDataset::ToHandle(poDstDS.get()),
+                          aosOptions.List(), Progress, &dfLastProgress),
+                      CE_None);
+            EXPECT_EQ(dfLastProgress, 1.0);
+
+            std::vector<uint16_t> anGot(anValues.size());
+            ASSERT_EQ(poDstDS->RasterIO(GF_Read, 0, 0, 100, 50, anGot.data(),
+                                        100, 50, GDT_UInt16, 3, nullptr, 0, 0,
+                                        0, nullptr),
+                      CE_None);
+            EXPECT_EQ(anGot, anValues);
+        }
+    }
+
+    {
+        GDALDatasetUniquePtr poDstDS(
+            poDriver->Create("", 100, 50, 1, GDT_UInt16, nullptr));
+        const char *const apszOptions[] = {"ASYNC_READ=YES", nullptr};
+        ASSERT_EQ(GDALRasterBandCopyWholeRaster(
+                      GDALRasterBand::ToHandle(poSrcDS->GetRasterBand(2)),
+                      GDALRasterBand::ToHandle(poDstDS->GetRasterBand(1)),
+                      apszOptions, nullptr, nullptr),
+                  CE_None);
+        std::vector<uint16_t> anGot(100 * 50);
+        ASSERT_EQ(poDstDS->GetRasterBand(1)->RasterIO(
+                      GF_Read, 0, 0, 100, 50, anGot.data(), 100, 50,
+                      GDT_UInt16, 0, 0, nullptr),
+                  CE_None);
+        EXPECT_TRUE(std::equal(anGot.begin(), anGot.end(),
+                               anValues.begin() + 100 * 50));
+    }
+
+    // Test that a user interruption stops the reader thread
+    {
+        GDALDatasetUniquePtr poDstDS(
+            poDriver->Create("", 100, 50, 3, GDT_UInt16, nullptr));
+        const char *const apszOptions[] = {"ASYNC_READ=YES", nullptr};
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(GDALDatasetCopyWholeRaster(
+                      GDALDataset::ToHandle(poSrcDS.get()),
+                      GDALDataset::ToHandle(poDstDS.get()), apszOptions,
+                      [](double dfComplete, const char *, void *)
+                      { return dfComplete < 0.5 ? TRUE : FALSE; },
+                      nullptr),
+                  CE_Failure);
+        EXPECT_EQ(CPLGetLastErrorNo(), CPLE_UserInterrupt);
+    }
+}
+
+// Test resampled RasterIO() with buffer data types different from the
+// dataset one, and on the band and dataset code paths
+TEST_F(test_gdal, RasterIO_resampled_buffer_data_types)
+{
+    GDALDriver *poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poDriver)
+        GTEST_SKIP() << "MEM driver missing";
+
+    constexpr int W = 40;
+    constexpr int H = 30;
+    GDALDatasetUniquePtr poDS(
+        poDriver->Create("", W, H, 2, GDT_Float32, nullptr));
+    std::vector<float> afValues(W * H);
+    for (int iBand = 1; iBand <= 2; ++iBand)
+    {
+        for (int i = 0; i < W * H; ++i)
+            afValues[i] = static_cast<float>((i * 7 + iBand * 13) % 251);
+        ASSERT_EQ(poDS->GetRasterBand(iBand)->RasterIO(
+                      GF_Write, 0, 0, W, H, afValues.data(), W, H,
+                      GDT_Float32, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    for (const auto eResampleAlg :
+         {GRIORA_Bilinear, GRIORA_Cubic, GRIORA_Lanczos, GRIORA_Average})
+    {
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        sExtraArg.eResampleAlg = eResampleAlg;
+        sExtraArg.bFloatingPointWindowValidity = TRUE;
+        sExtraArg.dfXOff = 1.5;
+        sExtraArg.dfYOff = 2.25;
+        sExtraArg.dfXSize = 35.5;
+        sExtraArg.dfYSize = 26;
+
+        constexpr int BUF_W = 13;
+        constexpr int BUF_H = 7;
+        for (int iBand = 1; iBand <= 2; ++iBand)
+        {
+            auto poBand = poDS->GetRasterBand(iBand);
+            std::vector<float> afRef(BUF_W * BUF_H);
+            ASSERT_EQ(poBand->RasterIO(GF_Read, 1, 2, 36, 26, afRef.data(),
+                                       BUF_W, BUF_H, GDT_Float32, 0, 0,
+                                       &sExtraArg),
+                      CE_None);
+
+            // Repeated request must give the same result
+            std::vector<float> afGot(BUF_W * BUF_H);
+            ASSERT_EQ(poBand->RasterIO(GF_Read, 1, 2, 36, 26, afGot.data(),
+                                       BUF_W, BUF_H, GDT_Float32, 0, 0,
+                                       &sExtraArg),
+                      CE_None);
+            EXPECT_EQ(afGot, afRef);
+
+            std::vector<double> adfGot(BUF_W * BUF_H);
+            ASSERT_EQ(poBand->RasterIO(GF_Read, 1, 2, 36, 26, adfGot.data(),
+                                       BUF_W, BUF_H, GDT_Float64, 0, 0,
+                                       &sExtraArg),
+                      CE_None);
+            for (int i = 0; i < BUF_W * BUF_H; ++i)
+            {
+                EXPECT_EQ(adfGot[i], static_cast<double>(afRef[i]))
+                    << eResampleAlg << " " << i;
+            }
+
+            // Dataset code path, pixel interleaved
+            std::vector<float> afDS(2 * BUF_W * BUF_H);
+            ASSERT_EQ(poDS->RasterIO(GF_Read, 1, 2, 36, 26, afDS.data(),
+                                     BUF_W, BUF_H, GDT_Float32, 2, nullptr,
+                                     2 * sizeof(float),
+                                     2 * sizeof(float) * BUF_W, sizeof(float),
+                                     &sExtraArg),
+                      CE_None);
+            for (int i = 0; i < BUF_W * BUF_H; ++i)
+            {
+                EXPECT_NEAR(afDS[2 * i + iBand - 1], afRef[i], 1e-3)
+                    << eResampleAlg << " " << i;
+            }
+        }
+    }
+}
+
+// Test GDALDataset::MultiRangeRasterIO() and
+// GDALRasterBand::MultiRangeRasterIO()
+TEST_F(test_gdal, MultiRangeRasterIO)
+{
+    GDALDriver *poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poDriver)
+        GTEST_SKIP() << "MEM driver missing";
+
+    constexpr int W = 100;
+    constexpr int H = 70;
+    GDALDatasetUniquePtr poDS(
+        poDriver->Create("", W, H, 3, GDT_Int16, nullptr));
+    std::vector<int16_t> anValues(W * H * 3);
+    for (size_t i = 0; i < anValues.size(); ++i)
+        anValues[i] = static_cast<int16_t>(i % 32000);
+    ASSERT_EQ(poDS->RasterIO(GF_Write, 0, 0, W, H, anValues.data(), W, H,
+                             GDT_Int16, 3, nullptr, 0, 0, 0, nullptr),
+              CE_None);
+
+    // Put a block of band 2 in the block cache
+    {
+        GDALRasterBlock *poBlock =
+            poDS->GetRasterBand(2)->GetLockedBlockRef(0, 10);
+        ASSERT_NE(poBlock, nullptr);
+        poBlock->DropLock();
+    }
+
+    const int anWindows[][4] = {{90, 60, 10, 10}, {0, 0, 1, 1},
+                                {5, 10, 3, 1},    {50, 5, 1, 1},
+                                {0, 10, 100, 1},  {0, 0, W, H},
+                                {99, 69, 1, 1}};
+    constexpr int nWindowCount = static_cast<int>(std::size(anWindows));
+    std::vector<std::vector<float>> aafBuffers;
+    std::vector<GDALRasterIOWindow> asWindows;
+    for (const auto &anWindow : anWindows)
+    {
+        aafBuffers.emplace_back(anWindow[2] * anWindow[3] * 3, -1.0f);
+        GDALRasterIOWindow sWindow;
+        sWindow.nXOff = anWindow[0];
+        sWindow.nYOff = anWindow[1];
+        sWindow.nXSize = anWindow[2];
+        sWindow.nYSize = anWindow[3];
+        sWindow.pData = aafBuffers.back().data();
+        sWindow.nPixelSpace = 0;
+        sWindow.nLineSpace = 0;
+        sWindow.nBandSpace = 0;
+        asWindows.push_back(sWindow);
+    }
+
+    const auto CheckWindow = [&](int iWindow, const float *pafGot, int nBand,
+                                 GSpacing nPixelSpace, GSpacing nLineSpace)
+    {
+        const auto &anWindow = anWindows[iWindow];
+        for (int iY = 0; iY < anWindow[3]; ++iY)
+        {
+            for (int iX = 0; iX < anWindow[2]; ++iX)
+            {
+                const size_t nIdx =
+                    static_cast<size_t>(nBand - 1) * W * H +
+                    static_cast<size_t>(anWindow[1] + iY) * W + anWindow[0] +
+                    iX;
+                EXPECT_EQ(pafGot[iY * nLineSpace + iX * nPixelSpace],
+                          static_cast<float>(anValues[nIdx]))
+                    << iWindow << " " << nBand << " " << iX << " " << iY;
+            }
+        }
+    };
+
+    // Band
+    EXPECT_EQ(poDS->GetRasterBand(2)->MultiRangeRasterIO(
+                  nWindowCount, asWindows.data(), GDT_Float32),
+              CE_None);
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        CheckWindow(i, aafBuffers[i].data(), 2, 1, anWindows[i][2]);
+    }
+
+    // Dataset, band sequential
+    EXPECT_EQ(poDS->MultiRangeRasterIO(nWindowCount, asWindows.data(),
+                                       GDT_Float32, 3, nullptr),
+              CE_None);
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        for (int iBand = 1; iBand <= 3; ++iBand)
+        {
+            CheckWindow(i,
+                        aafBuffers[i].data() + static_cast<size_t>(iBand - 1) *
+                                                   anWindows[i][2] *
+                                                   anWindows[i][3],
+                        iBand, 1, anWindows[i][2]);
+        }
+    }
+
+    // Dataset, pixel interleaved, with a band map
+    const int anBandMap[] = {3, 1};
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        asWindows[i].nPixelSpace = 2 * sizeof(float);
+        asWindows[i].nBandSpace = sizeof(float);
+    }
+    EXPECT_EQ(poDS->MultiRangeRasterIO(nWindowCount, asWindows.data(),
+                                       GDT_Float32, 2, anBandMap),
+              CE_None);
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        CheckWindow(i, aafBuffers[i].data(), 3, 2, 2 * anWindows[i][2]);
+        CheckWindow(i, aafBuffers[i].data() + 1, 1, 2, 2 * anWindows[i][2]);
+    }
+
+    // Error cases
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        GDALRasterIOWindow sWindow = asWindows[0];
+        sWindow.nXOff = W - sWindow.nXSize + 1;
+        EXPECT_EQ(poDS->GetRasterBand(1)->MultiRangeRasterIO(1, &sWindow,
+                                                             GDT_Float32),
+                  CE_Failure);
+        sWindow = asWindows[0];
+        sWindow.pData = nullptr;
+        EXPECT_EQ(poDS->GetRasterBand(1)->MultiRangeRasterIO(1, &sWindow,
+                                                             GDT_Float32),
+                  CE_Failure);
+        const int nInvalidBand = 4;
+        EXPECT_EQ(poDS->MultiRangeRasterIO(1, asWindows.data(), GDT_Float32,
+                                           1, &nInvalidBand),
+                  CE_Failure);
+        EXPECT_EQ(poDS->MultiRangeRasterIO(1, asWindows.data(), GDT_Float32,
+                                           4, nullptr),
+                  CE_Failure);
+    }
+
+    EXPECT_EQ(poDS->MultiRangeRasterIO(0, nullptr, GDT_Float32, 3, nullptr),
+              CE_None);
+
+}
+
 }  // namespace
@@ -15,8 +15,10 @@
 #include "gdal.h"
 
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -1335,4 +1337,119 @@ TEST_F(TestCopyWords, Int16ToInt16)
     }
 }
 
+TEST_F(TestCopyWords, LargeConversionsConsistentWithSingleWord)
+{
+    // Check that conversions of large buffers, which may go through SIMD
+    // code paths, give the same results as word-per-word conversions.
+    const double adfSpecialValues[] = {
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        0.0,
+        -0.0,
+        0.5,
+        -0.5,
+        0.49999997,
+        -0.6,
+        254.5,
+        255.5,
+        256,
+        -1,
+        32766.5,
+        32767.5,
+        -32767.5,
+        -32768.5,
+        65534.5,
+        65535.5,
+        65536,
+        2147483520.0,
+        2147483646.5,
+        2147483647.0,
+        2147483648.0,
+        -2147483647.5,
+        -2147483648.0,
+        -2147483649.0,
+        3.4028234663852886e38,
+        3.4028235677973366e38,
+        -3.4028235677973366e38,
+        1e39,
+        -1e39};
+    constexpr int N = 600;
+    std::vector<double> adfValues(N);
+    for (int i = 0; i < N; i++)
+    {
+        if (i < static_cast<int>(CPL_ARRAYSIZE(adfSpecialValues)))
+            adfValues[i] = adfSpecialValues[i];
+        else
+            adfValues[i] = ((i * 7919) % 140000 - 70000) + (i % 4) * 0.25;
+    }
+
+    const GDALDataType aeTypes[] = {GDT_Byte,  GDT_UInt16,  GDT_Int16,
+                                    GDT_Int32, GDT_Float32, GDT_Float64};
+    for (const GDALDataType eIn : aeTypes)
+    {
+        const int nInSize = GDALGetDataTypeSizeBytes(eIn);
+        for (const GDALDataType eOut : aeTypes)
+        {
+            const int nOutSize = GDALGetDataTypeSizeBytes(eOut);
+            for (int nStride = 1; nStride <= 3; nStride += 2)
+            {
+                std::vector<GByte> abyIn(N * nStride * nInSize);
+                for (int i = 0; i < N; i++)
+                {
+                    GDALCopyWords(&adfValues[i], GDT_Float64, 0,
+                                  abyIn.data() + i * nStride * nInSize, eIn,
+                                  0, 1);
+                }
+
+                std::vector<GByte> abyExpected(N * nStride * nOutSize);
+                std::vector<GByte> abyOut(N * nStride * nOutSize);
+                for (int i = 0; i < N; i++)
+                {
+                    GDALCopyWords(abyIn.data() + i * nStride * nInSize, eIn,
+                                  0, abyExpected.data() + i * nOutSize, eOut,
+                                  0, 1);
+                }
+
+                // Pixel-interleaved input to packed output
+                GDALCopyWords(abyIn.data(), eIn, nStride * nInSize,
+                              abyOut.data(), eOut, nOutSize, N);
+                for (int i = 0; i < N; i++)
+                {
+                    EXPECT_EQ(memcmp(abyOut.data() + i * nOutSize,
+                                     abyExpected.data() + i * nOutSize,
+                                     nOutSize),
+                              0)
+                        << GDALGetDataTypeName(eIn) << " -> "
+                        << GDALGetDataTypeName(eOut) << ", stride "
+                        << nStride << ", value " << adfValues[i];
+                }
+
+                // Packed input to pixel-interleaved output
+                if (nStride > 1)
+                {
+                    for (int i = 0; i < N; i++)
+                    {
+                        memmove(abyIn.data() + i * nInSize,
+                                abyIn.data() + i * nStride * nInSize,
+                                nInSize);
+                    }
+                    GDALCopyWords(abyIn.data(), eIn, nInSize, abyOut.data(),
+                                  eOut, nStride * nOutSize, N);
+                    for (int i = 0; i < N; i++)
+                    {
+                        EXPECT_EQ(memcmp(abyOut.data() + i * nStride * nOutSize,
+                                         abyExpected.data() + i * nOutSize,
+                                         nOutSize),
+                                  0)
+                            << GDALGetDataTypeName(eIn) << " -> "
+                            << GDALGetDataTypeName(eOut) << ", stride "
+                            << nStride << ", value " << adfValues[i];
+                    }
+                }
+            }
+        }
+    }
+}
+
 }  // namespace
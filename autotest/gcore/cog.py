@@ -1936,6 +1936,33 @@ def test_cog_mask_band_overviews(tmp_vsimem):
     assert ds.GetRasterBand(1).GetOverview(1).IsMaskBand()
 
 
+###############################################################################
+# Test that keeping temporary files in memory does not change the output
+
+
+def test_cog_tmp_in_memory(tmp_path):
+
+    src_ds = gdal.Translate(
+        "",
+        "data/stefan_full_rgba.tif",
+        options="-of MEM -outsize 1024 0 -a_srs EPSG:4326 -a_ullr 2 49 3 48",
+    )
+
+    filenames = []
+    for max_size in ("0", "1GB"):
+        filename = str(tmp_path / f"out_{max_size}.tif")
+        with gdal.config_option("COG_TMP_IN_MEMORY_MAX_SIZE", max_size):
+            gdal.GetDriverByName("COG").CreateCopy(
+                filename,
+                src_ds,
+                options=["TILING_SCHEME=GoogleMapsCompatible", "BLOCKSIZE=128"],
+            )
+        filenames.append(filename)
+        assert not [x for x in os.listdir(tmp_path) if x.endswith(".tmp")]
+
+    assert open(filenames[0], "rb").read() == open(filenames[1], "rb").read()
+
+
 ###############################################################################
 # Verify that we can generate an output that is byte-identical to the expected golden file.
 
@@ -18,6 +18,7 @@ import threading
 
 import gdaltest
 import pytest
+import webserver
 
 from osgeo import gdal
 
@@ -866,3 +867,81 @@ def test_libertiff_corrupted_lzw():
     ds = libertiff_open("data/gtiff/lzw_corrupted.tif")
     with pytest.raises(Exception):
         ds.ReadRaster()
+
+
+###############################################################################
+# Test RasterIO() requests on a network file, where the striles of the
+# requested blocks are fetched with a single ReadMultiRange() call
+
+
+@pytest.mark.require_curl()
+@pytest.mark.parametrize("INTERLEAVE", ["PIXEL", "BAND"])
+@pytest.mark.parametrize("NUM_THREADS", [None, "2"])
+def test_libertiff_vsicurl_prefetched_striles(tmp_vsimem, INTERLEAVE, NUM_THREADS):
+
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.Translate(
+        filename,
+        "data/rgbsmall.tif",
+        width=256,
+        height=256,
+        creationOptions=[
+            "TILED=YES",
+            "BLOCKXSIZE=32",
+            "BLOCKYSIZE=32",
+            "COMPRESS=DEFLATE",
+            "INTERLEAVE=" + INTERLEAVE,
+        ],
+    )
+    expected = libertiff_open(filename).ReadRaster()
+    f = gdal.VSIFOpenL(filename, "rb")
+    filedata = gdal.VSIFReadL(1, gdal.VSIStatL(filename).size, f)
+    gdal.VSIFCloseL(f)
+
+    class RangeHandler(webserver.BaseMockedHttpHandler):
+        def final_check(self):
+            pass
+
+        def process(self, method, request):
+            if method == "HEAD":
+                request.send_response(200)
+                request.send_header("Content-Length", len(filedata))
+                request.end_headers()
+                return
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), len(filedata) - 1)
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(filedata))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(filedata[start : end + 1])
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+    try:
+        handler = RangeHandler()
+        with webserver.install_http_handler(handler), gdal.config_option(
+            "GDAL_DISABLE_READDIR_ON_OPEN", "EMPTY_DIR"
+        ):
+            ds = libertiff_open(
+                "/vsicurl/http://127.0.0.1:%d/test.tif" % webserver_port,
+                open_options=(
+                    [] if NUM_THREADS is None else ["NUM_THREADS=" + NUM_THREADS]
+                ),
+            )
+            assert ds.ReadRaster() == expected
+            assert ds.ReadRaster(32, 64, 128, 96) == libertiff_open(
+                filename
+            ).ReadRaster(32, 64, 128, 96)
+            ds = None
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+        gdal.VSICurlClearCache()
@@ -4178,6 +4178,36 @@ def test_tiff_read_cog_strile_arrays_zeroified_when_possible():
     assert cs_mask == 1222
 
 
+###############################################################################
+# Test reading local files with the multi-range read backends
+
+
+@pytest.mark.parametrize("backend", ["THREADS", "IO_URING"])
+def test_tiff_read_local_multi_range_backend(tmp_path, backend):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = str(tmp_path / "test.tif")
+    gdal.Translate(
+        filename,
+        src_ds,
+        options="-co TILED=YES -co BLOCKXSIZE=16 -co BLOCKYSIZE=16 -co COMPRESS=LZW",
+    )
+    expected_data = gdal.Open(filename).ReadRaster()
+
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_UNIX_MULTI_RANGE_READ": backend,
+            "CPL_VSIL_UNIX_MULTI_RANGE_READ_QUEUE_DEPTH": "4",
+        }
+    ):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == expected_data
+
+        ds = gdal.Open("data/cog_strile_arrays_zeroified_when_possible.tif")
+        assert ds.GetRasterBand(1).Checksum() == 4873
+        assert ds.GetRasterBand(1).GetMaskBand().Checksum() == 1222
+
+
 ###############################################################################
 # Check that our reading of a COG with /vsicurl is efficient
 
@@ -5619,3 +5649,191 @@ def test_tiff_read_multithreaded_read_missing_tilebytecounts_and_offsets():
         match="missing_tilebytecounts_and_offsets.tif: Error while getting location of block 0",
     ):
         ds.ReadRaster()
+
+
+###############################################################################
+# Test READ_AHEAD open option
+
+
+@pytest.mark.parametrize(
+    "creation_options,nbands",
+    [
+        (["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"], 3),
+        (["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "INTERLEAVE=BAND"], 2),
+        (["BLOCKYSIZE=3"], 3),
+        (["BLOCKYSIZE=1", "INTERLEAVE=BAND"], 2),
+    ],
+)
+@gdaltest.enable_exceptions()
+def test_tiff_read_read_ahead(tmp_vsimem, creation_options, nbands):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 50, 45, nbands)
+    for i in range(nbands):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, 50, 45, bytes((i + 3 * x) % 251 for x in range(50 * 45))
+        )
+    filename = tmp_vsimem / "test_tiff_read_read_ahead.tif"
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=["COMPRESS=DEFLATE"] + creation_options
+    )
+
+    with gdaltest.SetCacheMax(10 * 1024 * 1024):
+        ds = gdal.OpenEx(filename, open_options=["NUM_THREADS=2", "READ_AHEAD=2"])
+        # Line-by-line dataset reads
+        for y in range(ds.RasterYSize):
+            assert ds.ReadRaster(0, y, ds.RasterXSize, 1) == src_ds.ReadRaster(
+                0, y, ds.RasterXSize, 1
+            )
+        ds = None
+
+        ds = gdal.OpenEx(filename, open_options=["NUM_THREADS=2", "READ_AHEAD=3"])
+        # Line-by-line band reads, on a window not aligned on blocks
+        for i in range(nbands):
+            for y in range(5, ds.RasterYSize):
+                assert ds.GetRasterBand(i + 1).ReadRaster(
+                    3, y, 40, 1
+                ) == src_ds.GetRasterBand(i + 1).ReadRaster(3, y, 40, 1)
+        ds = None
+
+    with gdal.config_option("GTIFF_READ_AHEAD", "4"):
+        ds = gdal.OpenEx(filename, open_options=["NUM_THREADS=2"])
+    assert [
+        ds.GetRasterBand(i + 1).Checksum() for i in range(nbands)
+    ] == [src_ds.GetRasterBand(i + 1).Checksum() for i in range(nbands)]
+
+
+###############################################################################
+# Test multi-threaded decoding of implicit JPEG-in-TIFF overviews
+
+
+@pytest.mark.require_creation_option("GTiff", "JPEG")
+@pytest.mark.require_driver("JPEG")
+@pytest.mark.parametrize(
+    "creation_options",
+    [
+        ["TILED=YES"],
+        ["TILED=YES", "PHOTOMETRIC=YCBCR"],
+        ["TILED=YES", "INTERLEAVE=BAND"],
+        ["BLOCKYSIZE=64"],
+    ],
+)
+@gdaltest.enable_exceptions()
+def test_tiff_read_jpeg_implicit_overviews_multithreaded(
+    tmp_vsimem, creation_options
+):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/small_world.tif",
+        format="MEM",
+        width=1600,
+        height=800,
+    )
+    filename = tmp_vsimem / "test_tiff_read_jpeg_implicit_overviews_mt.tif"
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=["COMPRESS=JPEG"] + creation_options
+    )
+
+    ds = gdal.Open(filename)
+    ds_mt = gdal.OpenEx(filename, open_options=["NUM_THREADS=2"])
+    for factor in (2, 4, 8):
+        # Whole raster, and window not aligned on blocks
+        for xoff, yoff, xsize, ysize in [(0, 0, 1600, 800), (40, 24, 800, 400)]:
+            args = (xoff, yoff, xsize, ysize, xsize // factor, ysize // factor)
+            assert ds_mt.ReadRaster(*args) == ds.ReadRaster(*args)
+            assert ds_mt.ReadRaster(*args, band_list=[3, 1]) == ds.ReadRaster(
+                *args, band_list=[3, 1]
+            )
+
+
+###############################################################################
+# Test the persistent block cache
+
+
+@gdaltest.enable_exceptions()
+def test_tiff_read_persistent_block_cache(tmp_path):
+
+    cache_dir = tmp_path / "cache"
+    filename = str(tmp_path / "test_tiff_read_persistent_block_cache.tif")
+    src_ds = gdal.Open("data/byte.tif")
+    with gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"]
+    ) as ds:
+        ds.BuildOverviews("NEAR", [2])
+    expected_cs = src_ds.GetRasterBand(1).Checksum()
+
+    with gdal.config_options(
+        {
+            "GDAL_PERSISTENT_BLOCK_CACHE_DIR": str(cache_dir),
+            "GDAL_PERSISTENT_BLOCK_CACHE_REMOTE_ONLY": "NO",
+        }
+    ):
+        with gdal.Open(filename) as ds:
+            assert ds.GetRasterBand(1).Checksum() == expected_cs
+            expected_ovr_cs = ds.GetRasterBand(1).GetOverview(0).Checksum()
+            offset = int(
+                ds.GetRasterBand(1).GetMetadataItem("BLOCK_OFFSET_0_0", "TIFF")
+            )
+        # 4 full resolution blocks and 1 overview block
+        assert len(list(cache_dir.glob("*/*.blk"))) == 5
+
+        # Alter the content of the first block, without changing the size
+        # and modification time of the file, to check that cached blocks
+        # are used
+        st = os.stat(filename)
+        with open(filename, "r+b") as f:
+            f.seek(offset)
+            f.write(b"\0" * 256)
+        os.utime(filename, ns=(st.st_atime_ns, st.st_mtime_ns))
+
+        with gdal.Open(filename) as ds:
+            assert ds.GetRasterBand(1).Checksum() == expected_cs
+            assert ds.GetRasterBand(1).GetOverview(0).Checksum() == expected_ovr_cs
+
+        # Once the modification time changes, cached blocks are ignored
+        os.utime(filename, ns=(st.st_atime_ns, st.st_mtime_ns + 2 * 10**9))
+        with gdal.Open(filename) as ds:
+            assert ds.GetRasterBand(1).Checksum() != expected_cs
+
+        # Check eviction
+        with gdal.config_option("GDAL_PERSISTENT_BLOCK_CACHE_MAX_SIZE", "1000"):
+            with gdal.Open(filename) as ds:
+                ds.GetRasterBand(1).GetOverview(0).Checksum()
+        assert sum(f.stat().st_size for f in cache_dir.glob("*/*.blk")) <= 1000
+
+
+###############################################################################
+# Test that open options are part of the persistent block cache key, and that
+# only drivers that opted in use the cache
+
+
+@gdaltest.enable_exceptions()
+def test_tiff_read_persistent_block_cache_open_options(tmp_path):
+
+    cache_dir = tmp_path / "cache"
+    filename = str(tmp_path / "test.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename,
+        gdal.Open("data/byte.tif"),
+        options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    )
+    envi_filename = str(tmp_path / "test.envi")
+    gdal.GetDriverByName("ENVI").CreateCopy(envi_filename, gdal.Open(filename))
+
+    with gdal.config_options(
+        {
+            "GDAL_PERSISTENT_BLOCK_CACHE_DIR": str(cache_dir),
+            "GDAL_PERSISTENT_BLOCK_CACHE_REMOTE_ONLY": "NO",
+        }
+    ):
+        with gdal.Open(filename) as ds:
+            ds.GetRasterBand(1).Checksum()
+        assert len(list(cache_dir.glob("*/*.blk"))) == 4
+
+        with gdal.OpenEx(filename, open_options=["GEOREF_SOURCES=INTERNAL"]) as ds:
+            ds.GetRasterBand(1).Checksum()
+        assert len(list(cache_dir.glob("*/*.blk"))) == 8
+
+        with gdal.Open(envi_filename) as ds:
+            ds.GetRasterBand(1).Checksum()
+        assert len(list(cache_dir.glob("*/*.blk"))) == 8
@@ -6176,7 +6176,109 @@ def test_tiff_write_133():
 
 
 ###############################################################################
-# Test DISCARD_LSB
+# Test streaming compressed output with CreateCopy()
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["COMPRESS=DEFLATE"],
+        ["COMPRESS=LZW", "PREDICTOR=2", "TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        ["COMPRESS=PACKBITS", "INTERLEAVE=BAND", "BLOCKYSIZE=7"],
+    ],
+)
+@pytest.mark.parametrize("cachemax", [100 * 1024 * 1024, 0])
+def test_tiff_write_streamable_compressed(tmp_vsimem, options, cachemax):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = str(tmp_vsimem / "out.tif")
+    # With a zero cache size, compressed blocks are not kept between the
+    # two passes
+    with gdaltest.SetCacheMax(cachemax):
+        out_ds = gdaltest.tiff_drv.CreateCopy(
+            filename, src_ds, options=["STREAMABLE_OUTPUT=YES"] + options
+        )
+        assert out_ds is not None
+        out_ds = None
+
+    expected_cs = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    with gdal.config_option("TIFF_READ_STREAMING", "YES"):
+        ds = gdal.Open(filename)
+    assert ds.GetMetadataItem("UNORDERED_BLOCKS", "TIFF") is None
+    assert ds.GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE") is not None
+    assert ds.GetGeoTransform() == src_ds.GetGeoTransform()
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+    ds = None
+
+    ds = gdal.Open(filename)
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+
+
+###############################################################################
+# Test streaming compressed separate-planar output from a pixel-interleaved
+# source, which must still be written band after band
+
+
+def test_tiff_write_streamable_compressed_pixel_interleaved_source(tmp_vsimem):
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", creationOptions=["INTERLEAVE=PIXEL"]
+    )
+    assert src_ds.GetMetadataItem("INTERLEAVE", "IMAGE_STRUCTURE") == "PIXEL"
+    filename = str(tmp_vsimem / "out.tif")
+    with gdaltest.SetCacheMax(0):
+        out_ds = gdaltest.tiff_drv.CreateCopy(
+            filename,
+            src_ds,
+            options=[
+                "STREAMABLE_OUTPUT=YES",
+                "COMPRESS=DEFLATE",
+                "INTERLEAVE=BAND",
+                "BLOCKYSIZE=8",
+            ],
+        )
+        assert out_ds is not None
+        out_ds = None
+
+    expected_cs = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    with gdal.config_option("TIFF_READ_STREAMING", "YES"):
+        ds = gdal.Open(filename)
+    assert ds is not None
+    assert ds.GetMetadataItem("UNORDERED_BLOCKS", "TIFF") is None
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+    ds = None
+
+    ds = gdal.Open(filename)
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+
+
+###############################################################################
+# Test CreateCopy() to a file system that only supports sequential writing
+
+
+def test_tiff_write_streamable_write_once_file_system(tmp_vsimem):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = str(tmp_vsimem / "out.tif.gz")
+    out_ds = gdaltest.tiff_drv.CreateCopy(
+        "/vsigzip/" + filename, src_ds, options=["COMPRESS=DEFLATE"]
+    )
+    assert out_ds is not None
+    out_ds = None
+
+    ds = gdal.Open("/vsigzip/" + filename)
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+        src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+    ]
+    ds = None
+
+    # A per-dataset mask cannot be written in streaming mode
+    src_ds = gdal.Translate("", src_ds, format="MEM")
+    src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+    with pytest.raises(Exception, match="mask of the source dataset"):
+        gdaltest.tiff_drv.CreateCopy("/vsigzip/" + filename, src_ds)
 
 
 def test_tiff_write_134():
@@ -12033,3 +12135,167 @@ def test_tiff_write_interleave_tile(tmp_vsimem, COPY_SRC_OVERVIEWS):
                 )
                 assert offset > last_offset
                 last_offset = offset
+
+
+###############################################################################
+# Test GTIFF_PARALLEL_WRITE=YES
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["COMPRESS=DEFLATE", "TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        ["COMPRESS=DEFLATE", "BLOCKYSIZE=4"],
+        ["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        ["BLOCKYSIZE=4", "INTERLEAVE=BAND"],
+        [
+            "COMPRESS=LZW",
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COPY_SRC_OVERVIEWS=YES",
+        ],
+    ],
+)
+@pytest.mark.parametrize("use_vsimem", [True, False])
+def test_tiff_write_parallel_write(tmp_vsimem, tmp_path, options, use_vsimem):
+
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM")
+    src_ds.BuildOverviews("NEAR", [2])
+
+    if use_vsimem:
+        out_filename = str(tmp_vsimem / "out.tif")
+    else:
+        out_filename = str(tmp_path / "out.tif")
+
+    with gdal.config_option("GTIFF_PARALLEL_WRITE", "YES"):
+        gdal.GetDriverByName("GTiff").CreateCopy(
+            out_filename, src_ds, options=options + ["NUM_THREADS=4"]
+        )
+
+    ds = gdal.Open(out_filename)
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+    if "COPY_SRC_OVERVIEWS=YES" in options:
+        assert (
+            ds.GetRasterBand(1).GetOverview(0).ReadRaster()
+            == src_ds.GetRasterBand(1).GetOverview(0).ReadRaster()
+        )
+    ds = None
+
+    # Create(): read back blocks whose writes may be pending, and rewrite some
+    with gdal.config_option("GTIFF_PARALLEL_WRITE", "YES"):
+        ds = gdal.GetDriverByName("GTiff").Create(
+            out_filename,
+            50,
+            50,
+            3,
+            options=options + ["NUM_THREADS=4"],
+        )
+        ds.WriteRaster(0, 0, 50, 50, src_ds.ReadRaster())
+        # Read back while writes may be pending
+        assert ds.ReadRaster(0, 0, 50, 50) == src_ds.ReadRaster()
+        ds.WriteRaster(0, 0, 10, 10, b"\x01" * (10 * 10 * 3))
+        ds = None
+
+    ds = gdal.Open(out_filename)
+    assert ds.ReadRaster(0, 0, 10, 10) == b"\x01" * (10 * 10 * 3)
+    assert ds.ReadRaster(10, 10, 40, 40) == src_ds.ReadRaster(10, 10, 40, 40)
+
+
+###############################################################################
+# Test that compressed striles are copied without recompression when the
+# source and target layouts match
+
+
+def _get_raw_tiles(filename):
+    ds = gdal.Open(filename)
+    band = ds.GetRasterBand(1)
+    blockxsize, blockysize = band.GetBlockSize()
+    nblocksx = (ds.RasterXSize + blockxsize - 1) // blockxsize
+    nblocksy = (ds.RasterYSize + blockysize - 1) // blockysize
+    f = gdal.VSIFOpenL(filename, "rb")
+    try:
+        ret = []
+        for y in range(nblocksy):
+            for x in range(nblocksx):
+                offset = int(
+                    band.GetMetadataItem(f"BLOCK_OFFSET_{x}_{y}", "TIFF")
+                )
+                size = int(band.GetMetadataItem(f"BLOCK_SIZE_{x}_{y}", "TIFF"))
+                gdal.VSIFSeekL(f, offset, 0)
+                ret.append(gdal.VSIFReadL(1, size, f))
+        return ret
+    finally:
+        gdal.VSIFCloseL(f)
+
+
+@pytest.mark.parametrize("compress", ["DEFLATE", "ZSTD", "LERC"])
+def test_tiff_write_copy_raw_striles(tmp_vsimem, compress):
+
+    if compress not in gdal.GetDriverByName("GTiff").GetMetadataItem(
+        "DMD_CREATIONOPTIONLIST"
+    ):
+        pytest.skip(f"{compress} not available")
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    options = [
+        "COMPRESS=" + compress,
+        "TILED=YES",
+        "BLOCKXSIZE=16",
+        "BLOCKYSIZE=16",
+        "PREDICTOR=2" if compress != "LERC" else "MAX_Z_ERROR=0",
+    ]
+    # Use a non-default compression level so that recompressed tiles would
+    # differ from the source ones
+    if compress == "DEFLATE":
+        options.append("ZLEVEL=1")
+    elif compress == "ZSTD":
+        options.append("ZSTD_LEVEL=1")
+    gdal.Translate(src_filename, "data/byte.tif", creationOptions=options)
+
+    dst_filename = str(tmp_vsimem / "dst.tif")
+    dst_options = [x for x in options if "LEVEL" not in x]
+    gdal.Translate(dst_filename, src_filename, creationOptions=dst_options)
+    assert _get_raw_tiles(dst_filename) == _get_raw_tiles(src_filename)
+    assert gdal.Open(dst_filename).GetRasterBand(1).Checksum() == 4672
+
+    # Raw copy disabled: tiles are recompressed
+    if compress != "LERC":
+        with gdal.config_option("GTIFF_COPY_RAW_STRILES", "NO"):
+            gdal.Translate(
+                dst_filename, src_filename, creationOptions=dst_options
+            )
+        assert _get_raw_tiles(dst_filename) != _get_raw_tiles(src_filename)
+        assert gdal.Open(dst_filename).GetRasterBand(1).Checksum() == 4672
+
+    # Different block size: tiles are recompressed
+    gdal.Translate(
+        dst_filename,
+        src_filename,
+        creationOptions=[x for x in dst_options if "BLOCKYSIZE" not in x]
+        + ["BLOCKYSIZE=32"],
+    )
+    assert gdal.Open(dst_filename).GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test that striles of a source opened in update mode are not copied raw,
+# as they may not reflect pending modifications
+
+
+def test_tiff_write_copy_raw_striles_src_in_update_mode(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    options = ["COMPRESS=DEFLATE", "TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"]
+    gdal.Translate(src_filename, "data/byte.tif", creationOptions=options)
+
+    src_ds = gdal.Open(src_filename, gdal.GA_Update)
+    src_ds.GetRasterBand(1).WriteRaster(0, 0, 16, 16, b"\xff" * (16 * 16))
+    dst_filename = str(tmp_vsimem / "dst.tif")
+    dst_ds = gdal.GetDriverByName("GTiff").CreateCopy(
+        dst_filename, src_ds, options=options
+    )
+    assert dst_ds.ReadRaster(0, 0, 16, 16) == b"\xff" * (16 * 16)
+    assert dst_ds.ReadRaster() == src_ds.ReadRaster()
+    dst_ds = None
+    src_ds = None
@@ -14,6 +14,7 @@
 
 import os
 
+import gdaltest
 import pytest
 
 from osgeo import gdal
@@ -117,3 +118,71 @@ def test_vsicached_readdir_error():
 
     with gdal.quiet_errors():
         assert gdal.ReadDir("/vsicached?") is None
+
+
+@pytest.mark.parametrize("prefetch_in_filename", [True, False])
+def test_vsicached_prefetch(tmp_path, prefetch_in_filename):
+
+    data = b"".join(b"%07d\n" % i for i in range(100000))
+    src_filename = str(tmp_path / "test.txt")
+    with open(src_filename, "wb") as f:
+        f.write(data)
+
+    if prefetch_in_filename:
+        filename = "/vsicached?prefetch=yes&chunk_size=4KB&file=" + src_filename
+        options = {}
+    else:
+        filename = "/vsicached?chunk_size=4KB&file=" + src_filename
+        options = {"VSI_CACHE_PREFETCH": "YES"}
+
+    with gdal.config_options(options):
+        with gdal.VSIFile(filename, "rb") as f:
+            # Sequential reads
+            read_data = b""
+            while True:
+                chunk = f.read(1000)
+                read_data += chunk
+                if len(chunk) < 1000:
+                    break
+            assert read_data == data
+
+            # Random reads
+            for offset, size in [(123457, 5000), (12345, 20000), (700000, 100)]:
+                f.seek(offset)
+                assert f.read(size) == data[offset : offset + size]
+
+
+def test_vsicached_prefetch_reduces_base_reads(tmp_path):
+
+    data = b"".join(b"%07d\n" % i for i in range(100000))
+    src_filename = str(tmp_path / "test.txt")
+    with open(src_filename, "wb") as f:
+        f.write(data)
+
+    def count_base_reads(prefetch):
+        trace_filename = str(tmp_path / f"trace_{prefetch}.bin")
+        with gdal.config_option("CPL_VSIL_TRACE_FILE", trace_filename):
+            with gdal.VSIFile(
+                f"/vsicached?prefetch={prefetch}&chunk_size=4KB&file=/vsitrace/"
+                + src_filename,
+                "rb",
+            ) as f:
+                read_data = b""
+                while True:
+                    chunk = f.read(1000)
+                    read_data += chunk
+                    if len(chunk) < 1000:
+                        break
+                assert read_data == data
+        # Switch to another trace file, so that the first one is closed
+        with gdal.config_option(
+            "CPL_VSIL_TRACE_FILE", str(tmp_path / f"other_{prefetch}.bin")
+        ):
+            gdal.VSIStatL("/vsitrace/" + src_filename)
+
+        records = gdaltest.read_vsitrace_file(trace_filename)
+        return len([rec for rec in records if rec[0] == "READ"])
+
+    nreads_without_prefetch = count_base_reads("no")
+    nreads_with_prefetch = count_base_reads("yes")
+    assert nreads_with_prefetch * 2 < nreads_without_prefetch
@@ -633,3 +633,31 @@ def test_vsicrypt_6(testnonboundtoswig_setup):  # noqa
     assert fp is None
 
     gdal.Unlink("/vsimem/file.bin")
+
+
+###############################################################################
+# Test reads spanning several sectors, decrypted in parallel or not
+
+
+@pytest.mark.parametrize("mode", ["CBC", "CTR", "CBC_CTS"])
+@pytest.mark.parametrize("num_threads", [None, "4"])
+def test_vsicrypt_multi_sector_read(tmp_vsimem, mode, num_threads):
+
+    filename = f"/vsicrypt/key=DONT_USE_IN_PROD,mode={mode},sector_size=64,file={tmp_vsimem}/file.bin"
+    data = bytes([(i * 7 + i // 256) % 256 for i in range(500000)])
+
+    fp = gdal.VSIFOpenL(filename, "wb")
+    assert fp is not None
+    gdal.VSIFWriteL(data, 1, len(data), fp)
+    gdal.VSIFCloseL(fp)
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        fp = gdal.VSIFOpenL(filename, "rb")
+        assert fp is not None
+        try:
+            assert gdal.VSIFReadL(1, len(data) + 100, fp) == data
+            for offset, size in [(0, 128), (10, 200000), (64, 300000), (499990, 100)]:
+                gdal.VSIFSeekL(fp, offset, 0)
+                assert gdal.VSIFReadL(1, size, fp) == data[offset : offset + size]
+        finally:
+            gdal.VSIFCloseL(fp)
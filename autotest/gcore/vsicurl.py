@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -1678,3 +1679,158 @@ def test_vsicurl_GDAL_HTTP_MAX_TOTAL_CONNECTIONS(server):
         full_filename = f"/vsicurl/http://localhost:{server.port}/test.bin"
         statres = gdal.VSIStatL(full_filename)
         assert statres.size == 3
+
+
+###############################################################################
+# Test sequential read-ahead with concurrent range requests
+
+
+@pytest.mark.parametrize("streams", ["1", "3"])
+def test_vsicurl_read_ahead(server, streams):
+
+    gdal.VSICurlClearCache()
+
+    data = b"".join(b"%08d\n" % i for i in range(100000))
+    handler = webserver.FileHandler({"/test.bin": data})
+    with webserver.install_http_handler(handler), gdaltest.config_options(
+        {
+            "CPL_VSIL_CURL_READ_AHEAD_STREAMS": streams,
+            "CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE": "64K",
+        }
+    ):
+        f = gdal.VSIFOpenL(f"/vsicurl/http://localhost:{server.port}/test.bin", "rb")
+        assert f
+        try:
+            got = b""
+            while True:
+                chunk = gdal.VSIFReadL(1, 10000, f)
+                got += chunk
+                if len(chunk) < 10000:
+                    break
+            assert got == data
+
+            # Non-sequential reads
+            assert gdal.VSIFSeekL(f, 123456, 0) == 0
+            assert gdal.VSIFReadL(1, 100, f) == data[123456:123556]
+            assert gdal.VSIFSeekL(f, 12345, 0) == 0
+            assert gdal.VSIFReadL(1, 100000, f) == data[12345:112345]
+        finally:
+            gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test a forward seek beyond the read-ahead window
+
+
+def test_vsicurl_read_ahead_forward_seek(server):
+
+    gdal.VSICurlClearCache()
+
+    data = b"".join(b"%08d\n" % i for i in range(100000))
+    handler = webserver.FileHandler({"/test.bin": data})
+    with webserver.install_http_handler(handler), gdaltest.config_options(
+        {
+            "CPL_VSIL_CURL_READ_AHEAD_STREAMS": "1",
+            "CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE": "64K",
+        }
+    ):
+        f = gdal.VSIFOpenL(f"/vsicurl/http://localhost:{server.port}/test.bin", "rb")
+        assert f
+        try:
+            # Sequential reads to trigger read-ahead
+            for i in range(15):
+                assert gdal.VSIFReadL(1, 10000, f) == data[i * 10000 : (i + 1) * 10000]
+            assert gdal.VSIFSeekL(f, 409600, 0) == 0
+            assert gdal.VSIFReadL(1, 100000, f) == data[409600:509600]
+            assert gdal.VSIFReadL(1, 10000, f) == data[509600:519600]
+        finally:
+            gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test persistent disk cache of byte ranges
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    data = b"".join(b"%08d\n" % i for i in range(10000))
+    url = f"/vsicurl/http://localhost:{server.port}/disk_cache/test.bin"
+
+    def read_at_20000(handler):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f
+            try:
+                assert gdal.VSIFSeekL(f, 20000, 0) == 0
+                assert gdal.VSIFReadL(1, 100, f) == data[20000:20100]
+            finally:
+                gdal.VSIFCloseL(f)
+
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path / "cache"),
+            "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+        }
+    ):
+        gdal.NetworkStatsReset()
+
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/disk_cache/", 404)
+        handler.add(
+            "HEAD",
+            "/disk_cache/test.bin",
+            200,
+            {"Content-Length": str(len(data)), "ETag": '"etag1"'},
+        )
+        handler.add(
+            "GET",
+            "/disk_cache/test.bin",
+            206,
+            {"Content-Range": f"bytes 16384-32767/{len(data)}"},
+            data[16384:32768],
+            expected_headers={"Range": "bytes=16384-32767"},
+        )
+        read_at_20000(handler)
+
+        # Only the in-memory caches are cleared: the range is served from
+        # the disk cache
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/disk_cache/", 404)
+        handler.add(
+            "HEAD",
+            "/disk_cache/test.bin",
+            200,
+            {"Content-Length": str(len(data)), "ETag": '"etag1"'},
+        )
+        read_at_20000(handler)
+
+        stats = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+        assert stats["disk_cache"]["hits"]["count"] == 1
+        assert stats["disk_cache"]["hits"]["bytes"] == 16384
+
+        # A different ETag invalidates the cached ranges
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/disk_cache/", 404)
+        handler.add(
+            "HEAD",
+            "/disk_cache/test.bin",
+            200,
+            {"Content-Length": str(len(data)), "ETag": '"etag2"'},
+        )
+        handler.add(
+            "GET",
+            "/disk_cache/test.bin",
+            206,
+            {"Content-Range": f"bytes 16384-32767/{len(data)}"},
+            data[16384:32768],
+            expected_headers={"Range": "bytes=16384-32767"},
+        )
+        read_at_20000(handler)
+
+        gdal.NetworkStatsReset()
+
+    gdal.VSICurlClearCache()
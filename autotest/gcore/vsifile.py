@@ -887,6 +887,206 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test random access index and multithreaded decompression
+
+
+def _check_vsigzip_random_reads(filename, data):
+
+    f = gdal.VSIFOpenL(filename, "rb")
+    assert f
+    try:
+        for offset, size in (
+            (1500000, 1000),
+            (10, 100),
+            (999990, 20),
+            (len(data) - 5, 10),
+            (700000, 600000),
+            (0, len(data)),
+        ):
+            assert gdal.VSIFSeekL(f, offset, 0) == 0
+            assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+    finally:
+        gdal.VSIFCloseL(f)
+
+
+def test_vsigzip_index_and_multi_thread(tmp_path):
+
+    import gzip
+    import struct
+    import zlib
+
+    data = b"".join(b"%08d\n" % i for i in range(200000))
+
+    # Multi-member GZip file
+    gz_filename = str(tmp_path / "test.gz")
+    with open(gz_filename, "wb") as f:
+        f.write(gzip.compress(data[0:1000000]))
+        f.write(gzip.compress(data[1000000:]))
+
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_INDEX": "YES", "CPL_VSIL_GZIP_INDEX_SPAN": "64K"}
+    ):
+        assert gdal.VSIStatL("/vsigzip/" + gz_filename).size == len(data)
+        assert gdal.VSIStatL(gz_filename + ".gzidx") is not None
+
+        _check_vsigzip_random_reads("/vsigzip/" + gz_filename, data)
+        with gdaltest.config_option("GDAL_NUM_THREADS", "2"):
+            _check_vsigzip_random_reads("/vsigzip/" + gz_filename, data)
+
+    # Index that does not match the .gz file must be ignored
+    other_gz_filename = str(tmp_path / "other.gz")
+    with open(other_gz_filename, "wb") as f:
+        f.write(gzip.compress(data[0:1000000]))
+    gdal.CopyFile(gz_filename + ".gzidx", other_gz_filename + ".gzidx")
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_INDEX": "YES", "GDAL_NUM_THREADS": "2"}
+    ):
+        _check_vsigzip_random_reads(
+            "/vsigzip/" + other_gz_filename, data[0:1000000]
+        )
+
+    # Corrupted CRC32 in the trailer of the first member, with an index
+    # still considered as valid, must be detected by worker threads
+    bad_gz_filename = str(tmp_path / "bad.gz")
+    with open(gz_filename, "rb") as f:
+        gz_data = bytearray(f.read())
+    gz_data[len(gzip.compress(data[0:1000000])) - 8] ^= 0xFF
+    with open(bad_gz_filename, "wb") as f:
+        f.write(gz_data)
+    st = os.stat(gz_filename)
+    os.utime(bad_gz_filename, ns=(st.st_atime_ns, st.st_mtime_ns))
+    gdal.CopyFile(gz_filename + ".gzidx", bad_gz_filename + ".gzidx")
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_INDEX": "YES", "GDAL_NUM_THREADS": "2"}
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + bad_gz_filename, "rb")
+        assert f
+        try:
+            with gdal.quiet_errors():
+                assert gdal.VSIFReadL(1, len(data), f) != data
+        finally:
+            gdal.VSIFCloseL(f)
+
+    # BGZF file (without index)
+    bgzf_filename = str(tmp_path / "test.bgz")
+    with open(bgzf_filename, "wb") as f:
+        for i in list(range(0, len(data), 65280)) + [len(data)]:
+            block = data[i : i + 65280]
+            c = zlib.compressobj(6, zlib.DEFLATED, -15)
+            compressed = c.compress(block) + c.flush()
+            f.write(b"\x1f\x8b\x08\x04" + b"\x00" * 6 + struct.pack("<H", 6))
+            f.write(b"BC" + struct.pack("<HH", 2, len(compressed) + 25))
+            f.write(compressed)
+            f.write(struct.pack("<II", zlib.crc32(block), len(block)))
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "2"):
+        _check_vsigzip_random_reads("/vsigzip/" + bgzf_filename, data)
+        assert gdal.VSIStatL("/vsigzip/" + bgzf_filename).size == len(data)
+
+
+###############################################################################
+# Test CPL_VSIL_ARCHIVE_INDEX and CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR
+
+
+@pytest.mark.parametrize("ext", ["tar", "zip"])
+def test_vsifile_archive_index(tmp_path, ext):
+
+    import tarfile
+    import zipfile
+
+    archive_filename = str(tmp_path / ("test." + ext))
+    if ext == "tar":
+        prefix = "/vsitar/"
+        with tarfile.open(archive_filename, "w") as tar:
+            for i in range(20):
+                src = tmp_path / ("f%d.txt" % i)
+                src.write_bytes(b"content%d" % i)
+                tar.add(str(src), arcname="subdir/f%d.txt" % i)
+    else:
+        prefix = "/vsizip/"
+        with zipfile.ZipFile(archive_filename, "w") as z:
+            for i in range(20):
+                z.writestr("subdir/f%d.txt" % i, b"content%d" % i)
+
+    cache_dir = str(tmp_path / "cache")
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_ARCHIVE_INDEX": "YES",
+            "CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR": cache_dir,
+        }
+    ):
+        assert len(gdal.ReadDir(prefix + archive_filename + "/subdir")) == 20
+        with gdal.VSIFile(prefix + archive_filename + "/subdir/f7.txt", "rb") as f:
+            assert f.read() == b"content7"
+    assert gdal.VSIStatL(archive_filename + ".vsiidx") is not None
+    assert len(gdal.ReadDirRecursive(cache_dir)) == 2
+
+    # Archive with the same size and modification time as the indexed one,
+    # but whose content is not scanned: the listing comes from the index
+    other_filename = str(tmp_path / ("other." + ext))
+    with open(other_filename, "wb") as f:
+        f.write(b"\0" * os.stat(archive_filename).st_size)
+    st = os.stat(archive_filename)
+    os.utime(other_filename, (st.st_atime, st.st_mtime))
+    gdal.CopyFile(archive_filename + ".vsiidx", other_filename + ".vsiidx")
+    with gdaltest.config_option("CPL_VSIL_ARCHIVE_INDEX", "YES"):
+        assert len(gdal.ReadDir(prefix + other_filename + "/subdir")) == 20
+
+    # Index that does not match the archive must be ignored
+    os.utime(other_filename, (st.st_atime, st.st_mtime + 10))
+    with gdaltest.config_option("CPL_VSIL_ARCHIVE_INDEX", "YES"):
+        with gdal.quiet_errors():
+            assert gdal.ReadDir(prefix + other_filename + "/subdir") is None
+
+    # Check eviction
+    os.utime(archive_filename, (st.st_atime, st.st_mtime + 10))
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR": cache_dir,
+            "CPL_VSIL_ARCHIVE_INDEX_CACHE_MAX_SIZE": "100",
+        }
+    ):
+        assert len(gdal.ReadDir(prefix + archive_filename + "/subdir")) == 20
+    assert [f for f in gdal.ReadDirRecursive(cache_dir) if "." in f] == []
+
+
+###############################################################################
+# Test /vsitrace/ and CPL_VSIL_TRACE_FILE
+
+
+def test_vsifile_vsitrace(tmp_path):
+
+    data_filename = str(tmp_path / "data.bin")
+    with open(data_filename, "wb") as f:
+        f.write(b"0123456789" * 100)
+
+    trace_filename = str(tmp_path / "trace.bin")
+    with gdaltest.config_option("CPL_VSIL_TRACE_FILE", trace_filename):
+        assert gdal.VSIStatL("/vsitrace/" + data_filename).size == 1000
+        with gdal.VSIFile("/vsitrace/" + data_filename, "rb") as f:
+            assert f.read(10) == b"0123456789"
+            f.seek(500)
+            assert f.read(5) == b"01234"
+        assert gdal.VSIFOpenL("/vsitrace/" + str(tmp_path / "missing"), "rb") is None
+    # Switch to another trace file, so that the first one is closed
+    with gdaltest.config_option("CPL_VSIL_TRACE_FILE", str(tmp_path / "other.bin")):
+        gdal.VSIStatL("/vsitrace/" + data_filename)
+
+    records = gdaltest.read_vsitrace_file(trace_filename)
+
+    assert records[0] == ("STAT", 0, 0, data_filename)
+    assert records[1][0:3] == ("OPEN", records[1][1], 1)
+    assert records[1][3] == data_filename
+    handle = records[1][1]
+    assert handle != 0
+    assert ("READ", handle, 0, 10, 10) in records
+    assert ("SEEK", handle, 500) in records
+    assert ("READ", handle, 500, 5, 5) in records
+    assert ("CLOSE", handle) in records
+    assert records[-1] == ("OPEN", 0, 0, str(tmp_path / "missing"))
+
+
 ###############################################################################
 # Test vsisync()
 
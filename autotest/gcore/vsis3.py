@@ -3135,6 +3135,67 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test multipart upload with parts uploaded concurrently
+
+
+def test_vsis3_write_multipart_num_threads(aws_test_config, webserver_port):
+
+    gdal.VSICurlClearCache()
+
+    size = 1024 * 1024 * 2 + 1
+    big_buffer = b"a" * size
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file_num_threads.bin?uploads",
+        200,
+        {},
+        """<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>""",
+    )
+    for part_number, part_size in ((1, 1048576), (2, 1048576), (3, 1)):
+        handler.add(
+            "PUT",
+            (
+                "/s3_fake_bucket4/large_file_num_threads.bin"
+                f"?partNumber={part_number}&uploadId=my_id"
+            ),
+            200,
+            {"ETag": f'"etag{part_number}"', "Content-Length": "0"},
+            b"",
+            expected_headers={"Content-Length": str(part_size)},
+        )
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file_num_threads.bin?uploadId=my_id",
+        200,
+        {},
+        b"",
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    filename = "/vsis3/s3_fake_bucket4/large_file_num_threads.bin"
+    with webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenExL(filename, "wb", False, ["CHUNK_SIZE=1", "NUM_THREADS=2"])
+        assert f is not None
+        assert gdal.VSIFWriteL(big_buffer, 1, size, f) == size
+        gdal.ErrorReset()
+        assert gdal.VSIFCloseL(f) == 0
+        assert gdal.GetLastErrorMsg() == ""
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
@@ -4407,3 +4407,49 @@ def test_gpkg_copy_using_get_data_coverage_status(tmp_vsimem):
         == (gdal.GDAL_DATA_COVERAGE_STATUS_DATA | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY)
         and pct == 25.0
     )
+
+
+###############################################################################
+# Test encoding tiles with worker threads
+
+
+@pytest.mark.parametrize("tile_format", ["PNG", "JPEG", "PNG8"])
+def test_gpkg_raster_num_threads(tmp_vsimem, tile_format):
+
+    if tile_format == "JPEG" and gdaltest.jpeg_dr is None:
+        pytest.skip("JPEG driver missing")
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+
+    def create(filename, options):
+        out_ds = gdaltest.gpkg_dr.CreateCopy(
+            filename,
+            src_ds,
+            options=["TILE_FORMAT=" + tile_format, "BLOCKSIZE=16"] + options,
+        )
+        out_ds.BuildOverviews("AVERAGE", [2, 4])
+        out_ds = None
+
+    def get_tiles(filename, table):
+        ds = gdal.OpenEx(filename)
+        sql = f"SELECT zoom_level, tile_row, tile_column, tile_data FROM {table} ORDER BY zoom_level, tile_row, tile_column"
+        with ds.ExecuteSQL(sql) as lyr:
+            return [
+                (
+                    f["zoom_level"],
+                    f["tile_row"],
+                    f["tile_column"],
+                    f.GetFieldAsBinary("tile_data"),
+                )
+                for f in lyr
+            ]
+
+    ref_filename = str(tmp_vsimem / "ref.gpkg")
+    create(ref_filename, [])
+
+    filename = str(tmp_vsimem / "out.gpkg")
+    create(filename, ["NUM_THREADS=4"])
+
+    ref_tiles = get_tiles(ref_filename, "ref")
+    assert len(ref_tiles) > 3 * 4
+    assert get_tiles(filename, "out") == ref_tiles
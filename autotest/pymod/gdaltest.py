@@ -1747,6 +1747,63 @@ def is_file_open(filename):
     return False
 
 
+###############################################################################
+# read_vsitrace_file()
+# Parse a file written by /vsitrace/ (CPL_VSIL_TRACE_FILE) into a list of
+# tuples starting with the record type and the handle number:
+# ("OPEN", handle, success, filename), ("CLOSE", handle),
+# ("SEEK", handle, offset), ("READ", handle, offset, requested, read),
+# ("READ_MULTI_RANGE", handle, ret, [(offset, size), ...]),
+# ("STAT", handle, ret, filename), ("READDIR", handle, ret, filename)
+
+
+def read_vsitrace_file(filename):
+
+    import struct
+
+    with open(filename, "rb") as f:
+        trace = f.read()
+    assert trace[0:8] == b"GDALVTR1"
+    pos = 8
+    records = []
+    while pos < len(trace):
+        rec_type, _, handle, _, _ = struct.unpack("<BIIQQ", trace[pos : pos + 25])
+        pos += 25
+        if rec_type == 1:  # OPEN
+            success = trace[pos]
+            (size,) = struct.unpack("<I", trace[pos + 1 : pos + 5])
+            name = trace[pos + 5 : pos + 5 + size].decode()
+            pos += 5 + size
+            (size,) = struct.unpack("<I", trace[pos : pos + 4])
+            pos += 4 + size
+            records.append(("OPEN", handle, success, name))
+        elif rec_type == 2:  # CLOSE
+            records.append(("CLOSE", handle))
+        elif rec_type == 3:  # SEEK
+            records.append(("SEEK", handle) + struct.unpack("<Q", trace[pos : pos + 8]))
+            pos += 8
+        elif rec_type == 4:  # READ
+            records.append(
+                ("READ", handle) + struct.unpack("<QQQ", trace[pos : pos + 24])
+            )
+            pos += 24
+        elif rec_type == 5:  # READ_MULTI_RANGE
+            ret, count = struct.unpack("<iI", trace[pos : pos + 8])
+            pos += 8
+            ranges = []
+            for _ in range(count):
+                ranges.append(struct.unpack("<QQ", trace[pos : pos + 16]))
+                pos += 16
+            records.append(("READ_MULTI_RANGE", handle, ret, ranges))
+        else:
+            assert rec_type in (6, 7)  # STAT, READDIR
+            ret, size = struct.unpack("<iI", trace[pos : pos + 8])
+            name = trace[pos + 8 : pos + 8 + size].decode()
+            pos += 8 + size
+            records.append(("STAT" if rec_type == 6 else "READDIR", handle, ret, name))
+    return records
+
+
 ###############################################################################
 # built_against_curl()
 
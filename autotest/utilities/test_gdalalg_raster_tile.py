@@ -695,6 +695,47 @@ def test_gdalalg_raster_tile_multithread_progress(tmp_vsimem):
     assert len(gdal.ReadDirRecursive(tmp_vsimem)) == 107
 
 
+@pytest.mark.parametrize("metatile_size", [2, 4, 8])
+@pytest.mark.parametrize("resampling", ["nearest", "cubic"])
+def test_gdalalg_raster_tile_metatile(tmp_vsimem, metatile_size, resampling):
+
+    def get_checksums(output, num_threads, metatile_size):
+        alg = get_alg()
+        alg["input"] = "../gdrivers/data/small_world.tif"
+        alg["output"] = output
+        alg["min-zoom"] = 0
+        alg["max-zoom"] = 3
+        alg["resampling"] = resampling
+        alg["num-threads"] = num_threads
+        alg["metatile-size"] = metatile_size
+        assert alg.Run()
+
+        checksums = {}
+        for filename in gdal.ReadDirRecursive(output):
+            if filename.endswith(".png"):
+                with gdal.Open(output + "/" + filename) as ds:
+                    checksums[filename] = [
+                        ds.GetRasterBand(i + 1).Checksum()
+                        for i in range(ds.RasterCount)
+                    ]
+        return checksums
+
+    ref = get_checksums(tmp_vsimem / "ref", 1, 1)
+    got = get_checksums(tmp_vsimem / "out", 2, metatile_size)
+    assert len(got) == 85
+    assert got == ref
+
+
+def test_gdalalg_raster_tile_metatile_size_not_power_of_two(tmp_vsimem):
+
+    alg = get_alg()
+    alg["input"] = "../gdrivers/data/small_world.tif"
+    alg["output"] = tmp_vsimem
+    with pytest.raises(Exception, match="must be a power of two"):
+        alg["metatile-size"] = 3
+        alg.Run()
+
+
 def check_12_bit_jpeg():
 
     if "UInt16" not in gdal.GetDriverByName("JPEG").GetMetadataItem(
@@ -50,15 +50,58 @@ static bool HasZSTDCompression()
     return bHasZSTD;
 }
 
+/************************************************************************/
+/*                      GetTmpInMemoryMaxSize()                         */
+/************************************************************************/
+
+// Maximum cumulated size of the temporary files (reprojected dataset,
+// overviews) that may be kept in memory instead of being written on disk.
+// The default is deliberately small, as it applies to each COG being
+// created, and several may be created concurrently.
+static double GetTmpInMemoryMaxSize(const char *pszFilename)
+{
+    // Temporary files must be inspectable when they are not deleted, and
+    // there is nothing to gain if the output file is already in memory.
+    if (!CPLTestBool(CPLGetConfigOption("COG_DELETE_TEMP_FILES", "YES")) ||
+        STARTS_WITH(pszFilename, "/vsimem/"))
+    {
+        return 0;
+    }
+
+    const char *pszMaxSize =
+        CPLGetConfigOption("COG_TMP_IN_MEMORY_MAX_SIZE", "256MB");
+    GIntBig nMaxSize = 0;
+    bool bUnitSpecified = false;
+    if (CPLParseMemorySize(pszMaxSize, &nMaxSize, &bUnitSpecified) !=
+        CE_None)
+    {
+        return 0;
+    }
+    return static_cast<double>(nMaxSize);
+}
+
 /************************************************************************/
 /*                           GetTmpFilename()                           */
 /************************************************************************/
 
-static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
+static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt,
+                                double dfEstimatedSize,
+                                double &dfRemainingInMemorySize)
 {
+    CPLString osTmpFilename;
+    if (dfEstimatedSize <= dfRemainingInMemorySize)
+    {
+        dfRemainingInMemorySize -= dfEstimatedSize;
+        osTmpFilename =
+            VSIMemGenerateHiddenFilename(CPLGetFilename(pszFilename));
+        osTmpFilename += '.';
+        osTmpFilename += pszExt;
+        CPLDebug("COG", "Using in-memory %s", osTmpFilename.c_str());
+        return osTmpFilename;
+    }
+
     const bool bSupportsRandomWrite =
         VSISupportsRandomWrite(pszFilename, false);
-    CPLString osTmpFilename;
     if (!bSupportsRandomWrite ||
         CPLGetConfigOption("CPL_TMPDIR", nullptr) != nullptr)
     {
@@ -576,7 +619,8 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     const CPLString &osTargetSRS, const int nXSize, const int nYSize,
     const double dfMinX, const double dfMinY, const double dfMaxX,
     const double dfMaxY, const double dfRes, GDALProgressFunc pfnProgress,
-    void *pProgressData, double &dfCurPixels, double &dfTotalPixelsToProcess)
+    void *pProgressData, double &dfCurPixels, double &dfTotalPixelsToProcess,
+    double &dfRemainingTmpInMemorySize)
 {
     char **papszArg = nullptr;
     // We could have done a warped VRT, but overview building on it might be
@@ -674,7 +718,13 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     CPLDebug("COG", "Reprojecting source dataset: start");
     GDALWarpAppOptionsSetProgress(psOptions, GDALScaledProgress,
                                   pScaledProgress);
-    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp"));
+    // Uncompressed size, with a potential alpha band.
+    const double dfEstimatedSize =
+        double(nXSize) * nYSize * (nBands + 1) *
+        GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType());
+    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp",
+                                       dfEstimatedSize,
+                                       dfRemainingTmpInMemorySize));
     auto hSrcDS = GDALDataset::ToHandle(poSrcDS);
 
     std::unique_ptr<CPLConfigOptionSetter> poWarpThreadSetter;
@@ -704,6 +754,7 @@ struct GDALCOGCreator final
     std::unique_ptr<GDALDataset> m_poVRTWithOrWithoutStats{};
     CPLString m_osTmpOverviewFilename{};
     CPLString m_osTmpMskOverviewFilename{};
+    double m_dfRemainingTmpInMemorySize = 0;
 
     ~GDALCOGCreator();
 
@@ -764,6 +815,8 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         return nullptr;
     }
 
+    m_dfRemainingTmpInMemorySize = GetTmpInMemoryMaxSize(pszFilename);
+
     const CPLString osCompress = CSLFetchNameValueDef(
         papszOptions, "COMPRESS", gbHasLZW ? "LZW" : "NONE");
 
@@ -880,7 +933,8 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
                 pszFilename, poCurDS, papszOptions, osTargetResampling,
                 osTargetSRS, nTargetXSize, nTargetYSize, dfTargetMinX,
                 dfTargetMinY, dfTargetMaxX, dfTargetMaxY, dfRes, pfnProgress,
-                pProgressData, dfCurPixels, dfTotalPixelsToProcess);
+                pProgressData, dfCurPixels, dfTotalPixelsToProcess,
+                m_dfRemainingTmpInMemorySize);
             if (!m_poReprojectedDS)
                 return nullptr;
             poCurDS = m_poReprojectedDS.get();
@@ -1125,7 +1179,10 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateMskOvr)
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename =
+            GetTmpFilename(pszFilename, "msk.ovr.tmp",
+                           double(nXSize) * nYSize / 3,
+                           m_dfRemainingTmpInMemorySize);
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
         const char *pszResampling = CSLFetchNameValueDef(
             papszOptions, "OVERVIEW_RESAMPLING",
@@ -1155,7 +1212,11 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateOvr)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        m_osTmpOverviewFilename = GetTmpFilename(
+            pszFilename, "ovr.tmp",
+            double(nXSize) * nYSize * nBands / 3 *
+                GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType()),
+            m_dfRemainingTmpInMemorySize);
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
@@ -1468,6 +1468,9 @@ void GDALRegister_GTiff()
         "<OpenOptionList>"
         "   <Option name='NUM_THREADS' type='string' description='Number of "
         "worker threads for compression. Can be set to ALL_CPUS' default='1'/>"
+        "   <Option name='READ_AHEAD' type='int' description='Number of "
+        "tile/strip rows decoded in the background during sequential reads, "
+        "when NUM_THREADS is set' default='0' min='0'/>"
         "   <Option name='GEOTIFF_KEYS_FLAVOR' type='string-select' "
         "default='STANDARD' description='Which flavor of GeoTIFF keys must be "
         "used (for writing)'>"
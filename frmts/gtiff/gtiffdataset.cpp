@@ -29,6 +29,7 @@
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
+#include "gdal_persistent_block_cache.h"
 #include "ogr_proj_p.h"  // OSRGetProjTLSContext()
 #include "tif_jxl.h"
 #include "tifvsi.h"
@@ -235,6 +236,13 @@ std::tuple<CPLErr, bool> GTiffDataset::Finalize()
         m_poCompressQueue.reset();
     }
 
+    if (m_poParallelWriteQueue)
+    {
+        if (!WaitParallelWrites())
+            eErr = CE_Failure;
+        m_poParallelWriteQueue.reset();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      If there is still changed metadata, then presumably we want     */
     /*      to push it into PAM.                                            */
@@ -437,6 +445,9 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                GDALRasterIOExtraArg *psExtraArg)
 
 {
+    // Collect blocks decoded in the background by ScheduleReadAhead()
+    WaitReadAhead();
+
     // Try to pass the request to the most appropriate overview dataset.
     if (nBufXSize < nXSize && nBufYSize < nYSize)
     {
@@ -472,9 +483,16 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             return static_cast<CPLErr>(nErr);
     }
 
+    // Multi-threaded and multi-range reads bypass the block cache, and thus
+    // the persistent block cache.
+    const bool bUsePersistentBlockCache =
+        eRWFlag == GF_Read &&
+        GDALPersistentBlockCacheIsEnabledFor(m_pszFilename);
+
     bool bCanUseMultiThreadedRead = false;
     if (m_nDisableMultiThreadedRead == 0 && m_poThreadPool &&
-        eRWFlag == GF_Read && nBufXSize == nXSize && nBufYSize == nYSize &&
+        eRWFlag == GF_Read && !bUsePersistentBlockCache &&
+        nBufXSize == nXSize && nBufYSize == nYSize &&
         IsMultiThreadedReadCompatible())
     {
         const int nBlockX1 = nXOff / m_nBlockXSize;
@@ -497,7 +515,7 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     const auto eDataType = poFirstBand->GetRasterDataType();
 
     if (eAccess == GA_ReadOnly && eRWFlag == GF_Read &&
-        HasOptimizedReadMultiRange() &&
+        !bUsePersistentBlockCache && HasOptimizedReadMultiRange() &&
         !(bCanUseMultiThreadedRead &&
           VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF))->HasPRead()))
     {
@@ -725,6 +743,14 @@ void GTiffDataset::InitCreationOrOpenOptions(bool bUpdateMode,
 {
     InitCompressionThreads(bUpdateMode, papszOptions);
 
+    if (!bUpdateMode && m_poThreadPool)
+    {
+        m_nReadAheadDepth = std::max(
+            0, atoi(CSLFetchNameValueDef(
+                   papszOptions, "READ_AHEAD",
+                   CPLGetConfigOption("GTIFF_READ_AHEAD", "0"))));
+    }
+
     m_eGeoTIFFKeysFlavor = GetGTIFFKeysFlavor(papszOptions);
     m_eGeoTIFFVersion = GetGeoTIFFVersion(papszOptions);
 }
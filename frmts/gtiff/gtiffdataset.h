@@ -16,6 +16,7 @@
 
 #include "gdal_pam.h"
 
+#include <atomic>
 #include <mutex>
 #include <queue>
 
@@ -44,6 +45,7 @@ class GTiffJPEGOverviewBand;
 class GTiffJPEGOverviewDS;
 class GTiffRasterBand;
 class GTiffRGBABand;
+struct GTiffReadAheadState;
 
 typedef struct
 {
@@ -147,6 +149,10 @@ class GTiffDataset final : public GDALPamDataset
     CPLWorkerThreadPool *m_poThreadPool = nullptr;
     std::unique_ptr<CPLJobQueue> m_poCompressQueue{};
     std::mutex m_oCompressThreadPoolMutex{};
+    // Pending positional writes of striles (GTIFF_PARALLEL_WRITE=YES)
+    std::unique_ptr<CPLJobQueue> m_poParallelWriteQueue{};
+    std::atomic<bool> m_bParallelWriteError{false};
+    std::shared_ptr<GTiffReadAheadState> m_poReadAhead{};
 
     lru11::Cache<int, std::pair<vsi_l_offset, vsi_l_offset>>
         m_oCacheStrileToOffsetByteCount{1024};
@@ -185,6 +191,22 @@ class GTiffDataset final : public GDALPamDataset
     int m_nLastWrittenBlockId = -1;  // used for m_bStreamingOut
     int m_nRefBaseMapping = 0;
     int m_nDisableMultiThreadedRead = 0;
+    int m_nReadAheadDepth = 0;  // Number of block rows decoded in advance
+    int m_nReadAheadLastBlockXStart = -1;
+    int m_nReadAheadLastBlockXEnd = -1;
+    int m_nReadAheadLastBlockYEnd = -1;
+    int m_nReadAheadScheduledBlockYEnd = -1;
+    std::vector<int> m_anReadAheadLastBandMap{};
+
+    // Streaming of a compressed file (CreateCopy() only): the imagery is
+    // compressed a first time to compute the size of the striles, so that
+    // the directory can be written before them. Compressed striles are kept
+    // for the second pass within the limit of m_nStreamingMaxCachedSize.
+    std::vector<GPtrDiff_t> m_anStreamingStrileSize{};
+    std::vector<std::vector<GByte>> m_aabyStreamingStrile{};
+    size_t m_nStreamingCachedSize = 0;
+    size_t m_nStreamingMaxCachedSize = 0;
+    bool m_bStreamingSizingPass = false;
 
   public:
     static constexpr int DEFAULT_COLOR_TABLE_MULTIPLIER_257 = 257;
@@ -371,10 +393,27 @@ class GTiffDataset final : public GDALPamDataset
     static void ThreadCompressionFunc(void *pData);
     void WaitCompletionForJobIdx(int i);
     void WaitCompletionForBlock(int nBlockId);
-    void WriteRawStripOrTile(int nStripOrTile, GByte *pabyCompressedBuffer,
+    bool WriteRawStripOrTile(int nStripOrTile, GByte *pabyCompressedBuffer,
                              GPtrDiff_t nCompressedBufferSize);
+    bool SetupCompressionJob(GTiffCompressionJob &sJob, int nStripOrTile,
+                             const GByte *pabyData, GPtrDiff_t cc,
+                             int nHeight);
     bool SubmitCompressionJob(int nStripOrTile, GByte *pabyData, GPtrDiff_t cc,
                               int nHeight);
+    bool CompressStrile(int nStripOrTile, const GByte *pabyData,
+                        GPtrDiff_t cc, int nHeight,
+                        std::vector<GByte> &abyCompressed);
+    bool WriteStreamingStrile(int nStripOrTile, const GByte *pabyData,
+                              GPtrDiff_t cc, int nHeight);
+    bool WriteStreamingHeader();
+    CPLErr CopyImageryStreamingCompressed(GDALDataset *poSrcDS,
+                                          CSLConstList papszCopyOptions,
+                                          GDALProgressFunc pfnProgress,
+                                          void *pProgressData);
+    void InitParallelWrite();
+    bool SubmitParallelWrite(vsi_l_offset nOffset, const GByte *pabyData,
+                             size_t nSize);
+    bool WaitParallelWrites();
 
     int GuessJPEGQuality(bool &bOutHasQuantizationTable,
                          bool &bOutHasHuffmanTable);
@@ -431,6 +470,10 @@ class GTiffDataset final : public GDALPamDataset
                                      GDALProgressFunc pfnProgress,
                                      void *pProgressData);
 
+    GTiffDataset *GetRawCopySource(GDALDataset *poSrcDS);
+    bool CopyRawStrile(GTiffDataset *poSrcDS, int nStrile,
+                       std::vector<GByte> &abyBuffer);
+
     bool GetOverviewParameters(int &nCompression, uint16_t &nPlanarConfig,
                                uint16_t &nPredictor, uint16_t &nPhotometric,
                                int &nOvrJpegQuality, std::string &osNoData,
@@ -473,7 +516,14 @@ class GTiffDataset final : public GDALPamDataset
     CPLErr MultiThreadedRead(int nXOff, int nYOff, int nXSize, int nYSize,
                              void *pData, GDALDataType eBufType, int nBandCount,
                              const int *panBandMap, GSpacing nPixelSpace,
-                             GSpacing nLineSpace, GSpacing nBandSpace);
+                             GSpacing nLineSpace, GSpacing nBandSpace,
+                             GTiffReadAheadState *psReadAhead = nullptr);
+    void ScheduleReadAhead(int nBlockXStart, int nBlockXEnd, int nBlockYStart,
+                           int nBlockYEnd, int nBandCount,
+                           const int *panBandMap);
+    bool WaitReadAhead(int nBand = 0, int nBlockXOff = -1,
+                       int nBlockYOff = -1, void *pImage = nullptr,
+                       bool bDiscard = false);
 
     virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                              int nXSize, int nYSize, void *pData, int nBufXSize,
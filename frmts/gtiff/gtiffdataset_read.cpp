@@ -398,6 +398,35 @@ struct GTiffDecompressJob
     vsi_l_offset nSize = 0;
 };
 
+/************************************************************************/
+/*                        GTiffReadAheadState                           */
+/************************************************************************/
+
+// Blocks of the rows following a sequential read, decoded in the background
+// by ScheduleReadAhead() and collected by WaitReadAhead().
+// The jobs decode into abyData, which covers the whole window, and never
+// access the block cache themselves, so that the caller can go on processing
+// the previous rows while they run.
+struct GTiffReadAheadState
+{
+    GTiffDecompressContext sContext{};
+    std::vector<GTiffDecompressJob> asJobs{};
+    std::vector<GByte> abyData{};
+    std::vector<int> anBandMap{};
+    int nXOff = 0;
+    int nYOff = 0;
+    int nBlockXStart = 0;
+    int nBlockXEnd = 0;
+    int nBlockYStart = 0;
+    int nBlockYEnd = 0;
+    GSpacing nPixelSpace = 0;
+    GSpacing nLineSpace = 0;
+    GSpacing nBandSpace = 0;
+    // Must be the last member, so that pending jobs are completed before
+    // the above members are destroyed.
+    std::unique_ptr<CPLJobQueue> poQueue{};
+};
+
 /************************************************************************/
 /*                     ThreadDecompressionFunc()                        */
 /************************************************************************/
@@ -990,8 +1019,12 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                                        GDALDataType eBufType, int nBandCount,
                                        const int *panBandMap,
                                        GSpacing nPixelSpace,
-                                       GSpacing nLineSpace, GSpacing nBandSpace)
+                                       GSpacing nLineSpace, GSpacing nBandSpace,
+                                       GTiffReadAheadState *psReadAhead)
 {
+    if (!psReadAhead)
+        WaitReadAhead();
+
     auto poQueue = m_poThreadPool->CreateJobQueue();
     if (poQueue == nullptr)
     {
@@ -1008,7 +1041,11 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         m_nPlanarConfig == PLANARCONFIG_CONTIG ? 1 : nBandCount;
     const int nBlocks = nXBlocks * nYBlocks * nStrilePerBlock;
 
-    GTiffDecompressContext sContext;
+    // When psReadAhead is set, the jobs are submitted but not waited for,
+    // so the context and the jobs must outlive this call.
+    GTiffDecompressContext sLocalContext;
+    GTiffDecompressContext &sContext =
+        psReadAhead ? psReadAhead->sContext : sLocalContext;
     sContext.poHandle = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
     sContext.bHasPRead =
         sContext.poHandle->HasPRead()
@@ -1042,7 +1079,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     sContext.nPredictor = PREDICTOR_NONE;
     sContext.nBlocksPerRow = m_nBlocksPerRow;
 
-    if (m_bDirectIO)
+    if (m_bDirectIO || psReadAhead)
     {
         sContext.bSkipBlockCache = true;
     }
@@ -1081,10 +1118,16 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         }
     }
 
-    if (m_nPlanarConfig == PLANARCONFIG_CONTIG &&
-        (nBands == 3 || nBands == 4) && nBands == nBandCount &&
-        (sContext.eDT == GDT_Byte || sContext.eDT == GDT_Int16 ||
-         sContext.eDT == GDT_UInt16))
+    // GDALDeinterleave() is optimized for any number of bands >= 3, for
+    // 1, 2, 4 and 8-byte data types.
+    const int nDTSize = GDALGetDataTypeSizeBytes(sContext.eDT);
+    const bool bCanUseDeinterleaveOptim =
+        nBands >= 3 &&
+        (nDTSize == 1 || nDTSize == 2 || nDTSize == 4 || nDTSize == 8) &&
+        m_nBitsPerSample == nDTSize * 8;
+
+    if (m_nPlanarConfig == PLANARCONFIG_CONTIG && bCanUseDeinterleaveOptim &&
+        nBands == nBandCount)
     {
         if (sContext.bSkipBlockCache)
         {
@@ -1131,9 +1174,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         else
         {
             sContext.bCacheAllBands = true;
-            if ((nBands == 3 || nBands == 4) &&
-                (sContext.eDT == GDT_Byte || sContext.eDT == GDT_Int16 ||
-                 sContext.eDT == GDT_UInt16))
+            if (bCanUseDeinterleaveOptim)
             {
                 sContext.bUseDeinterleaveOptimBlockCache = true;
             }
@@ -1266,7 +1307,10 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
 
     // Create one job per tile/strip
     vsi_l_offset nFileSize = 0;
-    std::vector<GTiffDecompressJob> asJobs(nBlocks);
+    std::vector<GTiffDecompressJob> asLocalJobs;
+    std::vector<GTiffDecompressJob> &asJobs =
+        psReadAhead ? psReadAhead->asJobs : asLocalJobs;
+    asJobs.resize(nBlocks);
     std::vector<vsi_l_offset> anOffsets(nBlocks);
     std::vector<size_t> anSizes(nBlocks);
     int iJob = 0;
@@ -1389,6 +1433,16 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                         bAddToAdviseRead = false;
                 }
 
+                // Read-ahead requests are not split: blocks that do not fit
+                // in the AdviseRead() capacity are just read with PRead().
+                if (bAddToAdviseRead && psReadAhead &&
+                    nAdviseReadTotalBytesLimit > 0 &&
+                    asJobs[iJob].nSize >
+                        nAdviseReadTotalBytesLimit - nAdviseReadAccBytes)
+                {
+                    bAddToAdviseRead = false;
+                }
+
                 if (bAddToAdviseRead)
                 {
                     anOffsets[nAdviseReadRanges] = asJobs[iJob].nOffset;
@@ -1456,6 +1510,17 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                                           anSizes.data());
         }
 
+        if (psReadAhead)
+        {
+            // Completion is waited for in WaitReadAhead()
+            for (auto &sJob : asJobs)
+            {
+                poQueue->SubmitJob(ThreadDecompressionFunc, &sJob);
+            }
+            psReadAhead->poQueue = std::move(poQueue);
+            return CE_None;
+        }
+
         // We need to do that as threads will access the block cache
         TemporarilyDropReadWriteLock();
 
@@ -1473,7 +1538,277 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         sContext.oErrorAccumulator.ReplayErrors();
     }
 
-    return sContext.bSuccess ? CE_None : CE_Failure;
+    if (!sContext.bSuccess)
+        return CE_Failure;
+
+    if (m_nReadAheadDepth > 0)
+    {
+        ScheduleReadAhead(nBlockXStart, nBlockXEnd, nBlockYStart, nBlockYEnd,
+                          nBandCount, panBandMap);
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                         ScheduleReadAhead()                          */
+/************************************************************************/
+
+// Called after the blocks [nBlockXStart, nBlockXEnd] x [nBlockYStart,
+// nBlockYEnd] have been read. If this read follows the previous one
+// (same columns and bands, starting at or just after its last block row),
+// start decoding the next m_nReadAheadDepth block rows on the thread pool.
+// panBandMap == nullptr means all bands.
+void GTiffDataset::ScheduleReadAhead(int nBlockXStart, int nBlockXEnd,
+                                     int nBlockYStart, int nBlockYEnd,
+                                     int nBandCount, const int *panBandMap)
+{
+    if (m_nReadAheadDepth <= 0 || m_poThreadPool == nullptr ||
+        eAccess != GA_ReadOnly || m_nDisableMultiThreadedRead != 0 ||
+        !IsMultiThreadedReadCompatible())
+    {
+        return;
+    }
+
+    // Without PRead(), the background jobs would have to seek and read the
+    // file handle, which is shared with the mask and overview datasets, and
+    // used without lock by the regular (non multi-threaded) read paths.
+    if (!VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF))->HasPRead()
+#ifdef DEBUG
+        || !CPLTestBool(CPLGetConfigOption("GTIFF_ALLOW_PREAD", "YES"))
+#endif
+    )
+    {
+        return;
+    }
+
+    // In contiguous planar configuration, all bands of a block are decoded
+    // at once.
+    std::vector<int> anBandMap;
+    if (panBandMap && m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+    {
+        anBandMap.assign(panBandMap, panBandMap + nBandCount);
+    }
+    else
+    {
+        for (int i = 1; i <= nBands; ++i)
+            anBandMap.push_back(i);
+    }
+
+    const bool bSequential =
+        nBlockXStart == m_nReadAheadLastBlockXStart &&
+        nBlockXEnd == m_nReadAheadLastBlockXEnd &&
+        (nBlockYStart == m_nReadAheadLastBlockYEnd ||
+         nBlockYStart == m_nReadAheadLastBlockYEnd + 1) &&
+        anBandMap == m_anReadAheadLastBandMap;
+    m_nReadAheadLastBlockXStart = nBlockXStart;
+    m_nReadAheadLastBlockXEnd = nBlockXEnd;
+    m_nReadAheadLastBlockYEnd = nBlockYEnd;
+    if (!bSequential)
+    {
+        m_anReadAheadLastBandMap = std::move(anBandMap);
+        m_nReadAheadScheduledBlockYEnd = -1;
+        return;
+    }
+
+    WaitReadAhead();
+
+    // Do not decode again rows scheduled by a previous call
+    int nFirstBlockY =
+        std::max(nBlockYEnd, m_nReadAheadScheduledBlockYEnd) + 1;
+    int nLastBlockY =
+        std::min(nBlockYEnd + m_nReadAheadDepth, m_nBlocksPerColumn - 1);
+
+    // Skip rows that are already in the block cache
+    const auto IsRowCached = [this, &anBandMap, nBlockXStart,
+                              nBlockXEnd](int nBlockY)
+    {
+        for (const int nBand : anBandMap)
+        {
+            for (int x = nBlockXStart; x <= nBlockXEnd; ++x)
+            {
+                GDALRasterBlock *poBlock =
+                    GetRasterBand(nBand)->TryGetLockedBlockRef(x, nBlockY);
+                if (!poBlock)
+                    return false;
+                poBlock->DropLock();
+            }
+        }
+        return true;
+    };
+    while (nFirstBlockY <= nLastBlockY && IsRowCached(nFirstBlockY))
+        ++nFirstBlockY;
+
+    // Decoded blocks end up in the block cache: do not use more than a
+    // quarter of it.
+    const GDALDataType eDT = GetRasterBand(1)->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const int nXOff = nBlockXStart * m_nBlockXSize;
+    const int nXSize =
+        static_cast<int>(std::min<GIntBig>(
+            nRasterXSize, static_cast<GIntBig>(nBlockXEnd + 1) *
+                              m_nBlockXSize)) -
+        nXOff;
+    const int nReadAheadBandCount = static_cast<int>(anBandMap.size());
+    const GIntBig nBytesPerBlockRow = static_cast<GIntBig>(nXSize) *
+                                      m_nBlockYSize * nReadAheadBandCount *
+                                      nDTSize;
+    nLastBlockY = static_cast<int>(std::min<GIntBig>(
+        nLastBlockY,
+        nFirstBlockY - 1 + GDALGetCacheMax64() / 4 / nBytesPerBlockRow));
+    if (nFirstBlockY > nLastBlockY)
+        return;
+
+    const int nYOff = nFirstBlockY * m_nBlockYSize;
+    const int nYSize =
+        static_cast<int>(std::min<GIntBig>(
+            nRasterYSize, static_cast<GIntBig>(nLastBlockY + 1) *
+                              m_nBlockYSize)) -
+        nYOff;
+
+    auto poReadAhead = std::make_shared<GTiffReadAheadState>();
+    try
+    {
+        poReadAhead->abyData.resize(static_cast<size_t>(nXSize) * nYSize *
+                                    nReadAheadBandCount * nDTSize);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    poReadAhead->anBandMap = std::move(anBandMap);
+    poReadAhead->nXOff = nXOff;
+    poReadAhead->nYOff = nYOff;
+    poReadAhead->nBlockXStart = nBlockXStart;
+    poReadAhead->nBlockXEnd = nBlockXEnd;
+    poReadAhead->nBlockYStart = nFirstBlockY;
+    poReadAhead->nBlockYEnd = nLastBlockY;
+    if (m_nPlanarConfig == PLANARCONFIG_CONTIG)
+    {
+        // Pixel-interleaved, so that decoded strips/tiles are just copied
+        poReadAhead->nPixelSpace =
+            static_cast<GSpacing>(nReadAheadBandCount) * nDTSize;
+        poReadAhead->nLineSpace = poReadAhead->nPixelSpace * nXSize;
+        poReadAhead->nBandSpace = nDTSize;
+    }
+    else
+    {
+        poReadAhead->nPixelSpace = nDTSize;
+        poReadAhead->nLineSpace = poReadAhead->nPixelSpace * nXSize;
+        poReadAhead->nBandSpace = poReadAhead->nLineSpace * nYSize;
+    }
+
+    // Errors are not reported here, but when the blocks are actually read.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    if (MultiThreadedRead(nXOff, nYOff, nXSize, nYSize,
+                          poReadAhead->abyData.data(), eDT,
+                          nReadAheadBandCount, poReadAhead->anBandMap.data(),
+                          poReadAhead->nPixelSpace, poReadAhead->nLineSpace,
+                          poReadAhead->nBandSpace,
+                          poReadAhead.get()) == CE_None &&
+        poReadAhead->poQueue)
+    {
+        CPLDebugOnly("GTiff", "Read-ahead of block rows %d to %d",
+                     nFirstBlockY, nLastBlockY);
+        m_poReadAhead = std::move(poReadAhead);
+        m_nReadAheadScheduledBlockYEnd = nLastBlockY;
+    }
+}
+
+/************************************************************************/
+/*                           WaitReadAhead()                            */
+/************************************************************************/
+
+// Wait for the completion of the jobs started by ScheduleReadAhead(), and
+// move the decoded blocks into the block cache, except the ones that are
+// already there. If pImage is not null, the block (nBlockXOff, nBlockYOff)
+// of band nBand is instead written into it, and true is returned if it was
+// part of the read-ahead.
+bool GTiffDataset::WaitReadAhead(int nBand, int nBlockXOff, int nBlockYOff,
+                                 void *pImage, bool bDiscard)
+{
+    if (!m_poReadAhead)
+        return false;
+
+    const auto poReadAhead = std::move(m_poReadAhead);
+    poReadAhead->poQueue->WaitCompletion();
+    if (bDiscard || !poReadAhead->sContext.bSuccess)
+    {
+        // Errors will be emitted again if those blocks are read
+        m_nReadAheadScheduledBlockYEnd = -1;
+        return false;
+    }
+
+    const GDALDataType eDT = GetRasterBand(1)->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const size_t nBlockBytes =
+        static_cast<size_t>(m_nBlockXSize) * m_nBlockYSize * nDTSize;
+    bool bRet = false;
+    for (int iBand = 0;
+         iBand < static_cast<int>(poReadAhead->anBandMap.size()); ++iBand)
+    {
+        const int nThisBand = poReadAhead->anBandMap[iBand];
+        GDALRasterBand *poBand = GetRasterBand(nThisBand);
+        for (int y = poReadAhead->nBlockYStart; y <= poReadAhead->nBlockYEnd;
+             ++y)
+        {
+            for (int x = poReadAhead->nBlockXStart;
+                 x <= poReadAhead->nBlockXEnd; ++x)
+            {
+                GDALRasterBlock *poBlock = nullptr;
+                GByte *pabyDst;
+                if (pImage && nThisBand == nBand && x == nBlockXOff &&
+                    y == nBlockYOff)
+                {
+                    pabyDst = static_cast<GByte *>(pImage);
+                    bRet = true;
+                }
+                else
+                {
+                    poBlock = poBand->TryGetLockedBlockRef(x, y);
+                    if (poBlock)
+                    {
+                        poBlock->DropLock();
+                        continue;
+                    }
+                    poBlock = poBand->GetLockedBlockRef(x, y, TRUE);
+                    if (poBlock == nullptr)
+                        continue;
+                    pabyDst = static_cast<GByte *>(poBlock->GetDataRef());
+                }
+
+                const int nXOffInBlock = x * m_nBlockXSize;
+                const int nYOffInBlock = y * m_nBlockYSize;
+                const int nValidXSize =
+                    std::min(m_nBlockXSize, nRasterXSize - nXOffInBlock);
+                const int nValidYSize =
+                    std::min(m_nBlockYSize, nRasterYSize - nYOffInBlock);
+                if (nValidXSize < m_nBlockXSize || nValidYSize < m_nBlockYSize)
+                    memset(pabyDst, 0, nBlockBytes);
+                const GByte *pabySrc =
+                    poReadAhead->abyData.data() +
+                    iBand * poReadAhead->nBandSpace +
+                    (nYOffInBlock - poReadAhead->nYOff) *
+                        poReadAhead->nLineSpace +
+                    (nXOffInBlock - poReadAhead->nXOff) *
+                        poReadAhead->nPixelSpace;
+                for (int j = 0; j < nValidYSize; ++j)
+                {
+                    GDALCopyWords64(
+                        pabySrc + j * poReadAhead->nLineSpace, eDT,
+                        static_cast<int>(poReadAhead->nPixelSpace),
+                        pabyDst + static_cast<size_t>(j) * m_nBlockXSize *
+                                      nDTSize,
+                        eDT, nDTSize, nValidXSize);
+                }
+
+                if (poBlock)
+                    poBlock->DropLock();
+            }
+        }
+    }
+
+    return bRet;
 }
 
 /************************************************************************/
@@ -745,8 +745,13 @@ bool GTiffDataset::WriteEncodedTile(uint32_t tile, GByte *pabyData,
                         tile, m_nLastWrittenBlockId + 1);
             return false;
         }
-        if (static_cast<GPtrDiff_t>(VSIFWriteL(pabyData, 1, cc, m_fpToWrite)) !=
-            cc)
+        if (m_nCompression != COMPRESSION_NONE)
+        {
+            if (!WriteStreamingStrile(tile, pabyData, cc, m_nBlockYSize))
+                return false;
+        }
+        else if (static_cast<GPtrDiff_t>(
+                     VSIFWriteL(pabyData, 1, cc, m_fpToWrite)) != cc)
         {
             ReportError(CE_Failure, CPLE_FileIO,
                         "Could not write " CPL_FRMT_GUIB " bytes",
@@ -864,8 +869,13 @@ bool GTiffDataset::WriteEncodedStrip(uint32_t strip, GByte *pabyData,
                         strip, m_nLastWrittenBlockId + 1);
             return false;
         }
-        if (static_cast<GPtrDiff_t>(VSIFWriteL(pabyData, 1, cc, m_fpToWrite)) !=
-            cc)
+        if (m_nCompression != COMPRESSION_NONE)
+        {
+            if (!WriteStreamingStrile(strip, pabyData, cc, nStripHeight))
+                return false;
+        }
+        else if (static_cast<GPtrDiff_t>(
+                     VSIFWriteL(pabyData, 1, cc, m_fpToWrite)) != cc)
         {
             ReportError(CE_Failure, CPLE_FileIO,
                         "Could not write " CPL_FRMT_GUIB " bytes",
@@ -1055,7 +1065,7 @@ void GTiffDataset::ThreadCompressionFunc(void *pData)
 /*                        WriteRawStripOrTile()                         */
 /************************************************************************/
 
-void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
+bool GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
                                        GByte *pabyCompressedBuffer,
                                        GPtrDiff_t nCompressedBufferSize)
 {
@@ -1063,6 +1073,7 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
     CPLDebug("GTIFF", "Writing raw strip/tile %d, size " CPL_FRMT_GUIB,
              nStripOrTile, static_cast<GUIntBig>(nCompressedBufferSize));
 #endif
+    bool bOK = true;
     toff_t *panOffsets = nullptr;
     toff_t *panByteCounts = nullptr;
     bool bWriteAtEnd = true;
@@ -1074,6 +1085,11 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
                      &panOffsets) &&
         panOffsets != nullptr && panOffsets[nStripOrTile] != 0)
     {
+        // The strile might be rewritten in place: make sure that a pending
+        // positional write of its previous content is done.
+        if (!WaitParallelWrites())
+            m_bWriteError = true;
+
         // Forces TIFFAppendStrip() to consider if the location of the
         // tile/strip can be reused or if the strile should be written at end of
         // file.
@@ -1179,9 +1195,22 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
             uint32_t nSize = static_cast<uint32_t>(nCompressedBufferSize);
             CPL_LSBPTR32(&nSize);
             if (!VSI_TIFFWrite(m_hTIFF, &nSize, sizeof(nSize)))
-                m_bWriteError = true;
+                bOK = false;
         }
     }
+
+    // With GTIFF_PARALLEL_WRITE=YES, libtiff only reserves room for the data
+    // and registers its location, and the actual write is done by a worker
+    // thread.
+    const auto poMainDS = m_poBaseDS ? m_poBaseDS : this;
+    thandle_t th = TIFFClientdata(m_hTIFF);
+    const bool bParallelWrite = poMainDS->m_poParallelWriteQueue != nullptr;
+    if (bParallelWrite)
+    {
+        VSI_TIFFSetDeferredWrite(th, pabyCompressedBuffer,
+                                 static_cast<size_t>(nCompressedBufferSize));
+    }
+
     tmsize_t written;
     if (TIFFIsTiled(m_hTIFF))
         written = TIFFWriteRawTile(m_hTIFF, nStripOrTile, pabyCompressedBuffer,
@@ -1190,7 +1219,20 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
         written = TIFFWriteRawStrip(m_hTIFF, nStripOrTile, pabyCompressedBuffer,
                                     nCompressedBufferSize);
     if (written != nCompressedBufferSize)
-        m_bWriteError = true;
+        bOK = false;
+
+    if (bParallelWrite)
+    {
+        vsi_l_offset nOffset = 0;
+        if (VSI_TIFFGetDeferredWriteOffset(th, &nOffset) &&
+            written == nCompressedBufferSize &&
+            !poMainDS->SubmitParallelWrite(
+                nOffset, pabyCompressedBuffer,
+                static_cast<size_t>(nCompressedBufferSize)))
+        {
+            bOK = false;
+        }
+    }
     if (bWriteTrailer &&
         static_cast<GUIntBig>(nCompressedBufferSize) <= 0xFFFFFFFFU)
     {
@@ -1201,8 +1243,12 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
         else
             memcpy(abyLastBytes, pabyCompressedBuffer, nCompressedBufferSize);
         if (!VSI_TIFFWrite(m_hTIFF, abyLastBytes, 4))
-            m_bWriteError = true;
+            bOK = false;
     }
+
+    if (!bOK)
+        m_bWriteError = true;
+    return bOK;
 }
 
 /************************************************************************/
@@ -1296,6 +1342,67 @@ void GTiffDataset::WaitCompletionForBlock(int nBlockId)
             }
         }
     }
+
+    // If the block has already been written, its content might still be
+    // in the process of being written by a worker thread.
+    const auto poMainDS = m_poBaseDS ? m_poBaseDS : this;
+    if (poMainDS->m_poParallelWriteQueue &&
+        TIFFGetStrileOffset(m_hTIFF, nBlockId) != 0)
+    {
+        if (!WaitParallelWrites())
+            m_bWriteError = true;
+    }
+}
+
+/************************************************************************/
+/*                        SetupCompressionJob()                         */
+/************************************************************************/
+
+bool GTiffDataset::SetupCompressionJob(GTiffCompressionJob &sJob,
+                                       int nStripOrTile, const GByte *pabyData,
+                                       GPtrDiff_t cc, int nHeight)
+{
+    sJob.poDS = this;
+    sJob.bTIFFIsBigEndian = CPL_TO_BOOL(TIFFIsBigEndian(m_hTIFF));
+    GByte *pabyBuffer =
+        static_cast<GByte *>(VSI_REALLOC_VERBOSE(sJob.pabyBuffer, cc));
+    if (!pabyBuffer)
+        return false;
+    sJob.pabyBuffer = pabyBuffer;
+    memcpy(sJob.pabyBuffer, pabyData, cc);
+    sJob.nBufferSize = cc;
+    sJob.nHeight = nHeight;
+    sJob.nStripOrTile = nStripOrTile;
+    sJob.nPredictor = PREDICTOR_NONE;
+    if (GTIFFSupportsPredictor(m_nCompression))
+    {
+        TIFFGetField(m_hTIFF, TIFFTAG_PREDICTOR, &sJob.nPredictor);
+    }
+
+    sJob.pExtraSamples = nullptr;
+    sJob.nExtraSampleCount = 0;
+    TIFFGetField(m_hTIFF, TIFFTAG_EXTRASAMPLES, &sJob.nExtraSampleCount,
+                 &sJob.pExtraSamples);
+    return true;
+}
+
+/************************************************************************/
+/*                    GTiffSupportsCompressionJobs()                    */
+/************************************************************************/
+
+// Whether a strile can be compressed independently of the main TIFF handle
+// by ThreadCompressionFunc().
+static bool GTiffSupportsCompressionJobs(int nCompression)
+{
+    return nCompression == COMPRESSION_ADOBE_DEFLATE ||
+           nCompression == COMPRESSION_LZW ||
+           nCompression == COMPRESSION_PACKBITS ||
+           nCompression == COMPRESSION_LZMA ||
+           nCompression == COMPRESSION_ZSTD ||
+           nCompression == COMPRESSION_LERC ||
+           nCompression == COMPRESSION_JXL ||
+           nCompression == COMPRESSION_JXL_DNG_1_7 ||
+           nCompression == COMPRESSION_WEBP || nCompression == COMPRESSION_JPEG;
 }
 
 /************************************************************************/
@@ -1326,52 +1433,26 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
         {
             WaitCompletionForJobIdx(oQueue.front());
         }
-    }
 
-    const auto SetupJob =
-        [this, pabyData, cc, nHeight, nStripOrTile](GTiffCompressionJob &sJob)
-    {
-        sJob.poDS = this;
-        sJob.bTIFFIsBigEndian = CPL_TO_BOOL(TIFFIsBigEndian(m_hTIFF));
-        GByte *pabyBuffer =
-            static_cast<GByte *>(VSI_REALLOC_VERBOSE(sJob.pabyBuffer, cc));
-        if (!pabyBuffer)
-            return false;
-        sJob.pabyBuffer = pabyBuffer;
-        memcpy(sJob.pabyBuffer, pabyData, cc);
-        sJob.nBufferSize = cc;
-        sJob.nHeight = nHeight;
-        sJob.nStripOrTile = nStripOrTile;
-        sJob.nPredictor = PREDICTOR_NONE;
-        if (GTIFFSupportsPredictor(m_nCompression))
+        // Uncompressed data in the byte order of the file can be written
+        // as it is, which enables positional writes by worker threads.
+        auto poMainDS = m_poBaseDS ? m_poBaseDS : this;
+        if (poMainDS->m_poParallelWriteQueue && !TIFFIsByteSwapped(m_hTIFF) &&
+            (m_nBitsPerSample % 8) == 0)
         {
-            TIFFGetField(m_hTIFF, TIFFTAG_PREDICTOR, &sJob.nPredictor);
+            return WriteRawStripOrTile(nStripOrTile, pabyData, cc);
         }
+    }
 
-        sJob.pExtraSamples = nullptr;
-        sJob.nExtraSampleCount = 0;
-        TIFFGetField(m_hTIFF, TIFFTAG_EXTRASAMPLES, &sJob.nExtraSampleCount,
-                     &sJob.pExtraSamples);
-        return true;
-    };
-
-    if (poQueue == nullptr || !(m_nCompression == COMPRESSION_ADOBE_DEFLATE ||
-                                m_nCompression == COMPRESSION_LZW ||
-                                m_nCompression == COMPRESSION_PACKBITS ||
-                                m_nCompression == COMPRESSION_LZMA ||
-                                m_nCompression == COMPRESSION_ZSTD ||
-                                m_nCompression == COMPRESSION_LERC ||
-                                m_nCompression == COMPRESSION_JXL ||
-                                m_nCompression == COMPRESSION_JXL_DNG_1_7 ||
-                                m_nCompression == COMPRESSION_WEBP ||
-                                m_nCompression == COMPRESSION_JPEG))
+    if (poQueue == nullptr || !GTiffSupportsCompressionJobs(m_nCompression))
     {
         if (m_bBlockOrderRowMajor || m_bLeaderSizeAsUInt4 ||
             m_bTrailerRepeatedLast4BytesRepeated)
         {
             GTiffCompressionJob sJob;
             memset(&sJob, 0, sizeof(sJob));
-            if (SetupJob(sJob))
+            if (SetupCompressionJob(sJob, nStripOrTile, pabyData, cc,
+                                    nHeight))
             {
                 sJob.pszTmpFilename =
                     CPLStrdup(VSIMemGenerateHiddenFilename("temp.tif"));
@@ -1422,7 +1503,8 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
     CPLAssert(nNextCompressionJobAvail >= 0);
 
     GTiffCompressionJob *psJob = &asJobs[nNextCompressionJobAvail];
-    bool bOK = SetupJob(*psJob);
+    bool bOK =
+        SetupCompressionJob(*psJob, nStripOrTile, pabyData, cc, nHeight);
     if (bOK)
     {
         poQueue->SubmitJob(ThreadCompressionFunc, psJob);
@@ -1432,6 +1514,76 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
     return bOK;
 }
 
+/************************************************************************/
+/*                         InitParallelWrite()                          */
+/************************************************************************/
+
+// Enables writing striles with VSIVirtualHandle::PWrite() from worker
+// threads. Only used for newly created files, as in update mode we could
+// interfere with reads of existing data.
+void GTiffDataset::InitParallelWrite()
+{
+    if (m_poCompressQueue && !m_bStreamingOut && m_fpL &&
+        m_fpL->HasPWrite() &&
+        CPLTestBool(CPLGetConfigOption("GTIFF_PARALLEL_WRITE", "NO")))
+    {
+        CPLDebug("GTiff", "Using parallel positional writes of striles");
+        m_poParallelWriteQueue = m_poThreadPool->CreateJobQueue();
+    }
+}
+
+/************************************************************************/
+/*                        SubmitParallelWrite()                         */
+/************************************************************************/
+
+bool GTiffDataset::SubmitParallelWrite(vsi_l_offset nOffset,
+                                       const GByte *pabyData, size_t nSize)
+{
+    CPLAssert(m_poParallelWriteQueue);
+
+    // Limit the amount of data waiting to be written
+    m_poParallelWriteQueue->WaitCompletion(
+        2 * static_cast<int>(m_asCompressionJobs.size()));
+
+    GByte *pabyCopy = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nSize));
+    if (!pabyCopy)
+        return false;
+    memcpy(pabyCopy, pabyData, nSize);
+
+    VSILFILE *fpL = m_fpL;
+    if (!m_poParallelWriteQueue->SubmitJob(
+            [this, fpL, pabyCopy, nSize, nOffset]()
+            {
+                if (fpL->PWrite(pabyCopy, nSize, nOffset) != nSize)
+                    m_bParallelWriteError = true;
+                VSIFree(pabyCopy);
+            }))
+    {
+        VSIFree(pabyCopy);
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         WaitParallelWrites()                         */
+/************************************************************************/
+
+bool GTiffDataset::WaitParallelWrites()
+{
+    auto poMainDS = m_poBaseDS ? m_poBaseDS : this;
+    if (!poMainDS->m_poParallelWriteQueue)
+        return true;
+    poMainDS->m_poParallelWriteQueue->WaitCompletion();
+    if (poMainDS->m_bParallelWriteError.exchange(false))
+    {
+        ReportError(CE_Failure, CPLE_FileIO,
+                    "An error occurred while writing striles");
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                          DiscardLsb()                                */
 /************************************************************************/
@@ -2063,6 +2215,283 @@ static void GTiffFillStreamableOffsetAndCount(TIFF *hTIFF, int nSize)
     }
 }
 
+/************************************************************************/
+/*                           CompressStrile()                           */
+/************************************************************************/
+
+// Compresses a strile in the calling thread, without writing it.
+bool GTiffDataset::CompressStrile(int nStripOrTile, const GByte *pabyData,
+                                  GPtrDiff_t cc, int nHeight,
+                                  std::vector<GByte> &abyCompressed)
+{
+    GTiffCompressionJob sJob;
+    memset(&sJob, 0, sizeof(sJob));
+    bool bRet = false;
+    if (SetupCompressionJob(sJob, nStripOrTile, pabyData, cc, nHeight))
+    {
+        sJob.pszTmpFilename =
+            CPLStrdup(VSIMemGenerateHiddenFilename("temp.tif"));
+
+        ThreadCompressionFunc(&sJob);
+
+        if (sJob.nCompressedBufferSize)
+        {
+            try
+            {
+                abyCompressed.assign(sJob.pabyCompressedBuffer,
+                                     sJob.pabyCompressedBuffer +
+                                         sJob.nCompressedBufferSize);
+                bRet = true;
+            }
+            catch (const std::exception &)
+            {
+                ReportError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+            }
+        }
+
+        VSIUnlink(sJob.pszTmpFilename);
+        CPLFree(sJob.pszTmpFilename);
+    }
+    CPLFree(sJob.pabyBuffer);
+    return bRet;
+}
+
+/************************************************************************/
+/*                        WriteStreamingStrile()                        */
+/************************************************************************/
+
+// Handles a strile of a streamed compressed file. During the sizing pass,
+// only its compressed size is recorded. During the second pass, it is
+// written to the output.
+bool GTiffDataset::WriteStreamingStrile(int nStripOrTile,
+                                        const GByte *pabyData, GPtrDiff_t cc,
+                                        int nHeight)
+{
+    if (nStripOrTile < 0 ||
+        static_cast<size_t>(nStripOrTile) >= m_anStreamingStrileSize.size())
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "Streaming of compressed data only supported with "
+                    "CreateCopy()");
+        return false;
+    }
+
+    std::vector<GByte> abyCompressed;
+    if (m_bStreamingSizingPass)
+    {
+        if (!CompressStrile(nStripOrTile, pabyData, cc, nHeight,
+                            abyCompressed))
+            return false;
+        m_anStreamingStrileSize[nStripOrTile] =
+            static_cast<GPtrDiff_t>(abyCompressed.size());
+        if (m_nStreamingCachedSize + abyCompressed.size() <=
+            m_nStreamingMaxCachedSize)
+        {
+            m_nStreamingCachedSize += abyCompressed.size();
+            m_aabyStreamingStrile[nStripOrTile] = std::move(abyCompressed);
+        }
+        return true;
+    }
+
+    if (!m_aabyStreamingStrile[nStripOrTile].empty())
+    {
+        abyCompressed = std::move(m_aabyStreamingStrile[nStripOrTile]);
+        m_aabyStreamingStrile[nStripOrTile].clear();
+    }
+    else if (!CompressStrile(nStripOrTile, pabyData, cc, nHeight,
+                             abyCompressed))
+    {
+        return false;
+    }
+
+    // The directory has already been written with the sizes of the first
+    // pass.
+    if (static_cast<GPtrDiff_t>(abyCompressed.size()) !=
+        m_anStreamingStrileSize[nStripOrTile])
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Size of compressed strile %d differs from the one "
+                    "computed during the first pass",
+                    nStripOrTile);
+        return false;
+    }
+
+    if (VSIFWriteL(abyCompressed.data(), 1, abyCompressed.size(),
+                   m_fpToWrite) != abyCompressed.size())
+    {
+        ReportError(CE_Failure, CPLE_FileIO,
+                    "Could not write " CPL_FRMT_GUIB " bytes",
+                    static_cast<GUIntBig>(abyCompressed.size()));
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        WriteStreamingHeader()                        */
+/************************************************************************/
+
+// Patches the strile offsets and byte counts of a streamed compressed file
+// with the sizes computed during the sizing pass, and writes the header and
+// directory to the output.
+bool GTiffDataset::WriteStreamingHeader()
+{
+    const bool bIsTiled = CPL_TO_BOOL(TIFFIsTiled(m_hTIFF));
+    toff_t *panOffsets = nullptr;
+    toff_t *panByteCounts = nullptr;
+    if (!TIFFGetField(m_hTIFF,
+                      bIsTiled ? TIFFTAG_TILEOFFSETS : TIFFTAG_STRIPOFFSETS,
+                      &panOffsets) ||
+        !TIFFGetField(m_hTIFF,
+                      bIsTiled ? TIFFTAG_TILEBYTECOUNTS
+                               : TIFFTAG_STRIPBYTECOUNTS,
+                      &panByteCounts) ||
+        panOffsets == nullptr || panByteCounts == nullptr)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Cannot fetch strile offsets and byte counts");
+        return false;
+    }
+
+    VSI_TIFFFlushBufferedWrite(TIFFClientdata(m_hTIFF));
+    if (VSIFSeekL(m_fpL, 0, SEEK_END) != 0)
+    {
+        ReportError(CE_Failure, CPLE_FileIO, "Could not seek");
+        return false;
+    }
+    const vsi_l_offset nHeaderSize = VSIFTellL(m_fpL);
+
+    toff_t nOffset = nHeaderSize;
+    for (size_t i = 0; i < m_anStreamingStrileSize.size(); ++i)
+    {
+        panOffsets[i] = nOffset;
+        panByteCounts[i] = m_anStreamingStrileSize[i];
+        nOffset += m_anStreamingStrileSize[i];
+    }
+    if (!TIFFIsBigTIFF(m_hTIFF) && nOffset > UINT32_MAX)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Maximum TIFF file size exceeded. Use BIGTIFF=YES "
+                    "creation option.");
+        return false;
+    }
+
+    // Compressed striles may be larger than uncompressed ones, but libtiff
+    // chooses the type of the offset and byte count entries from the
+    // uncompressed strile size and the compression method, not from their
+    // values. As the arrays keep the same number of values, the directory
+    // is rewritten in place. libtiff errors out if a byte count does not fit
+    // in that type, and a moved directory is detected below.
+    if (!TIFFCheckpointDirectory(m_hTIFF))
+        return false;
+    VSI_TIFFFlushBufferedWrite(TIFFClientdata(m_hTIFF));
+    if (VSIFSeekL(m_fpL, 0, SEEK_END) != 0 ||
+        VSIFTellL(m_fpL) != nHeaderSize)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Directory unexpectedly moved while writing header of "
+                    "streamed file");
+        return false;
+    }
+
+    std::vector<GByte> abyHeader;
+    try
+    {
+        abyHeader.resize(static_cast<size_t>(nHeaderSize));
+    }
+    catch (const std::exception &)
+    {
+        ReportError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+    if (VSIFSeekL(m_fpL, 0, SEEK_SET) != 0 ||
+        VSIFReadL(abyHeader.data(), 1, abyHeader.size(), m_fpL) !=
+            abyHeader.size() ||
+        VSIFWriteL(abyHeader.data(), 1, abyHeader.size(), m_fpToWrite) !=
+            abyHeader.size())
+    {
+        ReportError(CE_Failure, CPLE_FileIO, "Could not write %d bytes",
+                    static_cast<int>(abyHeader.size()));
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   CopyImageryStreamingCompressed()                   */
+/************************************************************************/
+
+// Copies the imagery of poSrcDS into a streamed compressed file, with two
+// passes over the source: the first one to compute the size of the
+// compressed striles, so that the directory can be emitted before them,
+// and the second one to write them.
+CPLErr GTiffDataset::CopyImageryStreamingCompressed(
+    GDALDataset *poSrcDS, CSLConstList papszCopyOptions,
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nStriles =
+        m_nBlocksPerBand *
+        (m_nPlanarConfig == PLANARCONFIG_SEPARATE ? nBands : 1);
+    try
+    {
+        m_anStreamingStrileSize.resize(nStriles);
+        m_aabyStreamingStrile.resize(nStriles);
+    }
+    catch (const std::exception &)
+    {
+        ReportError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return CE_Failure;
+    }
+    // Use a fraction of the block cache size to keep compressed striles
+    // between the two passes.
+    m_nStreamingMaxCachedSize = static_cast<size_t>(
+        std::min<GIntBig>(GDALGetCacheMax64() / 2,
+                          std::numeric_limits<int>::max()));
+    m_nStreamingCachedSize = 0;
+
+    m_bStreamingSizingPass = true;
+    m_nLastWrittenBlockId = -1;
+    void *pScaledData =
+        GDALCreateScaledProgress(0.0, 0.5, pfnProgress, pProgressData);
+    CPLErr eErr = GDALDatasetCopyWholeRaster(
+        GDALDataset::ToHandle(poSrcDS), GDALDataset::ToHandle(this),
+        papszCopyOptions, GDALScaledProgress, pScaledData);
+    GDALDestroyScaledProgress(pScaledData);
+    // Make sure that the last dirty blocks are processed in this pass
+    if (eErr == CE_None)
+        eErr = FlushCacheInternal(/* bAtClosing = */ false,
+                                  /* bFlushDirectory = */ false);
+    m_bStreamingSizingPass = false;
+
+    if (eErr == CE_None && m_nLastWrittenBlockId != nStriles - 1)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Not all striles have been written during first pass");
+        eErr = CE_Failure;
+    }
+
+    if (eErr == CE_None && !WriteStreamingHeader())
+        eErr = CE_Failure;
+
+    if (eErr == CE_None)
+    {
+        m_nLastWrittenBlockId = -1;
+        pScaledData =
+            GDALCreateScaledProgress(0.5, 1.0, pfnProgress, pProgressData);
+        eErr = GDALDatasetCopyWholeRaster(
+            GDALDataset::ToHandle(poSrcDS), GDALDataset::ToHandle(this),
+            papszCopyOptions, GDALScaledProgress, pScaledData);
+        GDALDestroyScaledProgress(pScaledData);
+        if (eErr == CE_None)
+            eErr = FlushCacheInternal(/* bAtClosing = */ false,
+                                      /* bFlushDirectory = */ false);
+    }
+
+    m_aabyStreamingStrile.clear();
+    m_nStreamingCachedSize = 0;
+    return eErr;
+}
+
 /************************************************************************/
 /*                             Crystalize()                             */
 /*                                                                      */
@@ -2164,6 +2593,8 @@ CPLErr GTiffDataset::FlushCacheInternal(bool bAtClosing, bool bFlushDirectory)
     if (m_bIsFinalized)
         return CE_None;
 
+    WaitReadAhead(0, -1, -1, nullptr, /* bDiscard = */ true);
+
     CPLErr eErr = GDALPamDataset::FlushCache(bAtClosing);
 
     if (m_bLoadedBlockDirty && m_nLoadedBlock != -1)
@@ -2195,6 +2626,12 @@ CPLErr GTiffDataset::FlushCacheInternal(bool bAtClosing, bool bFlushDirectory)
         }
     }
 
+    if (!WaitParallelWrites())
+    {
+        m_bWriteError = true;
+        eErr = CE_Failure;
+    }
+
     if (bFlushDirectory && GetAccess() == GA_Update)
     {
         if (FlushDirectory() != CE_None)
@@ -5472,11 +5909,29 @@ TIFF *GTiffDataset::CreateLL(const char *pszFilename, int nXSize, int nYSize,
         }
     }
 #endif
-    if (bStreaming && !EQUAL("NONE", CSLFetchNameValueDef(papszParamList,
-                                                          "COMPRESS", "NONE")))
+    const bool bCopySrcOverviews =
+        CPLFetchBool(papszParamList, "COPY_SRC_OVERVIEWS", false);
+    // Write-once file systems, such as /vsis3/, can receive a streamed
+    // output, whose layout is fully determined before the imagery is written.
+    if (!bStreaming && bCreateCopy && !bCopySrcOverviews &&
+        !CPLFetchBool(papszParamList, "SPARSE_OK", false) &&
+        (l_nCompression == COMPRESSION_NONE ||
+         GTiffSupportsCompressionJobs(l_nCompression)) &&
+        !VSISupportsRandomWrite(pszFilename, true) &&
+        VSISupportsSequentialWrite(pszFilename, false))
+    {
+        CPLDebug("GTiff", "%s does not support random writes. Using streaming",
+                 pszFilename);
+        bStreaming = true;
+    }
+    if (bStreaming && l_nCompression != COMPRESSION_NONE &&
+        (!bCreateCopy || !GTiffSupportsCompressionJobs(l_nCompression)))
     {
         ReportError(pszFilename, CE_Failure, CPLE_NotSupported,
-                    "Streaming only supported to uncompressed TIFF");
+                    bCreateCopy ? "Streaming not supported with this "
+                                  "compression method"
+                                : "Streaming of compressed TIFF only "
+                                  "supported with CreateCopy()");
         return nullptr;
     }
     if (bStreaming && CPLFetchBool(papszParamList, "SPARSE_OK", false))
@@ -5485,8 +5940,6 @@ TIFF *GTiffDataset::CreateLL(const char *pszFilename, int nXSize, int nYSize,
                     "Streaming not supported with SPARSE_OK");
         return nullptr;
     }
-    const bool bCopySrcOverviews =
-        CPLFetchBool(papszParamList, "COPY_SRC_OVERVIEWS", false);
     if (bStreaming && bCopySrcOverviews)
     {
         ReportError(pszFilename, CE_Failure, CPLE_NotSupported,
@@ -6590,6 +7043,7 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     poDS->m_fJXLAlphaDistance = GTiffGetJXLAlphaDistance(papszParamList);
 #endif
     poDS->InitCreationOrOpenOptions(true, papszParamList);
+    poDS->InitParallelWrite();
 
     /* -------------------------------------------------------------------- */
     /*      Create band information objects.                                */
@@ -6623,6 +7077,157 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     return poDS;
 }
 
+/************************************************************************/
+/*                          GetRawCopySource()                          */
+/************************************************************************/
+
+// Returns poSrcDS as a GTiffDataset if its striles can be copied as they
+// are into this dataset, that is without being decompressed and compressed
+// again. Otherwise returns nullptr.
+GTiffDataset *GTiffDataset::GetRawCopySource(GDALDataset *poSrcDS)
+{
+    auto poSrcGTiffDS = dynamic_cast<GTiffDataset *>(poSrcDS);
+    if (!poSrcGTiffDS || poSrcGTiffDS->m_hTIFF == nullptr ||
+        !CPLTestBool(CPLGetConfigOption("GTIFF_COPY_RAW_STRILES", "YES")))
+    {
+        return nullptr;
+    }
+
+    // Lossy codecs have their own quality settings, and JPEG relies on
+    // tables stored in the directory.
+    if (m_nCompression != poSrcGTiffDS->m_nCompression ||
+        !(m_nCompression == COMPRESSION_NONE ||
+          m_nCompression == COMPRESSION_ADOBE_DEFLATE ||
+          m_nCompression == COMPRESSION_LZW ||
+          m_nCompression == COMPRESSION_PACKBITS ||
+          m_nCompression == COMPRESSION_LZMA ||
+          m_nCompression == COMPRESSION_ZSTD ||
+          m_nCompression == COMPRESSION_LERC))
+    {
+        return nullptr;
+    }
+
+    // Settings that would require the data to be processed
+    if (!m_bWriteEmptyTiles || m_bStreamingOut || m_bTreatAsSplit ||
+        m_bTreatAsSplitBitmap || m_panMaskOffsetLsb || m_nZLevel >= 0 ||
+        m_nZSTDLevel >= 0 || m_nLZMAPreset >= 0 || m_dfMaxZError != 0 ||
+        poSrcGTiffDS->m_bTreatAsSplit || poSrcGTiffDS->m_bTreatAsSplitBitmap ||
+        poSrcGTiffDS->m_bStreamingIn)
+    {
+        return nullptr;
+    }
+
+    // The striles of a dataset opened in update mode may not reflect
+    // modifications still in its block cache or being compressed.
+    if (poSrcGTiffDS->eAccess != GA_ReadOnly)
+        return nullptr;
+
+    if (nRasterXSize != poSrcGTiffDS->nRasterXSize ||
+        nRasterYSize != poSrcGTiffDS->nRasterYSize ||
+        nBands != poSrcGTiffDS->nBands || nBands == 0 ||
+        GetRasterBand(1)->GetRasterDataType() !=
+            poSrcGTiffDS->GetRasterBand(1)->GetRasterDataType() ||
+        m_nBlockXSize != poSrcGTiffDS->m_nBlockXSize ||
+        m_nBlockYSize != poSrcGTiffDS->m_nBlockYSize ||
+        m_nBlocksPerBand != poSrcGTiffDS->m_nBlocksPerBand ||
+        m_nPlanarConfig != poSrcGTiffDS->m_nPlanarConfig ||
+        m_nBitsPerSample != poSrcGTiffDS->m_nBitsPerSample ||
+        m_nSampleFormat != poSrcGTiffDS->m_nSampleFormat ||
+        m_nPhotometric != poSrcGTiffDS->m_nPhotometric)
+    {
+        return nullptr;
+    }
+
+    if (m_nCompression == COMPRESSION_LERC &&
+        memcmp(m_anLercAddCompressionAndVersion,
+               poSrcGTiffDS->m_anLercAddCompressionAndVersion,
+               sizeof(m_anLercAddCompressionAndVersion)) != 0)
+    {
+        return nullptr;
+    }
+
+    if (!SetDirectory() || !poSrcGTiffDS->SetDirectory())
+        return nullptr;
+
+    if (TIFFIsTiled(m_hTIFF) != TIFFIsTiled(poSrcGTiffDS->m_hTIFF) ||
+        TIFFIsBigEndian(m_hTIFF) != TIFFIsBigEndian(poSrcGTiffDS->m_hTIFF))
+    {
+        return nullptr;
+    }
+
+    uint16_t nPredictor = PREDICTOR_NONE;
+    uint16_t nSrcPredictor = PREDICTOR_NONE;
+    TIFFGetFieldDefaulted(m_hTIFF, TIFFTAG_PREDICTOR, &nPredictor);
+    TIFFGetFieldDefaulted(poSrcGTiffDS->m_hTIFF, TIFFTAG_PREDICTOR,
+                          &nSrcPredictor);
+    if (nPredictor != nSrcPredictor)
+        return nullptr;
+
+    CPLDebug("GTiff", "Copying striles of %s without recompression",
+             poSrcGTiffDS->GetDescription());
+    return poSrcGTiffDS;
+}
+
+/************************************************************************/
+/*                           CopyRawStrile()                            */
+/************************************************************************/
+
+// Copies the compressed content of strile nStrile of poSrcDS as the content
+// of the same strile in this dataset.
+// Returns false if the strile is not available in the source, in which case
+// the caller must use the regular code path. Write errors are reported
+// through m_bWriteError.
+bool GTiffDataset::CopyRawStrile(GTiffDataset *poSrcDS, int nStrile,
+                                 std::vector<GByte> &abyBuffer)
+{
+    vsi_l_offset nOffset = 0;
+    vsi_l_offset nSize = 0;
+    bool bErrOccurred = false;
+    if (!poSrcDS->IsBlockAvailable(nStrile, &nOffset, &nSize, &bErrOccurred) ||
+        bErrOccurred || nSize == 0 ||
+        nSize > static_cast<vsi_l_offset>(std::numeric_limits<int>::max()))
+    {
+        return false;
+    }
+
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nSize));
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+
+    if (VSIFSeekL(poSrcDS->m_fpL, nOffset, SEEK_SET) != 0 ||
+        VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), poSrcDS->m_fpL) !=
+            abyBuffer.size())
+    {
+        return false;
+    }
+
+    // Striles must be written in the order they are submitted, so make
+    // sure that pending compression jobs are completed.
+    auto poQueue = m_poBaseDS ? m_poBaseDS->m_poCompressQueue.get()
+                              : m_poCompressQueue.get();
+    if (poQueue)
+    {
+        poQueue->WaitCompletion();
+
+        // cppcheck-suppress constVariableReference
+        auto &oQueue =
+            m_poBaseDS ? m_poBaseDS->m_asQueueJobIdx : m_asQueueJobIdx;
+        while (!oQueue.empty())
+        {
+            WaitCompletionForJobIdx(oQueue.front());
+        }
+    }
+
+    WriteRawStripOrTile(nStrile, abyBuffer.data(),
+                        static_cast<GPtrDiff_t>(abyBuffer.size()));
+    return true;
+}
+
 /************************************************************************/
 /*                           CopyImageryAndMask()                       */
 /************************************************************************/
@@ -6650,6 +7255,10 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
     const bool bIsOddBand =
         dynamic_cast<GTiffOddBitsBand *>(poDstDS->GetRasterBand(1)) != nullptr;
 
+    // Source whose compressed striles can be copied without recompression
+    GTiffDataset *poRawSrcDS = poDstDS->GetRawCopySource(poSrcDS);
+    std::vector<GByte> abyRawStrile;
+
     if (poDstDS->m_poMaskDS)
     {
         CPLAssert(poDstDS->m_poMaskDS->m_nBlockXSize == poDstDS->m_nBlockXSize);
@@ -6680,23 +7289,31 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                 {
                     const int nReqXSize =
                         std::min(nXSize - iX, poDstDS->m_nBlockXSize);
-                    if (nReqXSize < poDstDS->m_nBlockXSize ||
-                        nReqYSize < poDstDS->m_nBlockYSize)
+                    if (poRawSrcDS && poDstDS->CopyRawStrile(
+                                          poRawSrcDS, iBlock, abyRawStrile))
                     {
-                        memset(pBlockBuffer, 0,
-                               static_cast<size_t>(poDstDS->m_nBlockXSize) *
-                                   poDstDS->m_nBlockYSize * nDataTypeSize);
+                        // done
                     }
-                    eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, eType, nDataTypeSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize,
-                        nullptr);
-                    if (eErr == CE_None)
+                    else
                     {
-                        eErr = poDstDS->WriteEncodedTileOrStrip(
-                            iBlock, pBlockBuffer, false);
+                        if (nReqXSize < poDstDS->m_nBlockXSize ||
+                            nReqYSize < poDstDS->m_nBlockYSize)
+                        {
+                            memset(pBlockBuffer, 0,
+                                   static_cast<size_t>(poDstDS->m_nBlockXSize) *
+                                       poDstDS->m_nBlockYSize * nDataTypeSize);
+                        }
+                        eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
+                            GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
+                            nReqXSize, nReqYSize, eType, nDataTypeSize,
+                            static_cast<GSpacing>(nDataTypeSize) *
+                                poDstDS->m_nBlockXSize,
+                            nullptr);
+                        if (eErr == CE_None)
+                        {
+                            eErr = poDstDS->WriteEncodedTileOrStrip(
+                                iBlock, pBlockBuffer, false);
+                        }
                     }
 
                     iBlock++;
@@ -6798,21 +7415,35 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
 
                 if (poDstDS->m_bTileInterleave)
                 {
-                    eErr = poSrcDS->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, eType, l_nBands, nullptr,
-                        nDataTypeSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize * poDstDS->m_nBlockYSize,
-                        nullptr);
-                    if (eErr == CE_None)
+                    bool bDataRead = false;
+                    for (int i = 0; eErr == CE_None && i < l_nBands; i++)
                     {
-                        for (int i = 0; eErr == CE_None && i < l_nBands; i++)
+                        const int nStrile =
+                            iBlock + i * poDstDS->m_nBlocksPerBand;
+                        if (poRawSrcDS &&
+                            poDstDS->CopyRawStrile(poRawSrcDS, nStrile,
+                                                   abyRawStrile))
+                        {
+                            continue;
+                        }
+                        if (!bDataRead)
+                        {
+                            eErr = poSrcDS->RasterIO(
+                                GF_Read, iX, iY, nReqXSize, nReqYSize,
+                                pBlockBuffer, nReqXSize, nReqYSize, eType,
+                                l_nBands, nullptr, nDataTypeSize,
+                                static_cast<GSpacing>(nDataTypeSize) *
+                                    poDstDS->m_nBlockXSize,
+                                static_cast<GSpacing>(nDataTypeSize) *
+                                    poDstDS->m_nBlockXSize *
+                                    poDstDS->m_nBlockYSize,
+                                nullptr);
+                            bDataRead = true;
+                        }
+                        if (eErr == CE_None)
                         {
                             eErr = poDstDS->WriteEncodedTileOrStrip(
-                                iBlock + i * poDstDS->m_nBlocksPerBand,
+                                nStrile,
                                 pBlockBuffer + static_cast<size_t>(i) *
                                                    poDstDS->m_nBlockXSize *
                                                    poDstDS->m_nBlockYSize *
@@ -6821,6 +7452,11 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                         }
                     }
                 }
+                else if (poRawSrcDS && poDstDS->CopyRawStrile(
+                                           poRawSrcDS, iBlock, abyRawStrile))
+                {
+                    // done
+                }
                 else if (!bIsOddBand)
                 {
                     eErr = poSrcDS->RasterIO(
@@ -7235,6 +7871,31 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
             CSLSetNameValue(papszCreateOptions, "PHOTOMETRIC", "RGB");
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      CreateLL() switches to streaming for write-once file systems,   */
+    /*      but a per-dataset mask cannot be written in streaming mode.     */
+    /* -------------------------------------------------------------------- */
+    if (strcmp(pszFilename, "/vsistdout/") != 0 &&
+        !CPLFetchBool(papszCreateOptions, "STREAMABLE_OUTPUT", false) &&
+        !VSISupportsRandomWrite(pszFilename, true) &&
+        VSISupportsSequentialWrite(pszFilename, false))
+    {
+        const int nSrcMaskFlags = poPBand->GetMaskFlags();
+        if (!(nSrcMaskFlags & (GMF_ALL_VALID | GMF_ALPHA | GMF_NODATA)) &&
+            (nSrcMaskFlags & GMF_PER_DATASET))
+        {
+            ReportError(pszFilename, CE_Failure, CPLE_NotSupported,
+                        "%s only supports sequential writing, which requires "
+                        "streaming, but the mask of the source dataset "
+                        "cannot be written in streaming mode. For cloud "
+                        "storage, CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE=YES "
+                        "may be set to allow random writing.",
+                        pszFilename);
+            CSLDestroy(papszCreateOptions);
+            return nullptr;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Create the file.                                                */
     /* -------------------------------------------------------------------- */
@@ -7805,7 +8466,10 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
             CPL_IGNORE_RET_VAL(VSIFCloseL(l_fpL));
             return nullptr;
         }
-        if (static_cast<vsi_l_offset>(VSIFWriteL(pabyBuffer, 1,
+        // For compressed data, the header can only be written once the
+        // size of the striles is known.
+        if (l_nCompression == COMPRESSION_NONE &&
+            static_cast<vsi_l_offset>(VSIFWriteL(pabyBuffer, 1,
                                                  static_cast<int>(nDataLength),
                                                  fpStreaming)) != nDataLength)
         {
@@ -8071,6 +8735,7 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
     poDS->m_fJXLAlphaDistance = GTiffGetJXLAlphaDistance(papszOptions);
 #endif
     poDS->InitCreationOrOpenOptions(true, papszOptions);
+    poDS->InitParallelWrite();
 
     if (l_nCompression == COMPRESSION_ADOBE_DEFLATE ||
         l_nCompression == COMPRESSION_LERC)
@@ -8502,8 +9167,8 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
 #endif
         eErr == CE_None)
     {
-        const char *papszCopyWholeRasterOptions[3] = {nullptr, nullptr,
-                                                      nullptr};
+        const char *papszCopyWholeRasterOptions[4] = {nullptr, nullptr,
+                                                      nullptr, nullptr};
         int iNextOption = 0;
         papszCopyWholeRasterOptions[iNextOption++] = "SKIP_HOLES=YES";
         if (l_nCompression != COMPRESSION_NONE)
@@ -8513,7 +9178,7 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
 
         // For streaming with separate, we really want that bands are written
         // after each other, even if the source is pixel interleaved.
-        else if (bStreaming && poDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+        if (bStreaming && poDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
         {
             papszCopyWholeRasterOptions[iNextOption++] = "INTERLEAVE=BAND";
         }
@@ -8543,6 +9208,30 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                 bWriteMask = false;
             }
         }
+        else if (!bStreaming && poDS->GetRawCopySource(poSrcDS))
+        {
+            // Copy compressed striles as they are
+            if (poDS->m_poMaskDS)
+            {
+                GDALDestroyScaledProgress(pScaledData);
+                pScaledData =
+                    GDALCreateScaledProgress(dfCurPixels / dfTotalPixels, 1.0,
+                                             pfnProgress, pProgressData);
+            }
+            eErr = CopyImageryAndMask(poDS, poSrcDS,
+                                      poSrcDS->GetRasterBand(1)->GetMaskBand(),
+                                      GDALScaledProgress, pScaledData);
+            if (poDS->m_poMaskDS)
+            {
+                bWriteMask = false;
+            }
+        }
+        else if (bStreaming && l_nCompression != COMPRESSION_NONE)
+        {
+            eErr = poDS->CopyImageryStreamingCompressed(
+                poSrcDS, papszCopyWholeRasterOptions, GDALScaledProgress,
+                pScaledData);
+        }
         else
         {
             eErr = GDALDatasetCopyWholeRaster(
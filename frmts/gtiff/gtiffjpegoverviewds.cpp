@@ -15,8 +15,14 @@
 
 #include "gtiffdataset.h"
 
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
 #include "tifvsi.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 /************************************************************************/
 /* ==================================================================== */
 /*                     GTiffJPEGOverviewBand                            */
@@ -115,6 +121,16 @@ CPLErr GTiffJPEGOverviewDS::IRasterIO(
     GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    // Decode the JPEG strips/tiles intersecting the request in parallel
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        IsMultiThreadedReadCompatible(nXOff, nYOff, nXSize, nYSize,
+                                      nBandCount))
+    {
+        return MultiThreadedRead(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                                 nBandCount, panBandMap, nPixelSpace,
+                                 nLineSpace, nBandSpace);
+    }
+
     // For non-single strip JPEG-IN-TIFF, the block based strategy will
     // be the most efficient one, to avoid decompressing the JPEG content
     // for each requested band.
@@ -196,11 +212,14 @@ CPLErr GTiffJPEGOverviewBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         return CE_None;
     }
 
-    const int nScaleFactor = 1 << m_poGDS->m_nOverviewLevel;
     if (m_poGDS->m_poJPEGDS == nullptr || nBlockId != m_poGDS->m_nBlockId)
     {
         if (nByteCount < 2)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid byte count for strip/tile %d", nBlockId);
             return CE_Failure;
+        }
         nOffset += 2;  // Skip leading 0xFF 0xF8.
         nByteCount -= 2;
 
@@ -274,108 +293,374 @@ CPLErr GTiffJPEGOverviewBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
         CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
 
-        const char *const apszDrivers[] = {"JPEG", nullptr};
+        m_poGDS->m_poJPEGDS = m_poGDS->OpenJPEGDataset(osFileToOpen);
+        if (m_poGDS->m_poJPEGDS != nullptr)
+            m_poGDS->m_nBlockId = nBlockId;
+    }
 
-        CPLConfigOptionSetter oJPEGtoRGBSetter(
-            "GDAL_JPEG_TO_RGB",
-            m_poGDS->m_poParentDS->m_nPlanarConfig == PLANARCONFIG_CONTIG &&
-                    m_poGDS->nBands == 4
-                ? "NO"
-                : "YES",
-            false);
+    if (!m_poGDS->m_poJPEGDS)
+        return CE_Failure;
 
-        m_poGDS->m_poJPEGDS.reset(
-            GDALDataset::Open(osFileToOpen, GDAL_OF_RASTER | GDAL_OF_INTERNAL,
-                              apszDrivers, nullptr, nullptr));
+    return m_poGDS->ReadBlockFromJPEGDataset(m_poGDS->m_poJPEGDS.get(), nBand,
+                                             nBlockXOff, nBlockYOff,
+                                             bIsSingleStripAsSplit, pImage);
+}
 
-        if (m_poGDS->m_poJPEGDS != nullptr)
-        {
-            // Force all implicit overviews to be available, even for
-            // small tiles.
-            CPLConfigOptionSetter oInternalOverviewsSetter(
-                "JPEG_FORCE_INTERNAL_OVERVIEWS", "YES", false);
-            GDALGetOverviewCount(
-                GDALGetRasterBand(m_poGDS->m_poJPEGDS.get(), 1));
+/************************************************************************/
+/*                          OpenJPEGDataset()                           */
+/************************************************************************/
 
-            m_poGDS->m_nBlockId = nBlockId;
+// Open the JPEG file made of the JPEG tables and the content of a strip/tile
+std::unique_ptr<GDALDataset>
+GTiffJPEGOverviewDS::OpenJPEGDataset(const std::string &osFilename) const
+{
+    const char *const apszDrivers[] = {"JPEG", nullptr};
+
+    CPLConfigOptionSetter oJPEGtoRGBSetter(
+        "GDAL_JPEG_TO_RGB",
+        m_poParentDS->m_nPlanarConfig == PLANARCONFIG_CONTIG && nBands == 4
+            ? "NO"
+            : "YES",
+        false);
+
+    std::unique_ptr<GDALDataset> poJPEGDS(
+        GDALDataset::Open(osFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_INTERNAL,
+                          apszDrivers, nullptr, nullptr));
+
+    if (poJPEGDS != nullptr)
+    {
+        // Force all implicit overviews to be available, even for
+        // small tiles.
+        CPLConfigOptionSetter oInternalOverviewsSetter(
+            "JPEG_FORCE_INTERNAL_OVERVIEWS", "YES", false);
+        GDALGetOverviewCount(GDALGetRasterBand(poJPEGDS.get(), 1));
+    }
+
+    return poJPEGDS;
+}
+
+/************************************************************************/
+/*                     ReadBlockFromJPEGDataset()                       */
+/************************************************************************/
+
+// Read a block of this overview from the JPEG file of a strip/tile, using
+// the DCT scaling capabilities of libjpeg.
+CPLErr GTiffJPEGOverviewDS::ReadBlockFromJPEGDataset(
+    GDALDataset *poJPEGDS, int nBand, int nBlockXOff, int nBlockYOff,
+    bool bIsSingleStripAsSplit, void *pImage)
+{
+    auto poBand = GetRasterBand(nBand);
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const GDALDataType eDataType = poBand->GetRasterDataType();
+    const int nDataTypeSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nScaleFactor = 1 << m_nOverviewLevel;
+
+    int nReqXOff = 0;
+    int nReqYOff = 0;
+    int nReqXSize = 0;
+    int nReqYSize = 0;
+    if (bIsSingleStripAsSplit)
+    {
+        nReqYOff = nBlockYOff * nScaleFactor;
+        nReqXSize = poJPEGDS->GetRasterXSize();
+        nReqYSize = nScaleFactor;
+    }
+    else
+    {
+        if (nBlockXSize == GetRasterXSize())
+        {
+            nReqXSize = poJPEGDS->GetRasterXSize();
+        }
+        else
+        {
+            nReqXSize = nBlockXSize * nScaleFactor;
         }
+        nReqYSize = nBlockYSize * nScaleFactor;
+    }
+    int nBufXSize = nBlockXSize;
+    int nBufYSize = nBlockYSize;
+    if (nBlockXOff == m_poParentDS->m_nBlocksPerRow - 1)
+    {
+        nReqXSize = m_poParentDS->nRasterXSize -
+                    nBlockXOff * m_poParentDS->m_nBlockXSize;
+    }
+    if (nReqXOff + nReqXSize > poJPEGDS->GetRasterXSize())
+    {
+        nReqXSize = poJPEGDS->GetRasterXSize() - nReqXOff;
+    }
+    if (!bIsSingleStripAsSplit &&
+        nBlockYOff == m_poParentDS->m_nBlocksPerColumn - 1)
+    {
+        nReqYSize = m_poParentDS->nRasterYSize -
+                    nBlockYOff * m_poParentDS->m_nBlockYSize;
+    }
+    if (nReqYOff + nReqYSize > poJPEGDS->GetRasterYSize())
+    {
+        nReqYSize = poJPEGDS->GetRasterYSize() - nReqYOff;
+    }
+    if (nBlockXOff * nBlockXSize > GetRasterXSize() - nBufXSize)
+    {
+        memset(pImage, 0,
+               static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize *
+                   nDataTypeSize);
+        nBufXSize = GetRasterXSize() - nBlockXOff * nBlockXSize;
     }
+    if (nBlockYOff * nBlockYSize > GetRasterYSize() - nBufYSize)
+    {
+        memset(pImage, 0,
+               static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize *
+                   nDataTypeSize);
+        nBufYSize = GetRasterYSize() - nBlockYOff * nBlockYSize;
+    }
+
+    const int nSrcBand =
+        m_poParentDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE ? 1 : nBand;
+    if (nSrcBand > poJPEGDS->GetRasterCount())
+        return CE_Failure;
+
+    return poJPEGDS->GetRasterBand(nSrcBand)->RasterIO(
+        GF_Read, nReqXOff, nReqYOff, nReqXSize, nReqYSize, pImage, nBufXSize,
+        nBufYSize, eDataType, 0,
+        static_cast<GPtrDiff_t>(nBlockXSize) * nDataTypeSize, nullptr);
+}
 
-    CPLErr eErr = CE_Failure;
-    if (m_poGDS->m_poJPEGDS)
+/************************************************************************/
+/*                   IsMultiThreadedReadCompatible()                    */
+/************************************************************************/
+
+bool GTiffJPEGOverviewDS::IsMultiThreadedReadCompatible(int nXOff, int nYOff,
+                                                        int nXSize, int nYSize,
+                                                        int nBandCount) const
+{
+    if (m_poParentDS->m_poThreadPool == nullptr ||
+        m_poParentDS->m_nDisableMultiThreadedRead != 0)
     {
-        GDALDataset *l_poDS = m_poGDS->m_poJPEGDS.get();
+        return false;
+    }
+
+    // Single strip files exposed as split bands are read sequentially
+    int nParentBlockXSize = 0;
+    int nParentBlockYSize = 0;
+    m_poParentDS->GetRasterBand(1)->GetBlockSize(&nParentBlockXSize,
+                                                 &nParentBlockYSize);
+    if (nParentBlockYSize != m_poParentDS->m_nBlockYSize)
+        return false;
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    papoBands[0]->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nXBlocks =
+        (nXOff + nXSize - 1) / nBlockXSize - nXOff / nBlockXSize + 1;
+    const int nYBlocks =
+        (nYOff + nYSize - 1) / nBlockYSize - nYOff / nBlockYSize + 1;
+    const size_t nBlocks =
+        static_cast<size_t>(nXBlocks) * nYBlocks *
+        (m_poParentDS->m_nPlanarConfig == PLANARCONFIG_CONTIG ? 1 : nBandCount);
+    return nBlocks > 1;
+}
+
+/************************************************************************/
+/*                         MultiThreadedRead()                          */
+/************************************************************************/
+
+// Decode the strips/tiles intersecting the request in worker threads of the
+// thread pool of the parent dataset, each one at the reduced resolution of
+// this overview, directly into the output buffer (by-passing the block cache)
+CPLErr GTiffJPEGOverviewDS::MultiThreadedRead(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, const int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    papoBands[0]->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const GDALDataType eDataType = papoBands[0]->GetRasterDataType();
+    const int nDataTypeSize = GDALGetDataTypeSizeBytes(eDataType);
+    const bool bSeparate =
+        m_poParentDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE;
 
-        int nReqXOff = 0;
-        int nReqYOff = 0;
-        int nReqXSize = 0;
-        int nReqYSize = 0;
-        if (bIsSingleStripAsSplit)
+    struct JPEGDecodeJob
+    {
+        int nBlockXOff = 0;
+        int nBlockYOff = 0;
+        // Index in panBandMap of the decoded band, or -1 for all bands
+        int iBand = -1;
+        std::string osTmpFilename{};
+        // JPEG tables followed by the content of the strip/tile. Empty for
+        // blocks that are not available.
+        std::vector<GByte> abyJPEG{};
+    };
+
+    auto poQueue = m_poParentDS->m_poThreadPool->CreateJobQueue();
+    // Bound the amount of compressed data held in memory
+    const int nMaxPendingJobs =
+        4 * m_poParentDS->m_poThreadPool->GetThreadCount();
+    CPLErrorAccumulator oErrorAccumulator;
+    std::atomic<bool> bSuccess = true;
+
+    const auto DecodeJob = [this, &bSuccess, nXOff, nYOff, nXSize, nYSize,
+                            pData, eBufType, nBandCount, panBandMap,
+                            nPixelSpace, nLineSpace, nBandSpace, nBlockXSize,
+                            nBlockYSize, eDataType,
+                            nDataTypeSize](JPEGDecodeJob &sJob)
+    {
+        std::unique_ptr<GDALDataset> poJPEGDS;
+        if (!sJob.abyJPEG.empty())
         {
-            nReqYOff = nBlockYOff * nScaleFactor;
-            nReqXSize = l_poDS->GetRasterXSize();
-            nReqYSize = nScaleFactor;
+            CPL_IGNORE_RET_VAL(VSIFCloseL(VSIFileFromMemBuffer(
+                sJob.osTmpFilename.c_str(), sJob.abyJPEG.data(),
+                sJob.abyJPEG.size(), FALSE)));
+            poJPEGDS = OpenJPEGDataset(sJob.osTmpFilename);
+            if (!poJPEGDS)
+            {
+                VSIUnlink(sJob.osTmpFilename.c_str());
+                bSuccess = false;
+                return;
+            }
         }
-        else
+
+        // Intersection of the request with the block
+        const int nXStart = std::max(nXOff, sJob.nBlockXOff * nBlockXSize);
+        const int nXEnd =
+            std::min(nXOff + nXSize, (sJob.nBlockXOff + 1) * nBlockXSize);
+        const int nYStart = std::max(nYOff, sJob.nBlockYOff * nBlockYSize);
+        const int nYEnd =
+            std::min(nYOff + nYSize, (sJob.nBlockYOff + 1) * nBlockYSize);
+
+        std::vector<GByte> abyBlock(static_cast<size_t>(nBlockXSize) *
+                                    nBlockYSize * nDataTypeSize);
+        for (int i = 0; i < nBandCount && bSuccess; ++i)
         {
-            if (nBlockXSize == m_poGDS->GetRasterXSize())
+            if (sJob.iBand >= 0 && i != sJob.iBand)
+                continue;
+            if (!poJPEGDS)
             {
-                nReqXSize = l_poDS->GetRasterXSize();
+                std::fill(abyBlock.begin(), abyBlock.end(), 0);
             }
-            else
+            else if (ReadBlockFromJPEGDataset(
+                         poJPEGDS.get(), panBandMap[i], sJob.nBlockXOff,
+                         sJob.nBlockYOff, false, abyBlock.data()) != CE_None)
             {
-                nReqXSize = nBlockXSize * nScaleFactor;
+                bSuccess = false;
+                break;
+            }
+
+            for (int iY = nYStart; iY < nYEnd; ++iY)
+            {
+                const GByte *pabySrc =
+                    abyBlock.data() +
+                    (static_cast<size_t>(iY - sJob.nBlockYOff * nBlockYSize) *
+                         nBlockXSize +
+                     (nXStart - sJob.nBlockXOff * nBlockXSize)) *
+                        nDataTypeSize;
+                GByte *pabyDst = static_cast<GByte *>(pData) +
+                                 (iY - nYOff) * nLineSpace +
+                                 (nXStart - nXOff) * nPixelSpace +
+                                 i * nBandSpace;
+                GDALCopyWords64(pabySrc, eDataType, nDataTypeSize, pabyDst,
+                                eBufType, static_cast<int>(nPixelSpace),
+                                nXEnd - nXStart);
             }
-            nReqYSize = nBlockYSize * nScaleFactor;
-        }
-        int nBufXSize = nBlockXSize;
-        int nBufYSize = nBlockYSize;
-        if (nBlockXOff == m_poGDS->m_poParentDS->m_nBlocksPerRow - 1)
-        {
-            nReqXSize = m_poGDS->m_poParentDS->nRasterXSize -
-                        nBlockXOff * m_poGDS->m_poParentDS->m_nBlockXSize;
-        }
-        if (nReqXOff + nReqXSize > l_poDS->GetRasterXSize())
-        {
-            nReqXSize = l_poDS->GetRasterXSize() - nReqXOff;
-        }
-        if (!bIsSingleStripAsSplit &&
-            nBlockYOff == m_poGDS->m_poParentDS->m_nBlocksPerColumn - 1)
-        {
-            nReqYSize = m_poGDS->m_poParentDS->nRasterYSize -
-                        nBlockYOff * m_poGDS->m_poParentDS->m_nBlockYSize;
-        }
-        if (nReqYOff + nReqYSize > l_poDS->GetRasterYSize())
-        {
-            nReqYSize = l_poDS->GetRasterYSize() - nReqYOff;
-        }
-        if (nBlockXOff * nBlockXSize > m_poGDS->GetRasterXSize() - nBufXSize)
-        {
-            memset(pImage, 0,
-                   static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize *
-                       nDataTypeSize);
-            nBufXSize = m_poGDS->GetRasterXSize() - nBlockXOff * nBlockXSize;
-        }
-        if (nBlockYOff * nBlockYSize > m_poGDS->GetRasterYSize() - nBufYSize)
-        {
-            memset(pImage, 0,
-                   static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize *
-                       nDataTypeSize);
-            nBufYSize = m_poGDS->GetRasterYSize() - nBlockYOff * nBlockYSize;
         }
 
-        const int nSrcBand =
-            m_poGDS->m_poParentDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE
-                ? 1
-                : nBand;
-        if (nSrcBand <= l_poDS->GetRasterCount())
+        poJPEGDS.reset();
+        if (!sJob.abyJPEG.empty())
+            VSIUnlink(sJob.osTmpFilename.c_str());
+    };
+
+    const int nBlockX1 = nXOff / nBlockXSize;
+    const int nBlockY1 = nYOff / nBlockYSize;
+    const int nBlockX2 = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockY2 = (nYOff + nYSize - 1) / nBlockYSize;
+    TIFF *hTIFF = m_poParentDS->m_hTIFF;
+    VSILFILE *fpTIF = VSI_TIFFGetVSILFile(TIFFClientdata(hTIFF));
+    for (int iBlockY = nBlockY1; iBlockY <= nBlockY2 && bSuccess; ++iBlockY)
+    {
+        for (int iBlockX = nBlockX1; iBlockX <= nBlockX2 && bSuccess;
+             ++iBlockX)
         {
-            eErr = l_poDS->GetRasterBand(nSrcBand)->RasterIO(
-                GF_Read, nReqXOff, nReqYOff, nReqXSize, nReqYSize, pImage,
-                nBufXSize, nBufYSize, eDataType, 0,
-                static_cast<GPtrDiff_t>(nBlockXSize) * nDataTypeSize, nullptr);
+            for (int i = 0; i < (bSeparate ? nBandCount : 1) && bSuccess; ++i)
+            {
+                auto psJob = std::make_shared<JPEGDecodeJob>();
+                psJob->nBlockXOff = iBlockX;
+                psJob->nBlockYOff = iBlockY;
+                int nBlockId =
+                    iBlockY * m_poParentDS->m_nBlocksPerRow + iBlockX;
+                if (bSeparate)
+                {
+                    psJob->iBand = i;
+                    nBlockId += (panBandMap[i] - 1) *
+                                m_poParentDS->m_nBlocksPerBand;
+                }
+
+                // Read the compressed data from the main thread
+                vsi_l_offset nOffset = 0;
+                vsi_l_offset nByteCount = 0;
+                bool bErrOccurred = false;
+                if (m_poParentDS->IsBlockAvailable(nBlockId, &nOffset,
+                                                   &nByteCount, &bErrOccurred))
+                {
+                    if (nByteCount < 2 ||
+                        nByteCount > static_cast<vsi_l_offset>(INT_MAX))
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Invalid byte count for strip/tile %d",
+                                 nBlockId);
+                        bSuccess = false;
+                        break;
+                    }
+                    nOffset += 2;  // Skip leading 0xFF 0xF8.
+                    nByteCount -= 2;
+                    try
+                    {
+                        psJob->abyJPEG.resize(
+                            m_nJPEGTableSize + static_cast<size_t>(nByteCount));
+                    }
+                    catch (const std::exception &)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "Out of memory allocating JPEG buffer");
+                        bSuccess = false;
+                        break;
+                    }
+                    memcpy(psJob->abyJPEG.data(), m_pabyJPEGTable,
+                           m_nJPEGTableSize);
+                    if (VSIFSeekL(fpTIF, nOffset, SEEK_SET) != 0 ||
+                        VSIFReadL(psJob->abyJPEG.data() + m_nJPEGTableSize,
+                                  static_cast<size_t>(nByteCount), 1,
+                                  fpTIF) != 1)
+                    {
+                        CPLError(CE_Failure, CPLE_FileIO,
+                                 "Cannot read strip/tile %d", nBlockId);
+                        bSuccess = false;
+                        break;
+                    }
+                    psJob->osTmpFilename =
+                        VSIMemGenerateHiddenFilename("jpegovr");
+                }
+                else if (bErrOccurred)
+                {
+                    bSuccess = false;
+                    break;
+                }
+
+                poQueue->SubmitJob(
+                    [psJob, &DecodeJob, &oErrorAccumulator]()
+                    {
+                        auto oAccumulator =
+                            oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        DecodeJob(*psJob);
+                    });
+                poQueue->WaitCompletion(nMaxPendingJobs);
+            }
         }
     }
 
-    return eErr;
+    poQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return bSuccess ? CE_None : CE_Failure;
 }
@@ -16,6 +16,9 @@
 
 #include "gdal_priv.h"
 
+#include <memory>
+#include <string>
+
 class GTiffDataset;
 
 /************************************************************************/
@@ -41,6 +44,19 @@ class GTiffJPEGOverviewDS final : public GDALDataset
     // Valid block id of the parent DS that match poJPEGDS.
     int m_nBlockId = -1;
 
+    std::unique_ptr<GDALDataset>
+    OpenJPEGDataset(const std::string &osFilename) const;
+    CPLErr ReadBlockFromJPEGDataset(GDALDataset *poJPEGDS, int nBand,
+                                    int nBlockXOff, int nBlockYOff,
+                                    bool bIsSingleStripAsSplit, void *pImage);
+    bool IsMultiThreadedReadCompatible(int nXOff, int nYOff, int nXSize,
+                                       int nYSize, int nBandCount) const;
+    CPLErr MultiThreadedRead(int nXOff, int nYOff, int nXSize, int nYSize,
+                             void *pData, GDALDataType eBufType,
+                             int nBandCount, const int *panBandMap,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GSpacing nBandSpace);
+
   public:
     GTiffJPEGOverviewDS(GTiffDataset *poParentDS, int nOverviewLevel,
                         const void *pJPEGTable, int nJPEGTableSize);
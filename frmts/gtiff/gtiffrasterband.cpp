@@ -16,8 +16,11 @@
 
 #include <algorithm>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "cpl_vsi_virtual.h"
+#include "gdal_persistent_block_cache.h"
 #include "tifvsi.h"
 
 /************************************************************************/
@@ -232,6 +235,9 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
              nYSize, nBufXSize, nBufYSize);
 #endif
 
+    // Collect blocks decoded in the background by ScheduleReadAhead()
+    m_poGDS->WaitReadAhead();
+
     // Try to pass the request to the most appropriate overview dataset.
     if (nBufXSize < nXSize && nBufYSize < nYSize)
     {
@@ -264,8 +270,15 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             return static_cast<CPLErr>(nErr);
     }
 
+    // Multi-threaded and multi-range reads bypass the block cache, and thus
+    // the persistent block cache.
+    const bool bUsePersistentBlockCache =
+        eRWFlag == GF_Read &&
+        GDALPersistentBlockCacheIsEnabledFor(m_poGDS->m_pszFilename);
+
     bool bCanUseMultiThreadedRead = false;
     if (m_poGDS->m_nDisableMultiThreadedRead == 0 && eRWFlag == GF_Read &&
+        !bUsePersistentBlockCache &&
         m_poGDS->m_poThreadPool != nullptr && nXSize == nBufXSize &&
         nYSize == nBufYSize && m_poGDS->IsMultiThreadedReadCompatible())
     {
@@ -308,7 +321,7 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     BufferedDataFreer bufferedDataFreer;
 
     if (m_poGDS->eAccess == GA_ReadOnly && eRWFlag == GF_Read &&
-        m_poGDS->HasOptimizedReadMultiRange())
+        !bUsePersistentBlockCache && m_poGDS->HasOptimizedReadMultiRange())
     {
         if (bCanUseMultiThreadedRead &&
             VSI_TIFFGetVSILFile(TIFFClientdata(m_poGDS->m_hTIFF))->HasPRead())
@@ -481,6 +494,83 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     return eErr;
 }
 
+/************************************************************************/
+/*                        IMultiRangeRasterIO()                         */
+/************************************************************************/
+
+CPLErr
+GTiffRasterBand::IMultiRangeRasterIO(int nWindowCount,
+                                     const GDALRasterIOWindow *pasWindows,
+                                     GDALDataType eBufType)
+{
+    // Collect blocks decoded in the background by ScheduleReadAhead()
+    m_poGDS->WaitReadAhead();
+
+    // Whatever the density of the windows, announce the exact ranges of the
+    // striles they touch that are not in the block cache, so that network
+    // file systems fetch them with parallel requests.
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_poGDS->m_hTIFF));
+    const size_t nTotalBytesLimit = fp->GetAdviseReadTotalBytesLimit();
+    if (nTotalBytesLimit > 0 && m_poGDS->eAccess == GA_ReadOnly &&
+        !m_poGDS->m_bStreamingIn && nBlockXSize == m_poGDS->m_nBlockXSize &&
+        nBlockYSize == m_poGDS->m_nBlockYSize)
+    {
+        // Ordered by block row, then block column
+        std::set<std::pair<int, int>> oSetBlocks;
+        for (int i = 0; i < nWindowCount; ++i)
+        {
+            const GDALRasterIOWindow &sWindow = pasWindows[i];
+            for (int iY = sWindow.nYOff / nBlockYSize;
+                 iY <= (sWindow.nYOff + sWindow.nYSize - 1) / nBlockYSize; ++iY)
+            {
+                for (int iX = sWindow.nXOff / nBlockXSize;
+                     iX <= (sWindow.nXOff + sWindow.nXSize - 1) / nBlockXSize;
+                     ++iX)
+                {
+                    oSetBlocks.insert(std::make_pair(iY, iX));
+                }
+            }
+        }
+
+        std::vector<vsi_l_offset> anOffsets;
+        std::vector<size_t> anSizes;
+        size_t nAccBytes = 0;
+        for (const auto &[nBlockYOff, nBlockXOff] : oSetBlocks)
+        {
+            GDALRasterBlock *poBlock =
+                TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            vsi_l_offset nOffset = 0;
+            vsi_l_offset nSize = 0;
+            if (!m_poGDS->IsBlockAvailable(
+                    ComputeBlockId(nBlockXOff, nBlockYOff), &nOffset, &nSize,
+                    nullptr) ||
+                nSize == 0)
+            {
+                continue;
+            }
+            // Blocks beyond the capacity of AdviseRead() are read as usual.
+            if (nSize > nTotalBytesLimit - nAccBytes)
+                break;
+            anOffsets.push_back(nOffset);
+            anSizes.push_back(static_cast<size_t>(nSize));
+            nAccBytes += static_cast<size_t>(nSize);
+        }
+        if (anOffsets.size() > 1)
+        {
+            fp->AdviseRead(static_cast<int>(anOffsets.size()),
+                           anOffsets.data(), anSizes.data());
+        }
+    }
+
+    return GDALPamRasterBand::IMultiRangeRasterIO(nWindowCount, pasWindows,
+                                                  eBufType);
+}
+
 /************************************************************************/
 /*                        ComputeBlockId()                              */
 /************************************************************************/
@@ -75,6 +75,9 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
 
     int ComputeBlockId(int nBlockXOff, int nBlockYOff) const;
 
+    bool GetPersistentBlockCacheIdentity(std::string &osFilename,
+                                         std::string &osIdentity) override;
+
   public:
     GTiffRasterBand(GTiffDataset *, int);
     virtual ~GTiffRasterBand();
@@ -103,6 +106,10 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
                              GSpacing nPixelSpace, GSpacing nLineSpace,
                              GDALRasterIOExtraArg *psExtraArg) override final;
 
+    CPLErr IMultiRangeRasterIO(int nWindowCount,
+                               const GDALRasterIOWindow *pasWindows,
+                               GDALDataType eBufType) override;
+
     virtual const char *GetDescription() const override final;
     virtual void SetDescription(const char *) override final;
 
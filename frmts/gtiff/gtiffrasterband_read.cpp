@@ -21,6 +21,7 @@
 #include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "cpl_vsi_virtual.h"
 #include "fetchbufferdirectio.h"
@@ -726,6 +727,41 @@ int GTiffRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize,
     return nStatus;
 }
 
+/************************************************************************/
+/*                  GetPersistentBlockCacheIdentity()                   */
+/************************************************************************/
+
+bool GTiffRasterBand::GetPersistentBlockCacheIdentity(std::string &osFilename,
+                                                      std::string &osIdentity)
+{
+    // Overviews and masks have no description, but are identified within
+    // the file by the offset of their IFD.
+    if (m_poGDS->eAccess != GA_ReadOnly || m_poGDS->m_bStreamingIn ||
+        m_poGDS->m_pszFilename == nullptr)
+    {
+        return false;
+    }
+    osFilename = m_poGDS->m_pszFilename;
+    osIdentity = CPLSPrintf("GTiff:" CPL_FRMT_GUIB ":%d",
+                            static_cast<GUIntBig>(m_poGDS->m_nDirOffset),
+                            nBand);
+    if (m_poGDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+    {
+        osIdentity += ":CONVERT_YCBCR_TO_RGB=";
+        osIdentity += CPLGetConfigOption("CONVERT_YCBCR_TO_RGB", "YES");
+    }
+    // Open options are only set on the main dataset
+    const GTiffDataset *poMainDS = m_poGDS;
+    while (poMainDS->m_poBaseDS)
+        poMainDS = poMainDS->m_poBaseDS;
+    for (const char *pszOption : cpl::Iterate(poMainDS->GetOpenOptions()))
+    {
+        osIdentity += ',';
+        osIdentity += pszOption;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                             IReadBlock()                             */
 /************************************************************************/
@@ -735,6 +771,15 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
 {
     m_poGDS->Crystalize();
 
+    // The block may have been decoded in the background by
+    // ScheduleReadAhead()
+    if (m_poGDS->WaitReadAhead(nBand, nBlockXOff, nBlockYOff, pImage))
+    {
+        m_poGDS->ScheduleReadAhead(nBlockXOff, nBlockXOff, nBlockYOff,
+                                   nBlockYOff, 0, nullptr);
+        return CE_None;
+    }
+
     GPtrDiff_t nBlockBufSize = 0;
     if (TIFFIsTiled(m_poGDS->m_hTIFF))
     {
@@ -831,20 +876,17 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
         }
 
         bool bDoCopyWords = true;
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
         if (nBand == 1 && !m_poGDS->m_bLoadingOtherBands &&
-            eAccess == GA_ReadOnly &&
-            (m_poGDS->nBands == 3 || m_poGDS->nBands == 4) &&
-            ((eDataType == GDT_Byte && m_poGDS->m_nBitsPerSample == 8) ||
-             (eDataType == GDT_Int16 && m_poGDS->m_nBitsPerSample == 16) ||
-             (eDataType == GDT_UInt16 && m_poGDS->m_nBitsPerSample == 16)) &&
-            static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize *
-                    GDALGetDataTypeSizeBytes(eDataType) <
+            eAccess == GA_ReadOnly && m_poGDS->nBands >= 3 &&
+            (nDTSize == 1 || nDTSize == 2 || nDTSize == 4 || nDTSize == 8) &&
+            m_poGDS->m_nBitsPerSample == nDTSize * 8 &&
+            static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize * nDTSize <
                 GDALGetCacheMax64() / m_poGDS->nBands)
         {
             bDoCopyWords = false;
-            void *ppDestBuffers[4];
-            GDALRasterBlock *apoLockedBlocks[4] = {nullptr, nullptr, nullptr,
-                                                   nullptr};
+            std::vector<void *> ppDestBuffers(m_poGDS->nBands);
+            std::vector<GDALRasterBlock *> apoLockedBlocks(m_poGDS->nBands);
             for (int iBand = 1; iBand <= m_poGDS->nBands; ++iBand)
             {
                 if (iBand == nBand)
@@ -868,7 +910,8 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
             if (!bDoCopyWords)
             {
                 GDALDeinterleave(m_poGDS->m_pabyBlockBuf, eDataType,
-                                 m_poGDS->nBands, ppDestBuffers, eDataType,
+                                 m_poGDS->nBands, ppDestBuffers.data(),
+                                 eDataType,
                                  static_cast<size_t>(nBlockXSize) *
                                      nBlockYSize);
             }
@@ -897,6 +940,12 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
 
     CacheMaskForBlock(nBlockXOff, nBlockYOff);
 
+    if (eErr == CE_None && !m_poGDS->m_bLoadingOtherBands)
+    {
+        m_poGDS->ScheduleReadAhead(nBlockXOff, nBlockXOff, nBlockYOff,
+                                   nBlockYOff, 0, nullptr);
+    }
+
     return eErr;
 }
 
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include "cpl_vsi_virtual.h"
 #include "gdal_priv_templates.hpp"
@@ -70,61 +71,50 @@ CPLErr GTiffRasterBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
     /* -------------------------------------------------------------------- */
     /*      Handle case of pixel interleaved (PLANARCONFIG_CONTIG) images.  */
     /* -------------------------------------------------------------------- */
-    // Why 10 ? Somewhat arbitrary
-    constexpr int MAX_BANDS_FOR_DIRTY_CHECK = 10;
-    GDALRasterBlock *apoBlocks[MAX_BANDS_FOR_DIRTY_CHECK] = {};
     const int nBands = m_poGDS->nBands;
-    bool bAllBlocksDirty = false;
+    std::vector<GDALRasterBlock *> apoBlocks(nBands);
+    bool bAllBlocksDirty = true;
 
     /* -------------------------------------------------------------------- */
     /*     If all blocks are cached and dirty then we do not need to reload */
     /*     the tile/strip from disk                                         */
     /* -------------------------------------------------------------------- */
-    if (nBands <= MAX_BANDS_FOR_DIRTY_CHECK)
+    for (int iBand = 0; iBand < nBands; ++iBand)
     {
-        bAllBlocksDirty = true;
-        for (int iBand = 0; iBand < nBands; ++iBand)
+        if (iBand + 1 != nBand)
         {
-            if (iBand + 1 != nBand)
-            {
-                apoBlocks[iBand] =
-                    cpl::down_cast<GTiffRasterBand *>(
-                        m_poGDS->GetRasterBand(iBand + 1))
-                        ->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            apoBlocks[iBand] =
+                cpl::down_cast<GTiffRasterBand *>(
+                    m_poGDS->GetRasterBand(iBand + 1))
+                    ->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
 
-                if (apoBlocks[iBand] == nullptr)
-                {
-                    bAllBlocksDirty = false;
-                }
-                else if (!apoBlocks[iBand]->GetDirty())
-                {
-                    apoBlocks[iBand]->DropLock();
-                    apoBlocks[iBand] = nullptr;
-                    bAllBlocksDirty = false;
-                }
+            if (apoBlocks[iBand] == nullptr)
+            {
+                bAllBlocksDirty = false;
             }
-            else
+            else if (!apoBlocks[iBand]->GetDirty())
+            {
+                apoBlocks[iBand]->DropLock();
                 apoBlocks[iBand] = nullptr;
+                bAllBlocksDirty = false;
+            }
         }
+    }
 #if DEBUG_VERBOSE
-        if (bAllBlocksDirty)
-            CPLDebug("GTIFF", "Saved reloading block %d", nBlockId);
-        else
-            CPLDebug("GTIFF", "Must reload block %d", nBlockId);
+    if (bAllBlocksDirty)
+        CPLDebug("GTIFF", "Saved reloading block %d", nBlockId);
+    else
+        CPLDebug("GTIFF", "Must reload block %d", nBlockId);
 #endif
-    }
 
     {
         const CPLErr eErr = m_poGDS->LoadBlockBuf(nBlockId, !bAllBlocksDirty);
         if (eErr != CE_None)
         {
-            if (nBands <= MAX_BANDS_FOR_DIRTY_CHECK)
+            for (int iBand = 0; iBand < nBands; ++iBand)
             {
-                for (int iBand = 0; iBand < nBands; ++iBand)
-                {
-                    if (apoBlocks[iBand] != nullptr)
-                        apoBlocks[iBand]->DropLock();
-                }
+                if (apoBlocks[iBand] != nullptr)
+                    apoBlocks[iBand]->DropLock();
             }
             return eErr;
         }
@@ -137,6 +127,37 @@ CPLErr GTiffRasterBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
     /* -------------------------------------------------------------------- */
     const int nWordBytes = m_poGDS->m_nBitsPerSample / 8;
 
+    if (bAllBlocksDirty && nBands >= 3 &&
+        m_poGDS->m_nBitsPerSample == nWordBytes * 8 &&
+        GDALGetDataTypeSizeBytes(eDataType) == nWordBytes)
+    {
+        // All bands are available: interleave them in a single pass.
+        std::vector<const void *> apabySrc(nBands);
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            apabySrc[iBand] = iBand + 1 == nBand
+                                  ? pImage
+                                  : apoBlocks[iBand]->GetDataRef();
+        }
+        GDALInterleave(apabySrc.data(), eDataType, nBands,
+                       m_poGDS->m_pabyBlockBuf, eDataType,
+                       static_cast<size_t>(nBlockXSize) * nBlockYSize);
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            if (apoBlocks[iBand] != nullptr)
+            {
+                apoBlocks[iBand]->MarkClean();
+                apoBlocks[iBand]->DropLock();
+            }
+        }
+
+        // We can synchronously write the block now.
+        const CPLErr eErr = m_poGDS->WriteEncodedTileOrStrip(
+            nBlockId, m_poGDS->m_pabyBlockBuf, true);
+        m_poGDS->m_bLoadedBlockDirty = false;
+        return eErr;
+    }
+
     for (int iBand = 0; iBand < nBands; ++iBand)
     {
         const GByte *pabyThisImage = nullptr;
@@ -148,22 +169,10 @@ CPLErr GTiffRasterBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
         }
         else
         {
-            if (nBands <= MAX_BANDS_FOR_DIRTY_CHECK)
-                poBlock = apoBlocks[iBand];
-            else
-                poBlock = cpl::down_cast<GTiffRasterBand *>(
-                              m_poGDS->GetRasterBand(iBand + 1))
-                              ->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
-
+            poBlock = apoBlocks[iBand];
             if (poBlock == nullptr)
                 continue;
 
-            if (!poBlock->GetDirty())
-            {
-                poBlock->DropLock();
-                continue;
-            }
-
             pabyThisImage = static_cast<GByte *>(poBlock->GetDataRef());
         }
 
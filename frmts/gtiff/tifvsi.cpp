@@ -86,6 +86,12 @@ struct GDALTiffHandle
     void **ppCachedData;
     vsi_l_offset *panCachedOffsets;
     size_t *panCachedSizes;
+
+    // See VSI_TIFFSetDeferredWrite()
+    const void *pDeferredWriteBuffer;
+    size_t nDeferredWriteSize;
+    bool bDeferredWriteDone;
+    vsi_l_offset nDeferredWriteOffset;
 };
 
 static bool GTHFlushBuffer(thandle_t th);
@@ -170,6 +176,34 @@ static tsize_t _tiffWriteProc(thandle_t th, tdata_t buf, tsize_t size)
     GDALTiffHandle *psGTH = reinterpret_cast<GDALTiffHandle *>(th);
     SetActiveGTH(psGTH);
 
+    // Deferred write: just reserve room in the file for the data, which will
+    // be written by the caller with PWrite().
+    if (psGTH->pDeferredWriteBuffer == buf &&
+        static_cast<size_t>(size) == psGTH->nDeferredWriteSize)
+    {
+        psGTH->pDeferredWriteBuffer = nullptr;
+        if (!GTHFlushBuffer(th))
+            return 0;
+        VSILFILE *fpL = psGTH->psShared->fpL;
+        const vsi_l_offset nOffset = VSIFTellL(fpL);
+        // When appending, physically extend the file, so that later
+        // SEEK_END do not return a position inside the reserved area.
+        if ((psGTH->psShared->bAtEndOfFile &&
+             VSIFTruncateL(fpL, nOffset + size) != 0) ||
+            VSIFSeekL(fpL, nOffset + size, SEEK_SET) != 0)
+        {
+            TIFFErrorExt(th, "_tiffWriteProc", "%s", VSIStrerror(errno));
+            return 0;
+        }
+        if (psGTH->psShared->bAtEndOfFile)
+        {
+            psGTH->psShared->nFileLength += size;
+        }
+        psGTH->bDeferredWriteDone = true;
+        psGTH->nDeferredWriteOffset = nOffset;
+        return size;
+    }
+
     // If we have a write buffer and are at end of file, then accumulate
     // the bytes until the buffer is full.
     if (psGTH->psShared->bAtEndOfFile && psGTH->abyWriteBuffer)
@@ -387,6 +421,25 @@ void VSI_TIFFSetCachedRanges(thandle_t th, int nRanges, void **ppData,
     }
 }
 
+void VSI_TIFFSetDeferredWrite(thandle_t th, const void *pBuffer, size_t nSize)
+{
+    GDALTiffHandle *psGTH = reinterpret_cast<GDALTiffHandle *>(th);
+    psGTH->pDeferredWriteBuffer = pBuffer;
+    psGTH->nDeferredWriteSize = nSize;
+    psGTH->bDeferredWriteDone = false;
+    psGTH->nDeferredWriteOffset = 0;
+}
+
+bool VSI_TIFFGetDeferredWriteOffset(thandle_t th, vsi_l_offset *pnOffset)
+{
+    GDALTiffHandle *psGTH = reinterpret_cast<GDALTiffHandle *>(th);
+    const bool bDone = psGTH->bDeferredWriteDone;
+    *pnOffset = psGTH->nDeferredWriteOffset;
+    psGTH->pDeferredWriteBuffer = nullptr;
+    psGTH->bDeferredWriteDone = false;
+    return bDone;
+}
+
 static bool IsReadOnly(const char *mode)
 {
     bool bReadOnly = true;
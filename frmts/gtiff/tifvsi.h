@@ -36,4 +36,12 @@ void VSI_TIFFSetCachedRanges(
     const vsi_l_offset *panOffsets, const size_t *panSizes);
 void *VSI_TIFFGetCachedRange(thandle_t th, vsi_l_offset nOffset, size_t nSize);
 
+// The next write of exactly (pBuffer, nSize) issued by libtiff will not be
+// done, but room for it will be reserved in the file. The caller is then
+// responsible for writing the data, typically with VSIVirtualHandle::PWrite(),
+// at the offset returned by VSI_TIFFGetDeferredWriteOffset().
+void VSI_TIFFSetDeferredWrite(thandle_t th, const void *pBuffer, size_t nSize);
+// Returns false if the deferred write did not happen.
+bool VSI_TIFFGetDeferredWriteOffset(thandle_t th, vsi_l_offset *pnOffset);
+
 #endif  // TIFVSI_H_INCLUDED
@@ -87,9 +87,47 @@ struct LIBERTIFFDatasetFileReader final : public LIBERTIFF_NS::FileReader
         m_bPReadAllowed = true;
     }
 
+    int readMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) const
+    {
+        std::lock_guard oLock(m_oMutex);
+        return m_fp->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
+    }
+
     CPL_DISALLOW_COPY_ASSIGN(LIBERTIFFDatasetFileReader)
 };
 
+/************************************************************************/
+/*                     LIBERTIFFPrefetchedStriles                       */
+/************************************************************************/
+
+// Byte ranges fetched by IRasterIO() with a single ReadMultiRange() call,
+// from which ReadBlock() takes the striles it needs instead of reading them
+// one by one.
+struct LIBERTIFFPrefetchedStriles
+{
+    // Sorted and non-overlapping ranges
+    std::vector<vsi_l_offset> m_anOffsets{};
+    std::vector<size_t> m_anSizes{};
+    // Offset of each range in m_abyBuffer
+    std::vector<size_t> m_anBufferOffsets{};
+    std::vector<GByte> m_abyBuffer{};
+
+    const GByte *get(uint64_t offset, size_t size) const
+    {
+        const auto iter =
+            std::upper_bound(m_anOffsets.begin(), m_anOffsets.end(), offset);
+        if (iter == m_anOffsets.begin())
+            return nullptr;
+        const size_t i = static_cast<size_t>(iter - m_anOffsets.begin()) - 1;
+        if (offset - m_anOffsets[i] + size > m_anSizes[i])
+            return nullptr;
+        return m_abyBuffer.data() + m_anBufferOffsets[i] +
+               static_cast<size_t>(offset - m_anOffsets[i]);
+    }
+};
+
 /************************************************************************/
 /*                         LIBERTIFFDataset                             */
 /************************************************************************/
@@ -176,6 +214,7 @@ class LIBERTIFFDataset final : public GDALPamDataset
     int m_lercAdditionalCompression = LERC_ADD_COMPRESSION_NONE;
     std::vector<uint16_t> m_extraSamples{};
     CPLWorkerThreadPool *m_poThreadPool = nullptr;
+    bool m_bHasOptimizedReadMultiRange = false;
 
     struct ThreadLocalState
     {
@@ -228,10 +267,21 @@ class LIBERTIFFDataset final : public GDALPamDataset
     void ReadGeoTransform();
     void ReadRPCTag();
 
+    uint64_t GetStrileIdx(int nBlockXOff, int nBlockYOff, int iBandTIFF) const;
+    bool GetStrileLocation(uint64_t curStrileIdx, uint64_t &offset,
+                           size_t &size) const;
+
+    void PrefetchStriles(int iXBlockMin, int iXBlockMax, int iYBlockMin,
+                         int &iYBlockMax, int nBandCount,
+                         BANDMAP_TYPE panBandMap,
+                         LIBERTIFFPrefetchedStriles &oPrefetched) const;
+
     bool ReadBlock(GByte *pabyBlockData, int nBlockXOff, int nBlockYOff,
                    int nBandCount, BANDMAP_TYPE panBandMap,
                    GDALDataType eBufType, GSpacing nPixelSpace,
-                   GSpacing nLineSpace, GSpacing nBandSpace) const;
+                   GSpacing nLineSpace, GSpacing nBandSpace,
+                   const LIBERTIFFPrefetchedStriles *poPrefetched =
+                       nullptr) const;
 
     CPL_DISALLOW_COPY_ASSIGN(LIBERTIFFDataset)
 };
@@ -880,28 +930,82 @@ CPLErr LIBERTIFFDataset::IRasterIO(
     }
     std::atomic<bool> bSuccess(true);
 
-    for (int iYBlock = iYBlockMin, iY = 0; iYBlock < iYBlockMax && bSuccess;
-         ++iYBlock, ++iY)
+    // When the file system can fetch several ranges efficiently in one go
+    // (typically network file systems), read the striles of all the blocks
+    // (or of batches of block rows) up-front, and then decode them from
+    // memory.
+    const bool bPrefetch =
+        m_bHasOptimizedReadMultiRange && m_fileReader &&
+        (iYBlockMax - iYBlockMin) * (iXBlockMax - iXBlockMin) *
+                (bIsSeparate ? nBandCount : 1) >
+            1;
+    LIBERTIFFPrefetchedStriles oPrefetched;
+
+    for (int iYBlockBatchMin = iYBlockMin, iYBlockBatchMax = iYBlockMax;
+         iYBlockBatchMin < iYBlockMax && bSuccess;
+         iYBlockBatchMin = iYBlockBatchMax, iYBlockBatchMax = iYBlockMax)
     {
-        for (int iXBlock = iXBlockMin, iX = 0; iXBlock < iXBlockMax && bSuccess;
-             ++iXBlock, ++iX)
+        if (bPrefetch)
+        {
+            PrefetchStriles(iXBlockMin, iXBlockMax, iYBlockBatchMin,
+                            iYBlockBatchMax, nBandCount, panBandMap,
+                            oPrefetched);
+        }
+        const LIBERTIFFPrefetchedStriles *poPrefetched =
+            oPrefetched.m_anOffsets.empty() ? nullptr : &oPrefetched;
+
+        for (int iYBlock = iYBlockBatchMin;
+             iYBlock < iYBlockBatchMax && bSuccess; ++iYBlock)
         {
-            if (bIsSeparate)
+            const int iY = iYBlock - iYBlockMin;
+            for (int iXBlock = iXBlockMin, iX = 0;
+                 iXBlock < iXBlockMax && bSuccess; ++iXBlock, ++iX)
             {
-                for (int iBand = 0; iBand < nBandCount; ++iBand)
+                if (bIsSeparate)
                 {
-                    const auto lambda = [this, &bSuccess, iBand, panBandMap,
-                                         pData, iY, nLineSpace, nBlockYSize, iX,
-                                         nPixelSpace, nBlockXSize, nBandSpace,
-                                         iXBlock, iYBlock, eBufType]()
+                    for (int iBand = 0; iBand < nBandCount; ++iBand)
+                    {
+                        const auto lambda =
+                            [this, &bSuccess, iBand, panBandMap, pData, iY,
+                             nLineSpace, nBlockYSize, iX, nPixelSpace,
+                             nBlockXSize, nBandSpace, iXBlock, iYBlock,
+                             eBufType, poPrefetched]()
+                        {
+                            int anBand[] = {panBandMap[iBand]};
+                            if (!ReadBlock(static_cast<GByte *>(pData) +
+                                               iY * nLineSpace * nBlockYSize +
+                                               iX * nPixelSpace * nBlockXSize +
+                                               iBand * nBandSpace,
+                                           iXBlock, iYBlock, 1, anBand,
+                                           eBufType, nPixelSpace, nLineSpace,
+                                           nBandSpace, poPrefetched))
+                            {
+                                bSuccess = false;
+                            }
+                        };
+                        if (poQueue)
+                        {
+                            poQueue->SubmitJob(lambda);
+                        }
+                        else
+                        {
+                            lambda();
+                        }
+                    }
+                }
+                else
+                {
+                    const auto lambda =
+                        [this, &bSuccess, nBandCount, panBandMap, pData, iY,
+                         nLineSpace, nBlockYSize, iX, nPixelSpace, nBlockXSize,
+                         nBandSpace, iXBlock, iYBlock, eBufType, poPrefetched]()
                     {
-                        int anBand[] = {panBandMap[iBand]};
                         if (!ReadBlock(static_cast<GByte *>(pData) +
                                            iY * nLineSpace * nBlockYSize +
-                                           iX * nPixelSpace * nBlockXSize +
-                                           iBand * nBandSpace,
-                                       iXBlock, iYBlock, 1, anBand, eBufType,
-                                       nPixelSpace, nLineSpace, nBandSpace))
+                                           iX * nPixelSpace * nBlockXSize,
+                                       iXBlock, iYBlock, nBandCount, panBandMap,
+                                       eBufType, nPixelSpace, nLineSpace,
+                                       nBandSpace, poPrefetched))
                         {
                             bSuccess = false;
                         }
@@ -916,33 +1020,12 @@ CPLErr LIBERTIFFDataset::IRasterIO(
                     }
                 }
             }
-            else
-            {
-                const auto lambda = [this, &bSuccess, nBandCount, panBandMap,
-                                     pData, iY, nLineSpace, nBlockYSize, iX,
-                                     nPixelSpace, nBlockXSize, nBandSpace,
-                                     iXBlock, iYBlock, eBufType]()
-                {
-                    if (!ReadBlock(static_cast<GByte *>(pData) +
-                                       iY * nLineSpace * nBlockYSize +
-                                       iX * nPixelSpace * nBlockXSize,
-                                   iXBlock, iYBlock, nBandCount, panBandMap,
-                                   eBufType, nPixelSpace, nLineSpace,
-                                   nBandSpace))
-                    {
-                        bSuccess = false;
-                    }
-                };
-                if (poQueue)
-                {
-                    poQueue->SubmitJob(lambda);
-                }
-                else
-                {
-                    lambda();
-                }
-            }
         }
+
+        // Wait for the jobs of this batch before the prefetched buffer is
+        // overwritten by the next one.
+        if (poQueue && bPrefetch)
+            poQueue->WaitCompletion();
     }
 
     if (poQueue)
@@ -1162,82 +1245,245 @@ FloatingPointHorizPredictorDecode(std::vector<uint8_t> &tmpBuffer,
 }
 
 /************************************************************************/
-/*                           ReadBlock()                                */
+/*                            GetStrileIdx()                            */
 /************************************************************************/
 
-bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
-                                 int nBlockYOff, int nBandCount,
-                                 BANDMAP_TYPE panBandMap, GDALDataType eBufType,
-                                 GSpacing nPixelSpace, GSpacing nLineSpace,
-                                 GSpacing nBandSpace) const
+uint64_t LIBERTIFFDataset::GetStrileIdx(int nBlockXOff, int nBlockYOff,
+                                        int iBandTIFF) const
 {
-    uint64_t offset = 0;
-    size_t size = 0;
-    const bool bSeparate = m_image->planarConfiguration() ==
-                           LIBERTIFF_NS::PlanarConfiguration::Separate;
-
-    ThreadLocalState &tlsState = GetTLSState();
-
-    const int iBandTIFFFirst = bSeparate ? panBandMap[0] - 1 : 0;
-    uint64_t curStrileIdx;
     if (m_image->isTiled())
     {
         bool ok = true;
-        curStrileIdx = m_image->tileCoordinateToIdx(nBlockXOff, nBlockYOff,
-                                                    iBandTIFFFirst, ok);
+        return m_image->tileCoordinateToIdx(nBlockXOff, nBlockYOff, iBandTIFF,
+                                            ok);
+    }
+    else if (m_image->planarConfiguration() ==
+             LIBERTIFF_NS::PlanarConfiguration::Separate)
+    {
+        return nBlockYOff +
+               DIV_ROUND_UP(m_image->height(),
+                            m_image->rowsPerStripSanitized()) *
+                   iBandTIFF;
     }
     else
     {
-        if (bSeparate)
-            curStrileIdx =
-                nBlockYOff + DIV_ROUND_UP(m_image->height(),
-                                          m_image->rowsPerStripSanitized()) *
-                                 iBandTIFFFirst;
-        else
-            curStrileIdx = nBlockYOff;
+        return nBlockYOff;
     }
-    if (curStrileIdx != tlsState.m_curStrileIdx)
+}
+
+/************************************************************************/
+/*                         GetStrileLocation()                          */
+/************************************************************************/
+
+bool LIBERTIFFDataset::GetStrileLocation(uint64_t curStrileIdx,
+                                         uint64_t &offset, size_t &size) const
+{
+    bool ok = true;
+    offset = curStrileIdx < m_tileOffsets.size()
+                 ? m_tileOffsets[static_cast<size_t>(curStrileIdx)]
+             : curStrileIdx < m_tileOffsets64.size()
+                 ? m_tileOffsets64[static_cast<size_t>(curStrileIdx)]
+                 : m_image->strileOffset(curStrileIdx, ok);
+    if (!ok)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile offset");
+        return false;
+    }
+    const uint64_t size64 =
+        curStrileIdx < m_tileByteCounts.size()
+            ? m_tileByteCounts[static_cast<size_t>(curStrileIdx)]
+            : m_image->strileByteCount(curStrileIdx, ok);
+    if (!ok)
     {
-        bool ok = true;
-        offset = curStrileIdx < m_tileOffsets.size()
-                     ? m_tileOffsets[static_cast<size_t>(curStrileIdx)]
-                 : curStrileIdx < m_tileOffsets64.size()
-                     ? m_tileOffsets64[static_cast<size_t>(curStrileIdx)]
-                     : m_image->strileOffset(curStrileIdx, ok);
-        if (!ok)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile offset");
-            return false;
-        }
-        const uint64_t size64 =
-            curStrileIdx < m_tileByteCounts.size()
-                ? m_tileByteCounts[static_cast<size_t>(curStrileIdx)]
-                : m_image->strileByteCount(curStrileIdx, ok);
-        if (!ok)
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile size");
+        return false;
+    }
+
+    if constexpr (sizeof(size_t) < sizeof(uint64_t))
+    {
+        if (size64 > std::numeric_limits<size_t>::max() - 1)
         {
-            CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile size");
+            CPLError(CE_Failure, CPLE_NotSupported, "Too large strile");
             return false;
         }
+    }
+    size = static_cast<size_t>(size64);
+    // Avoid doing non-sensical memory allocations
+    constexpr size_t THRESHOLD_CHECK_FILE_SIZE = 10 * 1024 * 1024;
+    if (size > THRESHOLD_CHECK_FILE_SIZE &&
+        size > m_image->readContext()->size())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Strile size larger than file size");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          PrefetchStriles()                           */
+/************************************************************************/
+
+// Fetch the striles of blocks [iXBlockMin, iXBlockMax[ x
+// [iYBlockMin, iYBlockMax[ with a single ReadMultiRange() call, merging
+// close ranges. iYBlockMax may be reduced to honour the
+// GDAL_MAX_RAW_BLOCK_CACHE_SIZE memory budget, in which case the caller is
+// expected to call this method again for the remaining block rows.
+// On failure, oPrefetched is left empty and ReadBlock() will read striles
+// individually (and report errors if any).
+void LIBERTIFFDataset::PrefetchStriles(
+    int iXBlockMin, int iXBlockMax, int iYBlockMin, int &iYBlockMax,
+    int nBandCount, BANDMAP_TYPE panBandMap,
+    LIBERTIFFPrefetchedStriles &oPrefetched) const
+{
+    oPrefetched = LIBERTIFFPrefetchedStriles();
+
+    const bool bSeparate = m_image->planarConfiguration() ==
+                           LIBERTIFF_NS::PlanarConfiguration::Separate;
+    const int nStrilesPerBlock = bSeparate ? nBandCount : 1;
+    const uint64_t nMaxTotalSize = static_cast<uint64_t>(std::max(
+        0, atoi(CPLGetConfigOption("GDAL_MAX_RAW_BLOCK_CACHE_SIZE",
+                                   "10485760"))));
 
-        if constexpr (sizeof(size_t) < sizeof(uint64_t))
+    std::vector<std::pair<uint64_t, size_t>> aOffsetSize;
+    uint64_t nTotalSize = 0;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        for (int iYBlock = iYBlockMin; iYBlock < iYBlockMax; ++iYBlock)
         {
-            if (size64 > std::numeric_limits<size_t>::max() - 1)
+            for (int iXBlock = iXBlockMin; iXBlock < iXBlockMax; ++iXBlock)
             {
-                CPLError(CE_Failure, CPLE_NotSupported, "Too large strile");
-                return false;
+                for (int i = 0; i < nStrilesPerBlock; ++i)
+                {
+                    const uint64_t curStrileIdx = GetStrileIdx(
+                        iXBlock, iYBlock, bSeparate ? panBandMap[i] - 1 : 0);
+                    uint64_t offset = 0;
+                    size_t size = 0;
+                    if (!GetStrileLocation(curStrileIdx, offset, size))
+                        return;
+                    // Sparse striles are not read
+                    if (size > 0)
+                    {
+                        aOffsetSize.emplace_back(offset, size);
+                        nTotalSize += size;
+                    }
+                }
+            }
+            // Always fetch at least one block row
+            if (nTotalSize >= nMaxTotalSize)
+            {
+                iYBlockMax = iYBlock + 1;
+                break;
             }
         }
-        size = static_cast<size_t>(size64);
-        // Avoid doing non-sensical memory allocations
-        constexpr size_t THRESHOLD_CHECK_FILE_SIZE = 10 * 1024 * 1024;
-        if (size > THRESHOLD_CHECK_FILE_SIZE &&
-            size > m_image->readContext()->size())
+    }
+    if (aOffsetSize.size() < 2)
+        return;
+
+    // Merge ranges that are contiguous or separated by a small gap: the
+    // ghost leader and trailer of COG tiles typically leave a few bytes
+    // between consecutive tiles, and re-reading them is much cheaper than
+    // an extra network request.
+    constexpr uint64_t MAX_GAP = 16384;
+    std::sort(aOffsetSize.begin(), aOffsetSize.end());
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<uint64_t> anSizes64;
+    for (const auto &[offset, size] : aOffsetSize)
+    {
+        if (!anOffsets.empty() &&
+            offset <= anOffsets.back() + anSizes64.back() + MAX_GAP)
         {
-            CPLError(CE_Failure, CPLE_NotSupported,
-                     "Strile size larger than file size");
-            return false;
+            anSizes64.back() =
+                std::max<uint64_t>(anOffsets.back() + anSizes64.back(),
+                                   offset + size) -
+                anOffsets.back();
         }
+        else
+        {
+            anOffsets.push_back(offset);
+            anSizes64.push_back(size);
+        }
+    }
+
+    uint64_t nBufferSize = 0;
+    for (const uint64_t nSize : anSizes64)
+        nBufferSize += nSize;
+    if (nBufferSize > std::numeric_limits<size_t>::max() / 2)
+        return;
+
+    try
+    {
+        oPrefetched.m_abyBuffer.resize(static_cast<size_t>(nBufferSize));
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+
+    std::vector<void *> apData;
+    size_t nBufferOffset = 0;
+    for (const uint64_t nSize : anSizes64)
+    {
+        oPrefetched.m_anSizes.push_back(static_cast<size_t>(nSize));
+        oPrefetched.m_anBufferOffsets.push_back(nBufferOffset);
+        apData.push_back(oPrefetched.m_abyBuffer.data() + nBufferOffset);
+        nBufferOffset += static_cast<size_t>(nSize);
     }
+    oPrefetched.m_anOffsets = std::move(anOffsets);
+
+    CPLDebugOnly("LIBERTIFF",
+                 "Fetching %d striles in %d ranges (" CPL_FRMT_GUIB " bytes)",
+                 static_cast<int>(aOffsetSize.size()),
+                 static_cast<int>(apData.size()),
+                 static_cast<GUIntBig>(nBufferSize));
+    if (m_fileReader->readMultiRange(
+            static_cast<int>(apData.size()), apData.data(),
+            oPrefetched.m_anOffsets.data(), oPrefetched.m_anSizes.data()) != 0)
+    {
+        oPrefetched = LIBERTIFFPrefetchedStriles();
+    }
+}
+
+/************************************************************************/
+/*                           ReadBlock()                                */
+/************************************************************************/
+
+bool LIBERTIFFDataset::ReadBlock(
+    GByte *pabyBlockData, int nBlockXOff, int nBlockYOff, int nBandCount,
+    BANDMAP_TYPE panBandMap, GDALDataType eBufType, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace,
+    const LIBERTIFFPrefetchedStriles *poPrefetched) const
+{
+    uint64_t offset = 0;
+    size_t size = 0;
+    const bool bSeparate = m_image->planarConfiguration() ==
+                           LIBERTIFF_NS::PlanarConfiguration::Separate;
+
+    ThreadLocalState &tlsState = GetTLSState();
+
+    const int iBandTIFFFirst = bSeparate ? panBandMap[0] - 1 : 0;
+    const uint64_t curStrileIdx =
+        GetStrileIdx(nBlockXOff, nBlockYOff, iBandTIFFFirst);
+    if (curStrileIdx != tlsState.m_curStrileIdx)
+    {
+        if (!GetStrileLocation(curStrileIdx, offset, size))
+            return false;
+    }
+
+    // Read the strile, either from the prefetched ranges or from the file
+    const auto ReadStrile = [this, poPrefetched, offset, size](GByte *pabyDst)
+    {
+        const GByte *pabyPrefetched =
+            poPrefetched ? poPrefetched->get(offset, size) : nullptr;
+        if (pabyPrefetched)
+        {
+            memcpy(pabyDst, pabyPrefetched, size);
+            return true;
+        }
+        bool ok = true;
+        m_image->readContext()->read(offset, size, pabyDst, ok);
+        return ok;
+    };
 
     const GDALDataType eNativeDT = papoBands[0]->GetRasterDataType();
     int nBlockXSize, nBlockYSize;
@@ -1341,10 +1587,7 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
                 }
             }
 
-            bool ok = true;
-            m_image->readContext()->read(offset, size,
-                                         abyCompressedStrile.data(), ok);
-            if (!ok)
+            if (!ReadStrile(abyCompressedStrile.data()))
             {
                 CPLError(CE_Failure, CPLE_FileIO,
                          "Cannot read strile from disk");
@@ -1541,10 +1784,7 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
                 return false;
             }
 
-            bool ok = true;
-            m_image->readContext()->read(offset, size,
-                                         abyDecompressedStrile.data(), ok);
-            if (!ok)
+            if (!ReadStrile(abyDecompressedStrile.data()))
             {
                 CPLError(CE_Failure, CPLE_FileIO,
                          "Cannot read strile from disk");
@@ -2367,11 +2607,15 @@ bool LIBERTIFFDataset::Open(GDALOpenInfo *poOpenInfo)
         }
         m_fileReader =
             std::make_shared<const LIBERTIFFDatasetFileReader>(m_poFile.get());
+        m_bHasOptimizedReadMultiRange =
+            VSIHasOptimizedReadMultiRange(pszNextColon + 1) != FALSE;
     }
     else
     {
         m_fileReader =
             std::make_shared<const LIBERTIFFDatasetFileReader>(poOpenInfo->fpL);
+        m_bHasOptimizedReadMultiRange =
+            VSIHasOptimizedReadMultiRange(poOpenInfo->pszFilename) != FALSE;
     }
 
     auto mainImage = LIBERTIFF_NS::open(m_fileReader);
@@ -2878,6 +3122,23 @@ bool LIBERTIFFDataset::Open(GDALOpenInfo *poOpenInfo)
         }
     }
 
+    // Overview and mask datasets read from the same file
+    const auto ShareFileSettings = [this](LIBERTIFFDataset *poOtherDS)
+    {
+        poOtherDS->m_fileReader = m_fileReader;
+        poOtherDS->m_bHasOptimizedReadMultiRange =
+            m_bHasOptimizedReadMultiRange;
+        poOtherDS->m_poThreadPool = m_poThreadPool;
+    };
+    for (auto &poOvrDS : m_apoOvrDSOwned)
+    {
+        ShareFileSettings(poOvrDS.get());
+        if (poOvrDS->m_poMaskDS)
+            ShareFileSettings(poOvrDS->m_poMaskDS.get());
+    }
+    if (m_poMaskDS)
+        ShareFileSettings(m_poMaskDS.get());
+
     return true;
 }
 
@@ -3491,6 +3491,8 @@ void MBTilesDataset::ParseCompressionOptions(char **papszOptions)
     const char *pszDither = CSLFetchNameValue(papszOptions, "DITHER");
     if (pszDither)
         m_bDither = CPLTestBool(pszDither);
+
+    ParseNumThreadsOption(papszOptions);
 }
 
 /************************************************************************/
@@ -3726,7 +3728,10 @@ void GDALRegister_MBTiles()
     "description='DEFLATE compression level for PNG tiles' default='6'/>"      \
     "  <Option name='DITHER' scope='raster' type='boolean' "                   \
     "description='Whether to apply Floyd-Steinberg dithering (for "            \
-    "TILE_FORMAT=PNG8)' default='NO'/>"
+    "TILE_FORMAT=PNG8)' default='NO'/>"                                        \
+    "  <Option name='NUM_THREADS' scope='raster' type='string' "               \
+    "description='Number of worker threads for tile encoding. Can be set "     \
+    "to ALL_CPUS' default='1'/>"
 
     poDriver->SetMetadataItem(
         GDAL_DMD_OPENOPTIONLIST,
@@ -377,32 +377,45 @@ CPLErr MEMDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             }
             return CE_None;
         }
-        else if (eRWFlag == GF_Write && nBandCount <= 4 &&
-                 IsBandSeparatedDataset())
+        else if (IsBandSeparatedDataset())
         {
-            // TODO: once we have a GDALInterleave() function, implement the
-            // GF_Read case
             FlushCache(false);
             const auto poFirstBand =
                 cpl::down_cast<MEMRasterBand *>(papoBands[0]);
             const GDALDataType eDT = poFirstBand->GetRasterDataType();
-            void *ppDestBuffer[4] = {nullptr, nullptr, nullptr, nullptr};
+            std::vector<void *> apBandBuffers(nBandCount);
+            const auto InterleaveOrDeinterleave =
+                [eRWFlag, eDT, eBufType, nBandCount,
+                 &apBandBuffers](void *pBuffer, size_t nIters)
+            {
+                if (eRWFlag == GF_Read)
+                {
+                    GDALInterleave(apBandBuffers.data(), eDT, nBandCount,
+                                   pBuffer, eBufType, nIters);
+                }
+                else
+                {
+                    GDALDeinterleave(pBuffer, eBufType, nBandCount,
+                                     apBandBuffers.data(), eDT, nIters);
+                }
+            };
             if (nXOff == 0 && nXSize == nRasterXSize &&
                 poFirstBand->nLineOffset ==
                     poFirstBand->nPixelOffset * nXSize &&
                 nLineSpaceBuf == nPixelSpaceBuf * nXSize)
             {
                 // Optimization of the general case in the below else() clause:
-                // writing whole strips from a fully packed buffer
+                // reading or writing whole strips from/to a fully packed
+                // buffer
                 for (int i = 0; i < nBandCount; ++i)
                 {
                     const auto poBand =
                         cpl::down_cast<MEMRasterBand *>(papoBands[i]);
-                    ppDestBuffer[i] =
+                    apBandBuffers[i] =
                         poBand->pabyData + poBand->nLineOffset * nYOff;
                 }
-                GDALDeinterleave(pData, eBufType, nBandCount, ppDestBuffer, eDT,
-                                 static_cast<size_t>(nXSize) * nYSize);
+                InterleaveOrDeinterleave(pData,
+                                         static_cast<size_t>(nXSize) * nYSize);
             }
             else
             {
@@ -412,14 +425,14 @@ CPLErr MEMDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     {
                         const auto poBand =
                             cpl::down_cast<MEMRasterBand *>(papoBands[i]);
-                        ppDestBuffer[i] = poBand->pabyData +
-                                          poBand->nPixelOffset * nXOff +
-                                          poBand->nLineOffset * (iLine + nYOff);
+                        apBandBuffers[i] =
+                            poBand->pabyData + poBand->nPixelOffset * nXOff +
+                            poBand->nLineOffset * (iLine + nYOff);
                     }
-                    GDALDeinterleave(
+                    InterleaveOrDeinterleave(
                         static_cast<GByte *>(pData) +
                             nLineSpaceBuf * static_cast<size_t>(iLine),
-                        eBufType, nBandCount, ppDestBuffer, eDT, nXSize);
+                        nXSize);
                 }
             }
             return CE_None;
@@ -1286,6 +1286,42 @@ CPLErr CPL_DLL CPL_STDCALL GDALDatasetRasterIOEx(
     GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 
+/** Window of a multi-range RasterIO() request.
+ *
+ * The window is read at full resolution, that is the buffer is of
+ * nXSize * nYSize pixels (per band).
+ *
+ * @see GDALDatasetMultiRangeRasterIO(), GDALRasterMultiRangeRasterIO()
+ * @since GDAL 3.12
+ */
+typedef struct
+{
+    /*! Pixel offset to the top left corner of the window */
+    int nXOff;
+    /*! Line offset to the top left corner of the window */
+    int nYOff;
+    /*! Width of the window, in pixels */
+    int nXSize;
+    /*! Height of the window, in pixels */
+    int nYSize;
+    /*! Buffer into which the values of the window are read */
+    void *pData;
+    /*! Byte offset between two consecutive pixels of a line in pData,
+     * or 0 for the size of the buffer data type */
+    GSpacing nPixelSpace;
+    /*! Byte offset between the start of two consecutive lines in pData,
+     * or 0 for nPixelSpace * nXSize */
+    GSpacing nLineSpace;
+    /*! Byte offset between the start of two consecutive bands in pData,
+     * or 0 for nLineSpace * nYSize. Ignored for single band requests */
+    GSpacing nBandSpace;
+} GDALRasterIOWindow;
+
+CPLErr CPL_DLL GDALDatasetMultiRangeRasterIO(
+    GDALDatasetH hDS, int nWindowCount, const GDALRasterIOWindow *pasWindows,
+    GDALDataType eBufType, int nBandCount,
+    const int *panBandMap) CPL_WARN_UNUSED_RESULT;
+
 CPLErr CPL_DLL CPL_STDCALL GDALDatasetAdviseRead(
     GDALDatasetH hDS, int nDSXOff, int nDSYOff, int nDSXSize, int nDSYSize,
     int nBXSize, int nBYSize, GDALDataType eBDataType, int nBandCount,
@@ -1626,6 +1662,10 @@ CPLErr CPL_DLL CPL_STDCALL GDALRasterIOEx(
     int nDSXSize, int nDSYSize, void *pBuffer, int nBXSize, int nBYSize,
     GDALDataType eBDataType, GSpacing nPixelSpace, GSpacing nLineSpace,
     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
+CPLErr CPL_DLL GDALRasterMultiRangeRasterIO(
+    GDALRasterBandH hBand, int nWindowCount,
+    const GDALRasterIOWindow *pasWindows,
+    GDALDataType eBufType) CPL_WARN_UNUSED_RESULT;
 CPLErr CPL_DLL CPL_STDCALL GDALReadBlock(GDALRasterBandH, int, int,
                                          void *) CPL_WARN_UNUSED_RESULT;
 CPLErr CPL_DLL CPL_STDCALL GDALWriteBlock(GDALRasterBandH, int, int,
@@ -1966,6 +2006,11 @@ void CPL_DLL GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
                               int nComponents, void **ppDestBuffer,
                               GDALDataType eDestDT, size_t nIters);
 
+void CPL_DLL GDALInterleave(const void *const *ppSourceBuffer,
+                            GDALDataType eSourceDT, int nComponents,
+                            void *pDestBuffer, GDALDataType eDestDT,
+                            size_t nIters);
+
 void CPL_DLL GDALTranspose2D(const void *pSrc, GDALDataType eSrcType,
                              void *pDst, GDALDataType eDstType,
                              size_t nSrcWidth, size_t nSrcHeight);
@@ -0,0 +1,206 @@
+/**********************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Persistent on-disk cache of decoded raster blocks
+ *
+ **********************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+// Each cached block is stored in its own file of a CPLDiskCache, with the
+// .blk extension. The layout of such a file is:
+// - 8 bytes: "GDALBLK1" signature
+// - uint32 (LSB): size of the key
+// - the key itself, to detect (unlikely) MD5 collisions
+// - uint64 (LSB): size of the payload
+// - payload: the decoded block, as returned by IReadBlock()
+
+#include "gdal_persistent_block_cache.h"
+
+#include "cpl_conv.h"
+#include "cpl_disk_cache.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include <string>
+
+/************************************************************************/
+/*                     GetPersistentBlockCacheDir()                     */
+/************************************************************************/
+
+static std::string GetPersistentBlockCacheDir()
+{
+    return CPLGetConfigOption("GDAL_PERSISTENT_BLOCK_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                   GetPersistentBlockCacheMaxSize()                   */
+/************************************************************************/
+
+static GIntBig GetPersistentBlockCacheMaxSize()
+{
+    return CPLDiskCache::ParseMaxSize(
+        CPLGetConfigOption("GDAL_PERSISTENT_BLOCK_CACHE_MAX_SIZE", "1GB"),
+        "GDAL_PERSISTENT_BLOCK_CACHE_MAX_SIZE");
+}
+
+/************************************************************************/
+/*                            GetDiskCache()                            */
+/************************************************************************/
+
+static CPLDiskCache &GetDiskCache()
+{
+    static CPLDiskCache goDiskCache("GDALBLK1", "blk", "GDAL");
+    return goDiskCache;
+}
+
+/************************************************************************/
+/*                  GDALPersistentBlockCacheIsEnabled()                 */
+/************************************************************************/
+
+/** Return whether GDAL_PERSISTENT_BLOCK_CACHE_DIR is set. */
+bool GDALPersistentBlockCacheIsEnabled()
+{
+    const char *pszCacheDir =
+        CPLGetConfigOption("GDAL_PERSISTENT_BLOCK_CACHE_DIR", nullptr);
+    return pszCacheDir != nullptr && pszCacheDir[0] != 0;
+}
+
+/************************************************************************/
+/*                GDALPersistentBlockCacheIsEnabledFor()                */
+/************************************************************************/
+
+/** Return whether blocks of the specified file should go through the
+ * persistent block cache, that is if GDAL_PERSISTENT_BLOCK_CACHE_DIR is
+ * set, and the file is a remote one (unless
+ * GDAL_PERSISTENT_BLOCK_CACHE_REMOTE_ONLY=NO).
+ */
+bool GDALPersistentBlockCacheIsEnabledFor(const char *pszFilename)
+{
+    if (pszFilename == nullptr || pszFilename[0] == 0 ||
+        !GDALPersistentBlockCacheIsEnabled())
+    {
+        return false;
+    }
+    if (CPLTestBool(CPLGetConfigOption(
+            "GDAL_PERSISTENT_BLOCK_CACHE_REMOTE_ONLY", "YES")) &&
+        VSIIsLocal(pszFilename))
+    {
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALPersistentBlockCacheRead()                    */
+/************************************************************************/
+
+/** Fetch the block of key osKey from the persistent block cache into pData,
+ * which must be nSize large.
+ *
+ * @return true if the block was found in the cache.
+ */
+bool GDALPersistentBlockCacheRead(const std::string &osKey, void *pData,
+                                  size_t nSize)
+{
+    const std::string osCacheDir = GetPersistentBlockCacheDir();
+    if (osCacheDir.empty())
+        return false;
+    CPLDiskCache &oDiskCache = GetDiskCache();
+    const std::string osFilename = oDiskCache.GetFilename(osCacheDir, osKey);
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return false;
+
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+        if (!fp)
+            return false;
+
+        uint32_t nKeySize = 0;
+        uint64_t nPayloadSize = 0;
+        std::string osStoredKey;
+        if (!oDiskCache.CheckSignature(fp.get()) ||
+            fp->Read(&nKeySize, sizeof(nKeySize), 1) != 1)
+        {
+            return false;
+        }
+        CPL_LSBPTR32(&nKeySize);
+        if (nKeySize != osKey.size())
+            return false;
+        osStoredKey.resize(nKeySize);
+        if (fp->Read(osStoredKey.data(), 1, nKeySize) != nKeySize ||
+            osStoredKey != osKey ||
+            fp->Read(&nPayloadSize, sizeof(nPayloadSize), 1) != 1)
+        {
+            return false;
+        }
+        CPL_LSBPTR64(&nPayloadSize);
+        if (nPayloadSize != nSize || fp->Read(pData, 1, nSize) != nSize)
+            return false;
+    }
+
+    oDiskCache.Touch(osFilename, sStat);
+
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALPersistentBlockCacheWrite()                   */
+/************************************************************************/
+
+/** Store the block of key osKey, of size nSize, into the persistent block
+ * cache, and evict least recently used blocks if the cache exceeds
+ * GDAL_PERSISTENT_BLOCK_CACHE_MAX_SIZE.
+ *
+ * Errors are silently ignored, the cache being only an optimization.
+ */
+void GDALPersistentBlockCacheWrite(const std::string &osKey,
+                                   const void *pData, size_t nSize)
+{
+    const std::string osCacheDir = GetPersistentBlockCacheDir();
+    if (osCacheDir.empty())
+        return;
+    CPLDiskCache &oDiskCache = GetDiskCache();
+    std::string osSubDir;
+    const std::string osFilename =
+        oDiskCache.GetFilename(osCacheDir, osKey, &osSubDir);
+    CPLDiskCache::CreateSubDir(osCacheDir, osSubDir);
+
+    const std::string osTmpFilename = oDiskCache.GetTmpFilename(osFilename);
+
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+        if (!fp)
+            return;
+
+        uint32_t nKeySize = static_cast<uint32_t>(osKey.size());
+        CPL_LSBPTR32(&nKeySize);
+        uint64_t nPayloadSize = static_cast<uint64_t>(nSize);
+        CPL_LSBPTR64(&nPayloadSize);
+        bool bOK = oDiskCache.WriteSignature(fp.get()) &&
+                   fp->Write(&nKeySize, sizeof(nKeySize), 1) == 1 &&
+                   fp->Write(osKey.data(), 1, osKey.size()) == osKey.size() &&
+                   fp->Write(&nPayloadSize, sizeof(nPayloadSize), 1) == 1 &&
+                   fp->Write(pData, 1, nSize) == nSize;
+        bOK = fp->Close() == 0 && bOK;
+        if (!bOK)
+        {
+            VSIUnlink(osTmpFilename.c_str());
+            return;
+        }
+        if (!CPLDiskCache::InstallTmpFile(osTmpFilename, osFilename,
+                                          /* bOverwrite = */ true))
+        {
+            return;
+        }
+    }
+
+    oDiskCache.NotifyBytesWritten(osCacheDir, nSize,
+                                  GetPersistentBlockCacheMaxSize());
+}
@@ -0,0 +1,33 @@
+/**********************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Persistent on-disk cache of decoded raster blocks
+ *
+ **********************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDAL_PERSISTENT_BLOCK_CACHE_H
+#define GDAL_PERSISTENT_BLOCK_CACHE_H
+
+//! @cond Doxygen_Suppress
+
+#include "cpl_port.h"
+
+#include <string>
+
+bool CPL_DLL GDALPersistentBlockCacheIsEnabled();
+
+bool CPL_DLL GDALPersistentBlockCacheIsEnabledFor(const char *pszFilename);
+
+bool CPL_DLL GDALPersistentBlockCacheRead(const std::string &osKey,
+                                          void *pData, size_t nSize);
+
+void CPL_DLL GDALPersistentBlockCacheWrite(const std::string &osKey,
+                                           const void *pData, size_t nSize);
+
+//! @endcond
+
+#endif  // GDAL_PERSISTENT_BLOCK_CACHE_H
@@ -572,6 +572,11 @@ class CPL_DLL GDALDataset : public GDALMajorObject
               GSpacing nLineSpace, GSpacing nBandSpace,
               GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 
+    virtual CPLErr IMultiRangeRasterIO(int nWindowCount,
+                                       const GDALRasterIOWindow *pasWindows,
+                                       GDALDataType eBufType, int nBandCount,
+                                       const int *panBandMap);
+
     /* This method should only be be overloaded by GDALProxyDataset */
     virtual CPLErr
     BlockBasedRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
@@ -807,6 +812,11 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 #endif
 
+    CPLErr MultiRangeRasterIO(int nWindowCount,
+                              const GDALRasterIOWindow *pasWindows,
+                              GDALDataType eBufType, int nBandCount,
+                              const int *panBandMap) CPL_WARN_UNUSED_RESULT;
+
     virtual CPLStringList GetCompressionFormats(int nXOff, int nYOff,
                                                 int nXSize, int nYSize,
                                                 int nBandCount,
@@ -1559,6 +1569,10 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     CPL_INTERNAL CPLErr UnreferenceBlock(GDALRasterBlock *poBlock);
     CPL_INTERNAL void IncDirtyBlocks(int nInc);
 
+    CPL_INTERNAL CPLErr IReadBlockThroughPersistentCache(int nBlockXOff,
+                                                         int nBlockYOff,
+                                                         void *pData);
+
   protected:
     //! @cond Doxygen_Suppress
     GDALDataset *poDS = nullptr;
@@ -1677,6 +1691,10 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
               GSpacing nPixelSpace, GSpacing nLineSpace,
               GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 
+    virtual CPLErr IMultiRangeRasterIO(int nWindowCount,
+                                       const GDALRasterIOWindow *pasWindows,
+                                       GDALDataType eBufType);
+
     virtual int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize,
                                        int nYSize, int nMaskFlagStop,
                                        double *pdfDataPct);
@@ -1684,6 +1702,9 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     virtual bool
     EmitErrorMessageIfWriteNotSupported(const char *pszCaller) const;
 
+    virtual bool GetPersistentBlockCacheIdentity(std::string &osFilename,
+                                                 std::string &osIdentity);
+
     //! @cond Doxygen_Suppress
     CPLErr
     OverviewRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
@@ -1751,6 +1772,10 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 #endif
 
+    CPLErr MultiRangeRasterIO(int nWindowCount,
+                              const GDALRasterIOWindow *pasWindows,
+                              GDALDataType eBufType) CPL_WARN_UNUSED_RESULT;
+
     template <class T>
     CPLErr ReadRaster(T *pData, size_t nArrayEltCount = 0, double dfXOff = 0,
                       double dfYOff = 0, double dfXSize = 0, double dfYSize = 0,
@@ -4586,6 +4611,8 @@ GDALGetThreadSafeDataset(std::unique_ptr<GDALDataset> poDS, int nScopeFlags);
 GDALDataset CPL_DLL *GDALGetThreadSafeDataset(GDALDataset *poDS,
                                               int nScopeFlags);
 
+bool CPL_DLL GDALCopyWholeRasterIsSlowSource(GDALDataset *poSrcDS);
+
 void GDALNullifyOpenDatasetsList();
 CPLMutex **GDALGetphDMMutex();
 CPLMutex **GDALGetphDLMutex();
@@ -27,6 +27,7 @@
 #include <memory>
 #include <new>
 #include <type_traits>
+#include <typeinfo>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -35,11 +36,13 @@
 #include "cpl_string.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "gdal.h"
 #include "gdal_rat.h"
 #include "gdal_priv_templates.hpp"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
+#include "gdal_persistent_block_cache.h"
 
 /************************************************************************/
 /*                           GDALRasterBand()                           */
@@ -1319,6 +1322,95 @@ bool GDALRasterBand::EmitErrorMessageIfWriteNotSupported(
     return false;
 }
 
+/************************************************************************/
+/*                  GetPersistentBlockCacheIdentity()                   */
+/************************************************************************/
+
+/**
+ * \brief Return how blocks of this band are identified in the persistent
+ * block cache.
+ *
+ * The persistent block cache, enabled with the
+ * GDAL_PERSISTENT_BLOCK_CACHE_DIR configuration option, stores decoded blocks
+ * on disk so that they can be reused by later openings of the same file.
+ * Blocks are keyed by the filename, its size, modification time and ETag,
+ * the identity returned by this method, the characteristics of the band and
+ * the block offsets.
+ *
+ * Drivers opt in by overriding this method: the base implementation returns
+ * false, meaning that the cache must not be used. Overrides must only return
+ * true when the decoded values of pixels are fully determined by the content
+ * of the file and by the identity, which must thus include the open options
+ * and other settings that affect decoding.
+ *
+ * @param[out] osFilename Name of the file the band is read from.
+ * @param[out] osIdentity String identifying the band within the file.
+ * @return true if the persistent block cache may be used for this band.
+ * @since GDAL 3.12
+ */
+bool GDALRasterBand::GetPersistentBlockCacheIdentity(
+    std::string & /* osFilename */, std::string & /* osIdentity */)
+{
+    return false;
+}
+
+/************************************************************************/
+/*                  IReadBlockThroughPersistentCache()                  */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Call IReadBlock(), going through the persistent block cache when it is
+ * enabled for this band. */
+CPLErr GDALRasterBand::IReadBlockThroughPersistentCache(int nBlockXOff,
+                                                        int nBlockYOff,
+                                                        void *pData)
+{
+    std::string osFilename;
+    std::string osIdentity;
+    VSIStatBufL sStat;
+    if (!GDALPersistentBlockCacheIsEnabled() ||
+        !GetPersistentBlockCacheIdentity(osFilename, osIdentity) ||
+        !GDALPersistentBlockCacheIsEnabledFor(osFilename.c_str()) ||
+        VSIStatL(osFilename.c_str(), &sStat) != 0)
+    {
+        return IReadBlock(nBlockXOff, nBlockYOff, pData);
+    }
+
+    // The file size, modification time and ETag act as a validator, so that
+    // cached blocks of a file that has been replaced are not reused. Without
+    // a modification time or an ETag, a replaced file could not be detected.
+    const std::string osETag = VSICurlGetCachedETag(osFilename.c_str());
+    if (sStat.st_mtime == 0 && osETag.empty())
+        return IReadBlock(nBlockXOff, nBlockYOff, pData);
+
+    std::string osKey(osFilename);
+    osKey += CPLSPrintf("|" CPL_FRMT_GUIB "|" CPL_FRMT_GIB "|",
+                        static_cast<GUIntBig>(sStat.st_size),
+                        static_cast<GIntBig>(sStat.st_mtime));
+    osKey += osETag;
+    osKey += '|';
+    osKey += osIdentity;
+    osKey += '|';
+    osKey += typeid(*this).name();
+    osKey += CPLSPrintf("|%dx%dx%d|%dx%d|%s|%d,%d", nRasterXSize,
+                        nRasterYSize, poDS ? poDS->GetRasterCount() : 0,
+                        nBlockXSize, nBlockYSize,
+                        GDALGetDataTypeName(eDataType), nBlockXOff,
+                        nBlockYOff);
+
+    const size_t nSize = static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                         GDALGetDataTypeSizeBytes(eDataType);
+    if (GDALPersistentBlockCacheRead(osKey, pData, nSize))
+        return CE_None;
+
+    const CPLErr eErr = IReadBlock(nBlockXOff, nBlockYOff, pData);
+    if (eErr == CE_None)
+        GDALPersistentBlockCacheWrite(osKey, pData, nSize);
+    return eErr;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                         GetActualBlockSize()                         */
 /************************************************************************/
@@ -2033,7 +2125,8 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
         {
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
             int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
-            eErr = IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
+            eErr = IReadBlockThroughPersistentCache(nXBlockOff, nYBlockOff,
+                                                    poBlock->GetDataRef());
             if (bCallLeaveReadWrite)
                 LeaveReadWrite();
             if (eErr != CE_None)
@@ -3109,6 +3109,195 @@ inline void GDALResampleConvolutionHorizontalPixelCount4_3rows<GUInt16>(
 /*                    GDALResampleChunk_Convolution()                   */
 /************************************************************************/
 
+/************************************************************************/
+/*                       GDALConvolutionWeights                         */
+/************************************************************************/
+
+namespace
+{
+/** Convolution coefficients along one axis, for the destination pixels (or
+ * lines) in the [nDstOff, nDstOff2[ range.
+ */
+struct GDALConvolutionWeights
+{
+    // Parameters the coefficients depend on.
+    FilterFuncType pfnFilterFunc = nullptr;
+    bool bHorizontal = false;
+    double dfRatioDstToSrc = 0;
+    double dfSrcDelta = 0;
+    int nKernelRadius = 0;
+    int nChunkOff = 0;
+    int nChunkSize = 0;
+    int nDstOff = 0;
+    int nDstOff2 = 0;
+
+    // Maximum number of source pixels contributing to a destination pixel.
+    int nMaxSrcCount = 0;
+    // For each destination pixel: first source pixel, number of source
+    // pixels and sum of the non-normalized coefficients.
+    std::vector<int> anSrcStart{};
+    std::vector<int> anSrcCount{};
+    std::vector<double> adfWeightSum{};
+    // nMaxSrcCount non-normalized coefficients per destination pixel.
+    std::vector<double> adfWeights{};
+
+    bool HasSameParameters(const GDALConvolutionWeights &other) const
+    {
+        return pfnFilterFunc == other.pfnFilterFunc &&
+               bHorizontal == other.bHorizontal &&
+               dfRatioDstToSrc == other.dfRatioDstToSrc &&
+               dfSrcDelta == other.dfSrcDelta &&
+               nKernelRadius == other.nKernelRadius &&
+               nChunkOff == other.nChunkOff && nChunkSize == other.nChunkSize &&
+               nDstOff == other.nDstOff && nDstOff2 == other.nDstOff2;
+    }
+
+    void Compute(FilterFunc4ValuesType pfnFilterFunc4Values);
+};
+
+/************************************************************************/
+/*                  GDALConvolutionWeights::Compute()                   */
+/************************************************************************/
+
+void GDALConvolutionWeights::Compute(
+    FilterFunc4ValuesType pfnFilterFunc4Values)
+{
+    const double dfScale = 1.0 / dfRatioDstToSrc;
+    const double dfScaleWeight = (dfScale >= 1.0) ? 1.0 : dfScale;
+    const double dfScaledRadius = nKernelRadius / dfScaleWeight;
+    nMaxSrcCount = static_cast<int>(2 + 2 * dfScaledRadius + 0.5);
+
+    const int nDstCount = nDstOff2 - nDstOff;
+    anSrcStart.resize(nDstCount);
+    anSrcCount.resize(nDstCount);
+    adfWeightSum.resize(nDstCount);
+    adfWeights.resize(static_cast<size_t>(nDstCount) * nMaxSrcCount);
+
+    const int nChunkEnd = nChunkOff + nChunkSize;
+    for (int iDst = nDstOff; iDst < nDstOff2; ++iDst)
+    {
+        const double dfSrc = (iDst + 0.5) * dfRatioDstToSrc + dfSrcDelta;
+        int nSrcStart = static_cast<int>(floor(dfSrc - dfScaledRadius + 0.5));
+        if (nSrcStart < nChunkOff)
+            nSrcStart = nChunkOff;
+        int nSrcStop = static_cast<int>(dfSrc + dfScaledRadius + 0.5);
+        if (nSrcStop > nChunkEnd)
+            nSrcStop = nChunkEnd;
+
+        double *padfWeights =
+            adfWeights.data() + static_cast<size_t>(iDst - nDstOff) *
+                                    nMaxSrcCount;
+        double dfWeightSum = 0.0;
+        int nSrc = nSrcStart;
+        if (bHorizontal)
+        {
+            double dfX = dfScaleWeight * (nSrc - dfSrc + 0.5);
+            for (; nSrc + 3 < nSrcStop; nSrc += 4)
+            {
+                padfWeights[nSrc - nSrcStart] = dfX;
+                dfX += dfScaleWeight;
+                padfWeights[nSrc + 1 - nSrcStart] = dfX;
+                dfX += dfScaleWeight;
+                padfWeights[nSrc + 2 - nSrcStart] = dfX;
+                dfX += dfScaleWeight;
+                padfWeights[nSrc + 3 - nSrcStart] = dfX;
+                dfX += dfScaleWeight;
+                dfWeightSum +=
+                    pfnFilterFunc4Values(padfWeights + nSrc - nSrcStart);
+            }
+            for (; nSrc < nSrcStop; ++nSrc, dfX += dfScaleWeight)
+            {
+                const double dfWeight = pfnFilterFunc(dfX);
+                padfWeights[nSrc - nSrcStart] = dfWeight;
+                dfWeightSum += dfWeight;
+            }
+        }
+        else
+        {
+            double dfY = dfScaleWeight * (nSrc - dfSrc + 0.5);
+            for (; nSrc + 3 < nSrcStop; nSrc += 4, dfY += 4 * dfScaleWeight)
+            {
+                padfWeights[nSrc - nSrcStart] = dfY;
+                padfWeights[nSrc + 1 - nSrcStart] = dfY + dfScaleWeight;
+                padfWeights[nSrc + 2 - nSrcStart] = dfY + 2 * dfScaleWeight;
+                padfWeights[nSrc + 3 - nSrcStart] = dfY + 3 * dfScaleWeight;
+                dfWeightSum +=
+                    pfnFilterFunc4Values(padfWeights + nSrc - nSrcStart);
+            }
+            for (; nSrc < nSrcStop; ++nSrc, dfY += dfScaleWeight)
+            {
+                const double dfWeight = pfnFilterFunc(dfY);
+                padfWeights[nSrc - nSrcStart] = dfWeight;
+                dfWeightSum += dfWeight;
+            }
+        }
+
+        anSrcStart[iDst - nDstOff] = nSrcStart;
+        anSrcCount[iDst - nDstOff] = nSrcStop - nSrcStart;
+        adfWeightSum[iDst - nDstOff] = dfWeightSum;
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     GDALGetConvolutionWeights()                      */
+/************************************************************************/
+
+// Small repeated requests (for example tiles of the same zoom level, or the
+// successive bands of a dataset) use the same coefficients over and over,
+// hence keep the most recently used ones.
+constexpr size_t MAX_CACHED_CONVOLUTION_WEIGHTS = 16;
+constexpr size_t MAX_COEFFICIENTS_PER_CACHED_WEIGHTS = 16 * 1024;
+
+static std::mutex gConvolutionWeightsMutex;
+static std::list<std::shared_ptr<const GDALConvolutionWeights>>
+    gConvolutionWeightsCache;
+
+static std::shared_ptr<const GDALConvolutionWeights> GDALGetConvolutionWeights(
+    FilterFuncType pfnFilterFunc, FilterFunc4ValuesType pfnFilterFunc4Values,
+    int nKernelRadius, bool bHorizontal, double dfRatioDstToSrc,
+    double dfSrcDelta, int nChunkOff, int nChunkSize, int nDstOff,
+    int nDstOff2)
+{
+    auto poWeights = std::make_shared<GDALConvolutionWeights>();
+    poWeights->pfnFilterFunc = pfnFilterFunc;
+    poWeights->bHorizontal = bHorizontal;
+    poWeights->dfRatioDstToSrc = dfRatioDstToSrc;
+    poWeights->dfSrcDelta = dfSrcDelta;
+    poWeights->nKernelRadius = nKernelRadius;
+    poWeights->nChunkOff = nChunkOff;
+    poWeights->nChunkSize = nChunkSize;
+    poWeights->nDstOff = nDstOff;
+    poWeights->nDstOff2 = nDstOff2;
+
+    {
+        std::lock_guard oLock(gConvolutionWeightsMutex);
+        for (auto oIter = gConvolutionWeightsCache.begin();
+             oIter != gConvolutionWeightsCache.end(); ++oIter)
+        {
+            if ((*oIter)->HasSameParameters(*poWeights))
+            {
+                gConvolutionWeightsCache.splice(
+                    gConvolutionWeightsCache.begin(), gConvolutionWeightsCache,
+                    oIter);
+                return gConvolutionWeightsCache.front();
+            }
+        }
+    }
+
+    poWeights->Compute(pfnFilterFunc4Values);
+
+    if (poWeights->adfWeights.size() <= MAX_COEFFICIENTS_PER_CACHED_WEIGHTS)
+    {
+        std::lock_guard oLock(gConvolutionWeightsMutex);
+        gConvolutionWeightsCache.push_front(poWeights);
+        if (gConvolutionWeightsCache.size() > MAX_CACHED_CONVOLUTION_WEIGHTS)
+            gConvolutionWeightsCache.pop_back();
+    }
+    return poWeights;
+}
+
 template <class T, class Twork, GDALDataType eWrkDataType>
 static CPLErr GDALResampleChunk_ConvolutionT(
     const GDALOverviewResampleArgs &args, const T *pChunk, void *pDstBuffer,
@@ -3242,21 +3431,35 @@ static CPLErr GDALResampleChunk_ConvolutionT(
             return CE_Failure;
     }
 
-    const double dfXScale = 1.0 / dfXRatioDstToSrc;
-    const double dfXScaleWeight = (dfXScale >= 1.0) ? 1.0 : dfXScale;
-    const double dfXScaledRadius = nKernelRadius / dfXScaleWeight;
-    const double dfYScale = 1.0 / dfYRatioDstToSrc;
-    const double dfYScaleWeight = (dfYScale >= 1.0) ? 1.0 : dfYScale;
-    const double dfYScaledRadius = nKernelRadius / dfYScaleWeight;
-
     // Temporary array to store result of horizontal filter.
     double *padfHorizontalFiltered = static_cast<double *>(
         VSI_MALLOC3_VERBOSE(nChunkYSize, nDstXSize, sizeof(double) * nBands));
 
-    // To store convolution coefficients.
+    // Convolution coefficients.
+    std::shared_ptr<const GDALConvolutionWeights> poWeightsX;
+    std::shared_ptr<const GDALConvolutionWeights> poWeightsY;
+    try
+    {
+        poWeightsX = GDALGetConvolutionWeights(
+            pfnFilterFunc, pfnFilterFunc4Values, nKernelRadius, true,
+            dfXRatioDstToSrc, dfSrcXDelta, nChunkXOff, nChunkXSize, nDstXOff,
+            nDstXOff2);
+        poWeightsY = GDALGetConvolutionWeights(
+            pfnFilterFunc, pfnFilterFunc4Values, nKernelRadius, false,
+            dfYRatioDstToSrc, dfSrcYDelta, nChunkYOff, nChunkYSize, nDstYOff,
+            nDstYOff2);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate convolution coefficients");
+        VSIFree(pafWrkScanline);
+        return CE_Failure;
+    }
+
+    // Aligned copy of the coefficients of the current pixel or line.
     double *padfWeights = static_cast<double *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
-        static_cast<int>(2 + 2 * std::max(dfXScaledRadius, dfYScaledRadius) +
-                         0.5) *
+        std::max(poWeightsX->nMaxSrcCount, poWeightsY->nMaxSrcCount) *
         sizeof(double)));
 
     GByte *pabyChunkNodataMaskHorizontalFiltered = nullptr;
@@ -3277,57 +3480,21 @@ static CPLErr GDALResampleChunk_ConvolutionT(
     /* ==================================================================== */
     /*      First pass: horizontal filter                                   */
     /* ==================================================================== */
-    const int nChunkRightXOff = nChunkXOff + nChunkXSize;
 #ifdef USE_SSE2
+    const double dfXScale = 1.0 / dfXRatioDstToSrc;
+    const double dfXScaleWeight = (dfXScale >= 1.0) ? 1.0 : dfXScale;
+    const double dfXScaledRadius = nKernelRadius / dfXScaleWeight;
     bool bSrcPixelCountLess8 = dfXScaledRadius < 4;
 #endif
     for (int iDstPixel = nDstXOff; iDstPixel < nDstXOff2; ++iDstPixel)
     {
-        const double dfSrcPixel =
-            (iDstPixel + 0.5) * dfXRatioDstToSrc + dfSrcXDelta;
-        int nSrcPixelStart =
-            static_cast<int>(floor(dfSrcPixel - dfXScaledRadius + 0.5));
-        if (nSrcPixelStart < nChunkXOff)
-            nSrcPixelStart = nChunkXOff;
-        int nSrcPixelStop =
-            static_cast<int>(dfSrcPixel + dfXScaledRadius + 0.5);
-        if (nSrcPixelStop > nChunkRightXOff)
-            nSrcPixelStop = nChunkRightXOff;
-#if 0
-        if( nSrcPixelStart < nChunkXOff && nChunkXOff > 0 )
-        {
-            printf( "truncated iDstPixel = %d\n", iDstPixel );/*ok*/
-        }
-        if( nSrcPixelStop > nChunkRightXOff && nChunkRightXOff < nSrcWidth )
-        {
-            printf( "truncated iDstPixel = %d\n", iDstPixel );/*ok*/
-        }
-#endif
-        const int nSrcPixelCount = nSrcPixelStop - nSrcPixelStart;
-        double dfWeightSum = 0.0;
-
-        // Compute convolution coefficients.
-        int nSrcPixel = nSrcPixelStart;
-        double dfX = dfXScaleWeight * (nSrcPixel - dfSrcPixel + 0.5);
-        for (; nSrcPixel + 3 < nSrcPixelStop; nSrcPixel += 4)
-        {
-            padfWeights[nSrcPixel - nSrcPixelStart] = dfX;
-            dfX += dfXScaleWeight;
-            padfWeights[nSrcPixel + 1 - nSrcPixelStart] = dfX;
-            dfX += dfXScaleWeight;
-            padfWeights[nSrcPixel + 2 - nSrcPixelStart] = dfX;
-            dfX += dfXScaleWeight;
-            padfWeights[nSrcPixel + 3 - nSrcPixelStart] = dfX;
-            dfX += dfXScaleWeight;
-            dfWeightSum +=
-                pfnFilterFunc4Values(padfWeights + nSrcPixel - nSrcPixelStart);
-        }
-        for (; nSrcPixel < nSrcPixelStop; ++nSrcPixel, dfX += dfXScaleWeight)
-        {
-            const double dfWeight = pfnFilterFunc(dfX);
-            padfWeights[nSrcPixel - nSrcPixelStart] = dfWeight;
-            dfWeightSum += dfWeight;
-        }
+        const int nSrcPixelStart = poWeightsX->anSrcStart[iDstPixel - nDstXOff];
+        const int nSrcPixelCount = poWeightsX->anSrcCount[iDstPixel - nDstXOff];
+        double dfWeightSum = poWeightsX->adfWeightSum[iDstPixel - nDstXOff];
+        std::copy_n(poWeightsX->adfWeights.data() +
+                        static_cast<size_t>(iDstPixel - nDstXOff) *
+                            poWeightsX->nMaxSrcCount,
+                    std::max(0, nSrcPixelCount), padfWeights);
 
         const int nHeight = nChunkYSize * nBands;
         if (pabyChunkNodataMask == nullptr)
@@ -3494,8 +3661,6 @@ static CPLErr GDALResampleChunk_ConvolutionT(
     /* ==================================================================== */
     /*      Second pass: vertical filter                                    */
     /* ==================================================================== */
-    const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
-
     for (int iDstLine = nDstYOff; iDstLine < nDstYOff2; ++iDstLine)
     {
         Twork *const pafDstScanline =
@@ -3503,50 +3668,13 @@ static CPLErr GDALResampleChunk_ConvolutionT(
                            : static_cast<Twork *>(pDstBuffer) +
                                  (iDstLine - nDstYOff) * nDstXSize;
 
-        const double dfSrcLine =
-            (iDstLine + 0.5) * dfYRatioDstToSrc + dfSrcYDelta;
-        int nSrcLineStart =
-            static_cast<int>(floor(dfSrcLine - dfYScaledRadius + 0.5));
-        int nSrcLineStop = static_cast<int>(dfSrcLine + dfYScaledRadius + 0.5);
-        if (nSrcLineStart < nChunkYOff)
-            nSrcLineStart = nChunkYOff;
-        if (nSrcLineStop > nChunkBottomYOff)
-            nSrcLineStop = nChunkBottomYOff;
-#if 0
-        if( nSrcLineStart < nChunkYOff &&
-            nChunkYOff > 0 )
-        {
-            printf( "truncated iDstLine = %d\n", iDstLine );/*ok*/
-        }
-        if( nSrcLineStop > nChunkBottomYOff && nChunkBottomYOff < nSrcHeight )
-        {
-            printf( "truncated iDstLine = %d\n", iDstLine );/*ok*/
-        }
-#endif
-        const int nSrcLineCount = nSrcLineStop - nSrcLineStart;
-        double dfWeightSum = 0.0;
-
-        // Compute convolution coefficients.
-        int nSrcLine = nSrcLineStart;  // Used after for.
-        double dfY = dfYScaleWeight * (nSrcLine - dfSrcLine + 0.5);
-        for (; nSrcLine + 3 < nSrcLineStop;
-             nSrcLine += 4, dfY += 4 * dfYScaleWeight)
-        {
-            padfWeights[nSrcLine - nSrcLineStart] = dfY;
-            padfWeights[nSrcLine + 1 - nSrcLineStart] = dfY + dfYScaleWeight;
-            padfWeights[nSrcLine + 2 - nSrcLineStart] =
-                dfY + 2 * dfYScaleWeight;
-            padfWeights[nSrcLine + 3 - nSrcLineStart] =
-                dfY + 3 * dfYScaleWeight;
-            dfWeightSum +=
-                pfnFilterFunc4Values(padfWeights + nSrcLine - nSrcLineStart);
-        }
-        for (; nSrcLine < nSrcLineStop; ++nSrcLine, dfY += dfYScaleWeight)
-        {
-            const double dfWeight = pfnFilterFunc(dfY);
-            padfWeights[nSrcLine - nSrcLineStart] = dfWeight;
-            dfWeightSum += dfWeight;
-        }
+        const int nSrcLineStart = poWeightsY->anSrcStart[iDstLine - nDstYOff];
+        const int nSrcLineCount = poWeightsY->anSrcCount[iDstLine - nDstYOff];
+        double dfWeightSum = poWeightsY->adfWeightSum[iDstLine - nDstYOff];
+        std::copy_n(poWeightsY->adfWeights.data() +
+                        static_cast<size_t>(iDstLine - nDstYOff) *
+                            poWeightsY->nMaxSrcCount,
+                    std::max(0, nSrcLineCount), padfWeights);
 
         if (pabyChunkNodataMask == nullptr)
         {
@@ -25,16 +25,26 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_threadsafe_queue.hpp"
 #include "cpl_vsi.h"
 #include "gdal_priv_templates.hpp"
 #include "gdal_vrt.h"
@@ -57,6 +67,12 @@
 #endif
 #endif
 
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+#include "rasterio_avx2.h"
+#define HAVE_AVX2_RASTERIO
+#endif
+
 static void GDALFastCopyByte(const GByte *CPL_RESTRICT pSrcData,
                              int nSrcPixelStride, GByte *CPL_RESTRICT pDstData,
                              int nDstPixelStride, GPtrDiff_t nWordCount);
@@ -994,6 +1010,27 @@ static int GDALRasterIOTransformer(void *pTransformerArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                      GDALCopyResampledChunk()                        */
+/************************************************************************/
+
+// Copy the output of a GDALResampleFunction, that is nDstXCount x nDstYCount
+// packed values of type eSrcType, into a (possibly strided) user buffer.
+static void GDALCopyResampledChunk(const void *pSrc, GDALDataType eSrcType,
+                                   int nDstXCount, int nDstYCount,
+                                   GByte *pabyDst, GDALDataType eDstType,
+                                   GSpacing nPixelSpace, GSpacing nLineSpace)
+{
+    const int nSrcDTSize = GDALGetDataTypeSizeBytes(eSrcType);
+    for (int j = 0; j < nDstYCount; ++j)
+    {
+        GDALCopyWords64(static_cast<const GByte *>(pSrc) +
+                            static_cast<size_t>(j) * nDstXCount * nSrcDTSize,
+                        eSrcType, nSrcDTSize, pabyDst + j * nLineSpace,
+                        eDstType, static_cast<int>(nPixelSpace), nDstXCount);
+    }
+}
+
 /************************************************************************/
 /*                          RasterIOResampled()                         */
 /************************************************************************/
@@ -1049,8 +1086,8 @@ CPLErr GDALRasterBand::RasterIOResampled(
         nDestYOffVirtual = static_cast<int>(dfDestYOff + 0.5);
     }
 
-    // Create a MEM dataset that wraps the output buffer.
-    GDALDataset *poMEMDS;
+    // The resampling is done in the data type of the band. If the buffer has
+    // another data type, use a temporary buffer.
     void *pTempBuffer = nullptr;
     GSpacing nPSMem = nPixelSpace;
     GSpacing nLSMem = nLineSpace;
@@ -1068,26 +1105,27 @@ CPLErr GDALRasterBand::RasterIOResampled(
         eDTMem = eDataType;
     }
 
-    poMEMDS =
-        MEMDataset::Create("", nDestXOffVirtual + nBufXSize,
-                           nDestYOffVirtual + nBufYSize, 0, eDTMem, nullptr);
-    GByte *pabyData = static_cast<GByte *>(pDataMem) -
-                      nPSMem * nDestXOffVirtual - nLSMem * nDestYOffVirtual;
-    GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
-        poMEMDS, 1, pabyData, eDTMem, nPSMem, nLSMem, false);
-    poMEMDS->SetBand(1, GDALRasterBand::FromHandle(hMEMBand));
-
     const char *pszNBITS = GetMetadataItem("NBITS", "IMAGE_STRUCTURE");
     const int nNBITS = pszNBITS ? atoi(pszNBITS) : 0;
-    if (pszNBITS)
-        GDALRasterBand::FromHandle(hMEMBand)->SetMetadataItem(
-            "NBITS", pszNBITS, "IMAGE_STRUCTURE");
 
     CPLErr eErr = CE_None;
 
     // Do the resampling.
     if (bUseWarp)
     {
+        // Create a MEM dataset that wraps the output buffer.
+        GDALDataset *poMEMDS = MEMDataset::Create(
+            "", nDestXOffVirtual + nBufXSize, nDestYOffVirtual + nBufYSize, 0,
+            eDTMem, nullptr);
+        GByte *pabyData = static_cast<GByte *>(pDataMem) -
+                          nPSMem * nDestXOffVirtual - nLSMem * nDestYOffVirtual;
+        GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
+            poMEMDS, 1, pabyData, eDTMem, nPSMem, nLSMem, false);
+        poMEMDS->SetBand(1, GDALRasterBand::FromHandle(hMEMBand));
+        if (pszNBITS)
+            GDALRasterBand::FromHandle(hMEMBand)->SetMetadataItem(
+                "NBITS", pszNBITS, "IMAGE_STRUCTURE");
+
         int bHasNoData = FALSE;
         double dfNoDataValue = GetNoDataValue(&bHasNoData);
 
@@ -1199,6 +1237,7 @@ CPLErr GDALRasterBand::RasterIOResampled(
 
         if (hVRTDS)
             GDALClose(hVRTDS);
+        GDALClose(poMEMDS);
     }
     else
     {
@@ -1289,7 +1328,6 @@ CPLErr GDALRasterBand::RasterIOResampled(
         if (pChunk == nullptr ||
             (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
         {
-            GDALClose(poMEMDS);
             CPLFree(pChunk);
             CPLFree(pabyChunkNoDataMask);
             VSIFree(pTempBuffer);
@@ -1418,13 +1456,11 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     const bool bPropagateNoData = false;
                     void *pDstBuffer = nullptr;
                     GDALDataType eDstBufferDataType = GDT_Unknown;
-                    GDALRasterBand *poMEMBand =
-                        GDALRasterBand::FromHandle(hMEMBand);
                     GDALOverviewResampleArgs args;
                     args.eSrcDataType = eDataType;
-                    args.eOvrDataType = poMEMBand->GetRasterDataType();
-                    args.nOvrXSize = poMEMBand->GetXSize();
-                    args.nOvrYSize = poMEMBand->GetYSize();
+                    args.eOvrDataType = eDTMem;
+                    args.nOvrXSize = nDestXOffVirtual + nBufXSize;
+                    args.nOvrYSize = nDestYOffVirtual + nBufYSize;
                     args.nOvrNBITS = nNBITS;
                     args.dfXRatioDstToSrc = dfXRatioDstToSrc;
                     args.dfYRatioDstToSrc = dfYRatioDstToSrc;
@@ -1454,11 +1490,12 @@ CPLErr GDALRasterBand::RasterIOResampled(
                                            &eDstBufferDataType);
                     if (eErr == CE_None)
                     {
-                        eErr = poMEMBand->RasterIO(
-                            GF_Write, nDstXOff + nDestXOffVirtual,
-                            nDstYOff + nDestYOffVirtual, nDstXCount, nDstYCount,
-                            pDstBuffer, nDstXCount, nDstYCount,
-                            eDstBufferDataType, 0, 0, nullptr);
+                        GDALCopyResampledChunk(
+                            pDstBuffer, eDstBufferDataType, nDstXCount,
+                            nDstYCount,
+                            static_cast<GByte *>(pDataMem) +
+                                nLSMem * nDstYOff + nPSMem * nDstXOff,
+                            eDTMem, nPSMem, nLSMem);
                     }
                     CPLFree(pDstBuffer);
                 }
@@ -1479,12 +1516,10 @@ CPLErr GDALRasterBand::RasterIOResampled(
 
     if (eBufType != eDataType)
     {
-        CPL_IGNORE_RET_VAL(poMEMDS->GetRasterBand(1)->RasterIO(
-            GF_Read, nDestXOffVirtual, nDestYOffVirtual, nBufXSize, nBufYSize,
-            pData, nBufXSize, nBufYSize, eBufType, nPixelSpace, nLineSpace,
-            nullptr));
+        GDALCopyResampledChunk(pTempBuffer, eDataType, nBufXSize, nBufYSize,
+                               static_cast<GByte *>(pData), eBufType,
+                               nPixelSpace, nLineSpace);
     }
-    GDALClose(poMEMDS);
     VSIFree(pTempBuffer);
 
     return eErr;
@@ -1547,48 +1582,14 @@ CPLErr GDALDataset::RasterIOResampled(
         nDestYOffVirtual = static_cast<int>(dfDestYOff + 0.5);
     }
 
-    // Create a MEM dataset that wraps the output buffer.
-    GDALDataset *poMEMDS =
-        MEMDataset::Create("", nDestXOffVirtual + nBufXSize,
-                           nDestYOffVirtual + nBufYSize, 0, eBufType, nullptr);
-    GDALRasterBand **papoDstBands = static_cast<GDALRasterBand **>(
-        CPLMalloc(nBandCount * sizeof(GDALRasterBand *)));
     int nNBITS = 0;
     for (int i = 0; i < nBandCount; i++)
     {
-        char szBuffer[32] = {'\0'};
-        int nRet = CPLPrintPointer(
-            szBuffer,
-            static_cast<GByte *>(pData) - nPixelSpace * nDestXOffVirtual -
-                nLineSpace * nDestYOffVirtual + nBandSpace * i,
-            sizeof(szBuffer));
-        szBuffer[nRet] = 0;
-
-        char szBuffer0[64] = {'\0'};
-        snprintf(szBuffer0, sizeof(szBuffer0), "DATAPOINTER=%s", szBuffer);
-
-        char szBuffer1[64] = {'\0'};
-        snprintf(szBuffer1, sizeof(szBuffer1), "PIXELOFFSET=" CPL_FRMT_GIB,
-                 static_cast<GIntBig>(nPixelSpace));
-
-        char szBuffer2[64] = {'\0'};
-        snprintf(szBuffer2, sizeof(szBuffer2), "LINEOFFSET=" CPL_FRMT_GIB,
-                 static_cast<GIntBig>(nLineSpace));
-
-        char *apszOptions[4] = {szBuffer0, szBuffer1, szBuffer2, nullptr};
-
-        poMEMDS->AddBand(eBufType, apszOptions);
-
         GDALRasterBand *poSrcBand = GetRasterBand(panBandMap[i]);
-        papoDstBands[i] = poMEMDS->GetRasterBand(i + 1);
         const char *pszNBITS =
             poSrcBand->GetMetadataItem("NBITS", "IMAGE_STRUCTURE");
         if (pszNBITS)
-        {
             nNBITS = atoi(pszNBITS);
-            poMEMDS->GetRasterBand(i + 1)->SetMetadataItem("NBITS", pszNBITS,
-                                                           "IMAGE_STRUCTURE");
-        }
     }
 
     CPLErr eErr = CE_None;
@@ -1757,10 +1758,8 @@ CPLErr GDALDataset::RasterIOResampled(
         if (pChunk == nullptr ||
             (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
         {
-            GDALClose(poMEMDS);
             CPLFree(pChunk);
             CPLFree(pabyChunkNoDataMask);
-            CPLFree(papoDstBands);
             return CE_Failure;
         }
 
@@ -1924,13 +1923,11 @@ CPLErr GDALDataset::RasterIOResampled(
                         const bool bPropagateNoData = false;
                         void *pDstBuffer = nullptr;
                         GDALDataType eDstBufferDataType = GDT_Unknown;
-                        GDALRasterBand *poMEMBand =
-                            poMEMDS->GetRasterBand(i + 1);
                         GDALOverviewResampleArgs args;
                         args.eSrcDataType = eDataType;
-                        args.eOvrDataType = poMEMBand->GetRasterDataType();
-                        args.nOvrXSize = poMEMBand->GetXSize();
-                        args.nOvrYSize = poMEMBand->GetYSize();
+                        args.eOvrDataType = eBufType;
+                        args.nOvrXSize = nDestXOffVirtual + nBufXSize;
+                        args.nOvrYSize = nDestYOffVirtual + nBufYSize;
                         args.nOvrNBITS = nNBITS;
                         args.dfXRatioDstToSrc = dfXRatioDstToSrc;
                         args.dfYRatioDstToSrc = dfYRatioDstToSrc;
@@ -1967,11 +1964,13 @@ CPLErr GDALDataset::RasterIOResampled(
                                             &pDstBuffer, &eDstBufferDataType);
                         if (eErr == CE_None)
                         {
-                            eErr = poMEMBand->RasterIO(
-                                GF_Write, nDstXOff + nDestXOffVirtual,
-                                nDstYOff + nDestYOffVirtual, nDstXCount,
-                                nDstYCount, pDstBuffer, nDstXCount, nDstYCount,
-                                eDstBufferDataType, 0, 0, nullptr);
+                            GDALCopyResampledChunk(
+                                pDstBuffer, eDstBufferDataType, nDstXCount,
+                                nDstYCount,
+                                static_cast<GByte *>(pData) + i * nBandSpace +
+                                    nLineSpace * nDstYOff +
+                                    nPixelSpace * nDstXOff,
+                                eBufType, nPixelSpace, nLineSpace);
                         }
                         CPLFree(pDstBuffer);
                     }
@@ -1991,9 +1990,6 @@ CPLErr GDALDataset::RasterIOResampled(
         CPLFree(pabyChunkNoDataMask);
     }
 
-    CPLFree(papoDstBands);
-    GDALClose(poMEMDS);
-
     return eErr;
 }
 
@@ -3294,6 +3290,69 @@ static void GDALFastCopyByte(const GByte *CPL_RESTRICT pSrcData,
                  nWordCount);
 }
 
+#ifdef HAVE_AVX2_RASTERIO
+
+/************************************************************************/
+/*                       GDALCopyWordsWithAVX2()                        */
+/************************************************************************/
+
+// Convert words with an AVX2 kernel. Packed buffers are directly handled
+// by the kernel. For pixel-interleaved buffers, words are gathered into
+// (and scattered from) small packed temporary buffers, which only pays off
+// when the scalar conversion is costly, that is from floating-point to
+// integer data types.
+// Returns the number of words processed. The caller is responsible for the
+// remaining ones.
+
+static GPtrDiff_t GDALCopyWordsWithAVX2(
+    GDALCopyWordsAVX2Func pfnCopyWords, const void *CPL_RESTRICT pSrcData,
+    GDALDataType eSrcType, int nSrcPixelStride, void *CPL_RESTRICT pDstData,
+    GDALDataType eDstType, int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    const int nSrcDataTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    const int nDstDataTypeSize = GDALGetDataTypeSizeBytes(eDstType);
+    if (nSrcPixelStride == nSrcDataTypeSize &&
+        nDstPixelStride == nDstDataTypeSize)
+    {
+        return static_cast<GPtrDiff_t>(
+            pfnCopyWords(pSrcData, pDstData, static_cast<size_t>(nWordCount)));
+    }
+
+    if (!GDALDataTypeIsFloating(eSrcType) || GDALDataTypeIsFloating(eDstType))
+        return 0;
+
+    constexpr int CHUNK_SIZE = 256;
+    alignas(32) GByte abySrcChunk[CHUNK_SIZE * sizeof(double)];
+    alignas(32) GByte abyDstChunk[CHUNK_SIZE * sizeof(GInt32)];
+    GPtrDiff_t nDone = 0;
+    for (; nWordCount - nDone >= CHUNK_SIZE; nDone += CHUNK_SIZE)
+    {
+        const GByte *pabySrc =
+            static_cast<const GByte *>(pSrcData) + nDone * nSrcPixelStride;
+        GByte *pabyDst =
+            static_cast<GByte *>(pDstData) + nDone * nDstPixelStride;
+        if (nSrcPixelStride != nSrcDataTypeSize)
+        {
+            GDALCopyWords64(pabySrc, eSrcType, nSrcPixelStride, abySrcChunk,
+                            eSrcType, nSrcDataTypeSize, CHUNK_SIZE);
+            pabySrc = abySrcChunk;
+        }
+        if (nDstPixelStride != nDstDataTypeSize)
+        {
+            pfnCopyWords(pabySrc, abyDstChunk, CHUNK_SIZE);
+            GDALCopyWords64(abyDstChunk, eDstType, nDstDataTypeSize, pabyDst,
+                            eDstType, nDstPixelStride, CHUNK_SIZE);
+        }
+        else
+        {
+            pfnCopyWords(pabySrc, pabyDst, CHUNK_SIZE);
+        }
+    }
+    return nDone;
+}
+
+#endif  // HAVE_AVX2_RASTERIO
+
 /************************************************************************/
 /*                           GDALCopyWords()                            */
 /************************************************************************/
@@ -3495,6 +3554,27 @@ void CPL_STDCALL GDALCopyWords64(const void *CPL_RESTRICT pSrcData,
         }
     }
 
+#ifdef HAVE_AVX2_RASTERIO
+    if (eSrcType != eDstType && nWordCount >= 16 && CPLHaveRuntimeAVX2())
+    {
+        const auto pfnCopyWords =
+            GDALGetCopyWordsFunc_AVX2(eSrcType, eDstType);
+        if (pfnCopyWords)
+        {
+            const GPtrDiff_t nDone = GDALCopyWordsWithAVX2(
+                pfnCopyWords, pSrcData, eSrcType, nSrcPixelStride, pDstData,
+                eDstType, nDstPixelStride, nWordCount);
+            if (nDone == nWordCount)
+                return;
+            pSrcData =
+                static_cast<const GByte *>(pSrcData) + nDone * nSrcPixelStride;
+            pDstData =
+                static_cast<GByte *>(pDstData) + nDone * nDstPixelStride;
+            nWordCount -= nDone;
+        }
+    }
+#endif
+
     // Handle the more general case -- deals with conversion of data types
     // directly.
     switch (eSrcType)
@@ -4629,6 +4709,277 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
     *pnSwathLines = nSwathLines;
 }
 
+/************************************************************************/
+/*                  GDALCopyWholeRasterIsSlowSource()                   */
+/************************************************************************/
+
+/** Return whether reading from the source dataset is likely to be costly
+ * enough (decompression, network access) so that overlapping it with the
+ * writing of the target dataset is worth the extra thread and memory.
+ */
+bool GDALCopyWholeRasterIsSlowSource(GDALDataset *poSrcDS)
+{
+    if (poSrcDS == nullptr || CPLGetNumCPUs() < 2)
+        return false;
+
+    const char *pszCompression =
+        poSrcDS->GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE");
+    if (pszCompression == nullptr && poSrcDS->GetRasterCount() > 0)
+    {
+        pszCompression = poSrcDS->GetRasterBand(1)->GetMetadataItem(
+            "COMPRESSION", "IMAGE_STRUCTURE");
+    }
+    if (pszCompression != nullptr && !EQUAL(pszCompression, "NONE"))
+        return true;
+
+    const char *pszFilename = poSrcDS->GetDescription();
+    return pszFilename[0] != '\0' && !VSIIsLocal(pszFilename);
+}
+
+namespace
+{
+
+/************************************************************************/
+/*                      GDALCopyWholeRasterSwath                        */
+/************************************************************************/
+
+struct GDALCopyWholeRasterSwath
+{
+    int nBand = 0;  // 0 means all bands
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    double dfProgressStart = 0;
+    double dfProgressEnd = 0;
+};
+
+// Reads a swath into the buffer. Sets bHasData to false if the swath does
+// not need to be written.
+using GDALCopyWholeRasterReadFunc =
+    std::function<CPLErr(const GDALCopyWholeRasterSwath &, void *pBuffer,
+                         GDALRasterIOExtraArg *psExtraArg, bool &bHasData)>;
+
+// Writes a swath from the buffer.
+using GDALCopyWholeRasterWriteFunc =
+    std::function<CPLErr(const GDALCopyWholeRasterSwath &, void *pBuffer)>;
+
+}  // namespace
+
+/************************************************************************/
+/*                 GDALCopyWholeRasterGetReadAhead()                    */
+/************************************************************************/
+
+/** Return the number of swaths to read in advance in a worker thread, or
+ * 0 if reading and writing must be done sequentially in the calling thread.
+ */
+static int GDALCopyWholeRasterGetReadAhead(GDALDataset *poSrcDS,
+                                           CSLConstList papszOptions,
+                                           size_t nSwaths,
+                                           size_t nSwathBufSize)
+{
+    if (nSwaths < 2)
+        return 0;
+
+    const char *pszAsyncRead = CSLFetchNameValueDef(
+        papszOptions, "ASYNC_READ",
+        CPLGetConfigOption("GDAL_COPY_WHOLE_RASTER_ASYNC_READ", "AUTO"));
+    if (EQUAL(pszAsyncRead, "AUTO"))
+    {
+        if (!GDALCopyWholeRasterIsSlowSource(poSrcDS))
+            return 0;
+    }
+    else if (!CPLTestBool(pszAsyncRead))
+    {
+        return 0;
+    }
+
+    int nReadAhead = std::clamp(
+        atoi(CPLGetConfigOption("GDAL_COPY_WHOLE_RASTER_ASYNC_READ_AHEAD",
+                                "1")),
+        1, 16);
+
+    // Do not let the swath buffers in flight exceed half of the block cache,
+    // so that the blocks of the swath being written are not evicted by the
+    // ones being read.
+    const GIntBig nMaxInFlight =
+        GDALGetCacheMax64() / 2 /
+        std::max<GIntBig>(1, static_cast<GIntBig>(nSwathBufSize));
+    nReadAhead =
+        static_cast<int>(std::clamp<GIntBig>(nMaxInFlight, 1, nReadAhead));
+    return static_cast<int>(
+        std::min(static_cast<size_t>(nReadAhead), nSwaths - 1));
+}
+
+/************************************************************************/
+/*                   GDALCopyWholeRasterProcessSwaths()                 */
+/************************************************************************/
+
+/** Read and write each swath of aoSwaths in sequence.
+ *
+ * If nReadAhead > 0, reading is done in a worker thread that runs at most
+ * nReadAhead swaths ahead of the writing done in the calling thread. Swaths
+ * are always written in order, and progress is only reported from the calling
+ * thread.
+ */
+static CPLErr GDALCopyWholeRasterProcessSwaths(
+    const std::vector<GDALCopyWholeRasterSwath> &aoSwaths,
+    size_t nSwathBufSize, int nReadAhead,
+    const GDALCopyWholeRasterReadFunc &readFunc,
+    const GDALCopyWholeRasterWriteFunc &writeFunc,
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    std::vector<std::unique_ptr<void, VSIFreeReleaser>> apBuffers;
+    for (int i = 0; i < 1 + nReadAhead; ++i)
+    {
+        apBuffers.emplace_back(VSI_MALLOC_VERBOSE(nSwathBufSize));
+        if (!apBuffers.back())
+        {
+            if (i == 0)
+                return CE_Failure;
+            apBuffers.pop_back();
+            break;
+        }
+    }
+    // Not enough memory for a spare buffer: revert to sequential processing.
+    nReadAhead = static_cast<int>(apBuffers.size()) - 1;
+
+    const auto ReportProgress = [pfnProgress, pProgressData](double dfComplete)
+    {
+        if (!pfnProgress(dfComplete, nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
+            return false;
+        }
+        return true;
+    };
+
+    CPLErr eErr = CE_None;
+    if (nReadAhead == 0)
+    {
+        void *pSwathBuf = apBuffers[0].get();
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
+
+        for (const auto &oSwath : aoSwaths)
+        {
+            sExtraArg.pfnProgress = GDALScaledProgress;
+            sExtraArg.pProgressData = GDALCreateScaledProgress(
+                oSwath.dfProgressStart,
+                (oSwath.dfProgressStart + oSwath.dfProgressEnd) / 2,
+                pfnProgress, pProgressData);
+            if (sExtraArg.pProgressData == nullptr)
+                sExtraArg.pfnProgress = nullptr;
+
+            bool bHasData = true;
+            eErr = readFunc(oSwath, pSwathBuf, &sExtraArg, bHasData);
+
+            GDALDestroyScaledProgress(sExtraArg.pProgressData);
+
+            if (eErr == CE_None && bHasData)
+                eErr = writeFunc(oSwath, pSwathBuf);
+
+            if (eErr == CE_None && !ReportProgress(oSwath.dfProgressEnd))
+                eErr = CE_Failure;
+            if (eErr != CE_None)
+                break;
+        }
+        return eErr;
+    }
+
+    CPLDebug("GDAL", "Reading up to %d swath(s) ahead in a worker thread",
+             nReadAhead);
+
+    struct ReadResult
+    {
+        size_t iSwath = 0;
+        int iBuffer = -1;
+        CPLErr eErr = CE_None;
+        bool bHasData = true;
+    };
+
+    // Bounded producer/consumer: the reader thread can only read into a
+    // buffer that has been given back by the writer.
+    cpl::ThreadSafeQueue<int> oFreeBuffers;
+    cpl::ThreadSafeQueue<ReadResult> oReadSwaths;
+    for (int i = 0; i < static_cast<int>(apBuffers.size()); ++i)
+        oFreeBuffers.push(i);
+
+    std::atomic<bool> bAbort{false};
+    CPLErrorAccumulator oErrorAccumulator;
+    const CPLStringList aosThreadLocalConfigOptions(
+        CPLGetThreadLocalConfigOptions());
+
+    const auto ReaderThread = [&aoSwaths, &apBuffers, &readFunc, &oFreeBuffers,
+                               &oReadSwaths, &bAbort, &oErrorAccumulator,
+                               &aosThreadLocalConfigOptions]()
+    {
+        CPLSetThreadLocalConfigOptions(aosThreadLocalConfigOptions.List());
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            for (size_t i = 0; i < aoSwaths.size(); ++i)
+            {
+                const int iBuffer = oFreeBuffers.get_and_pop_front();
+                if (iBuffer < 0 || bAbort)
+                    break;
+                ReadResult oResult;
+                oResult.iSwath = i;
+                oResult.iBuffer = iBuffer;
+                oResult.eErr = readFunc(aoSwaths[i], apBuffers[iBuffer].get(),
+                                        nullptr, oResult.bHasData);
+                oReadSwaths.push(oResult);
+                if (oResult.eErr != CE_None)
+                    break;
+            }
+        }
+        CPLSetThreadLocalConfigOptions(nullptr);
+    };
+
+    std::thread oReaderThread;
+    try
+    {
+        oReaderThread = std::thread(ReaderThread);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot start reader thread: %s", e.what());
+        return CE_Failure;
+    }
+
+    for (size_t i = 0; i < aoSwaths.size(); ++i)
+    {
+        const ReadResult oResult = oReadSwaths.get_and_pop_front();
+        CPLAssert(oResult.iSwath == i);
+        const auto &oSwath = aoSwaths[oResult.iSwath];
+
+        eErr = oResult.eErr;
+        if (eErr == CE_None && oResult.bHasData)
+            eErr = writeFunc(oSwath, apBuffers[oResult.iBuffer].get());
+        oFreeBuffers.push(oResult.iBuffer);
+
+        if (eErr == CE_None && !ReportProgress(oSwath.dfProgressEnd))
+            eErr = CE_Failure;
+        if (eErr != CE_None)
+            break;
+    }
+
+    if (eErr != CE_None)
+    {
+        bAbort = true;
+        oFreeBuffers.push(-1);
+    }
+    oReaderThread.join();
+
+    oErrorAccumulator.ReplayErrors();
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                     GDALDatasetCopyWholeRaster()                     */
 /************************************************************************/
@@ -4654,6 +5005,14 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * sizes to achieve best compression.</li> <li>"SKIP_HOLES=YES" to skip chunks
  * for which GDALGetDataCoverageStatus() returns GDAL_DATA_COVERAGE_STATUS_EMPTY
  * (GDAL &gt;= 2.2)</li>
+ * <li>"ASYNC_READ=AUTO/YES/NO" to read the next swath(s) from the source
+ * dataset in a worker thread while the current one is written to the
+ * destination dataset. In AUTO mode (the default, which can also be set with
+ * the GDAL_COPY_WHOLE_RASTER_ASYNC_READ configuration option), this is done
+ * when the source is compressed or on a network file system.
+ * The number of swaths read in advance is set by the
+ * GDAL_COPY_WHOLE_RASTER_ASYNC_READ_AHEAD configuration option (default 1).
+ * (GDAL &gt;= 3.12)</li>
  * </ul>
  * More options may be supported in the future.
  *
@@ -4773,11 +5132,15 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     if (bInterleave)
         nPixelSize *= nBandCount;
 
-    void *pSwathBuf = VSI_MALLOC3_VERBOSE(nSwathCols, nSwathLines, nPixelSize);
-    if (pSwathBuf == nullptr)
+    if (static_cast<double>(nSwathCols) * nSwathLines * nPixelSize >
+        static_cast<double>(std::numeric_limits<size_t>::max()))
     {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Too large swath buffer in GDALDatasetCopyWholeRaster()");
         return CE_Failure;
     }
+    const size_t nSwathBufSize =
+        static_cast<size_t>(nSwathCols) * nSwathLines * nPixelSize;
 
     CPLDebug("GDAL",
              "GDALDatasetCopyWholeRaster(): %d*%d swaths, bInterleave=%d",
@@ -4789,177 +5152,97 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     poSrcDS->AdviseRead(0, 0, nXSize, nYSize, nXSize, nYSize, eDT, nBandCount,
                         nullptr, nullptr);
 
-    /* ==================================================================== */
-    /*      Band oriented (uninterleaved) case.                             */
-    /* ==================================================================== */
-    CPLErr eErr = CE_None;
-    const bool bCheckHoles =
-        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
-
-    if (!bInterleave)
+    /* -------------------------------------------------------------------- */
+    /*      Collect the swaths, band per band in the uninterleaved case,    */
+    /*      or for all bands at once in the pixel interleaved case.         */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALCopyWholeRasterSwath> aoSwaths;
     {
-        GDALRasterIOExtraArg sExtraArg;
-        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
-
-        const GIntBig nTotalBlocks = static_cast<GIntBig>(nBandCount) *
+        const int nSwathBands = bInterleave ? 1 : nBandCount;
+        const double dfTotalSwaths = static_cast<double>(nSwathBands) *
                                      DIV_ROUND_UP(nYSize, nSwathLines) *
                                      DIV_ROUND_UP(nXSize, nSwathCols);
-        GIntBig nBlocksDone = 0;
-
-        for (int iBand = 0; iBand < nBandCount && eErr == CE_None; iBand++)
+        for (int iBand = 0; iBand < nSwathBands; iBand++)
         {
-            int nBand = iBand + 1;
-
-            for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+            for (int iY = 0; iY < nYSize; iY += nSwathLines)
             {
-                int nThisLines = nSwathLines;
-
-                if (iY + nThisLines > nYSize)
-                    nThisLines = nYSize - iY;
-
-                for (int iX = 0; iX < nXSize && eErr == CE_None;
-                     iX += nSwathCols)
+                for (int iX = 0; iX < nXSize; iX += nSwathCols)
                 {
-                    int nThisCols = nSwathCols;
-
-                    if (iX + nThisCols > nXSize)
-                        nThisCols = nXSize - iX;
-
-                    int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                    if (bCheckHoles)
-                    {
-                        nStatus = poSrcDS->GetRasterBand(nBand)
-                                      ->GetDataCoverageStatus(
-                                          iX, iY, nThisCols, nThisLines,
-                                          GDAL_DATA_COVERAGE_STATUS_DATA);
-                    }
-                    if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                    {
-                        sExtraArg.pfnProgress = GDALScaledProgress;
-                        sExtraArg.pProgressData = GDALCreateScaledProgress(
-                            nBlocksDone / static_cast<double>(nTotalBlocks),
-                            (nBlocksDone + 0.5) /
-                                static_cast<double>(nTotalBlocks),
-                            pfnProgress, pProgressData);
-                        if (sExtraArg.pProgressData == nullptr)
-                            sExtraArg.pfnProgress = nullptr;
-
-                        eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                                 nThisLines, pSwathBuf,
-                                                 nThisCols, nThisLines, eDT, 1,
-                                                 &nBand, 0, 0, 0, &sExtraArg);
-
-                        GDALDestroyScaledProgress(sExtraArg.pProgressData);
-
-                        if (eErr == CE_None)
-                            eErr = poDstDS->RasterIO(
-                                GF_Write, iX, iY, nThisCols, nThisLines,
-                                pSwathBuf, nThisCols, nThisLines, eDT, 1,
-                                &nBand, 0, 0, 0, nullptr);
-                    }
-
-                    nBlocksDone++;
-                    if (eErr == CE_None &&
-                        !pfnProgress(nBlocksDone /
-                                         static_cast<double>(nTotalBlocks),
-                                     nullptr, pProgressData))
-                    {
-                        eErr = CE_Failure;
-                        CPLError(CE_Failure, CPLE_UserInterrupt,
-                                 "User terminated CreateCopy()");
-                    }
+                    GDALCopyWholeRasterSwath oSwath;
+                    oSwath.nBand = bInterleave ? 0 : iBand + 1;
+                    oSwath.nXOff = iX;
+                    oSwath.nYOff = iY;
+                    oSwath.nXSize = std::min(nSwathCols, nXSize - iX);
+                    oSwath.nYSize = std::min(nSwathLines, nYSize - iY);
+                    oSwath.dfProgressStart = aoSwaths.size() / dfTotalSwaths;
+                    oSwath.dfProgressEnd =
+                        (aoSwaths.size() + 1) / dfTotalSwaths;
+                    aoSwaths.push_back(oSwath);
                 }
             }
         }
     }
 
-    /* ==================================================================== */
-    /*      Pixel interleaved case.                                         */
-    /* ==================================================================== */
-    else /* if( bInterleave ) */
-    {
-        GDALRasterIOExtraArg sExtraArg;
-        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
+    const bool bCheckHoles =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
 
-        const GIntBig nTotalBlocks =
-            static_cast<GIntBig>(DIV_ROUND_UP(nYSize, nSwathLines)) *
-            DIV_ROUND_UP(nXSize, nSwathCols);
-        GIntBig nBlocksDone = 0;
+    const auto ReadSwath =
+        [poSrcDS, eDT, nBandCount, bCheckHoles](
+            const GDALCopyWholeRasterSwath &oSwath, void *pSwathBuf,
+            GDALRasterIOExtraArg *psExtraArg, bool &bHasData)
+    {
+        const int nSwathBandCount = oSwath.nBand == 0 ? nBandCount : 1;
+        int nBand = oSwath.nBand;
+        int *panBandMap = oSwath.nBand == 0 ? nullptr : &nBand;
 
-        for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+        if (bCheckHoles)
         {
-            int nThisLines = nSwathLines;
-
-            if (iY + nThisLines > nYSize)
-                nThisLines = nYSize - iY;
-
-            for (int iX = 0; iX < nXSize && eErr == CE_None; iX += nSwathCols)
+            int nStatus = 0;
+            for (int i = 0; i < nSwathBandCount; i++)
             {
-                int nThisCols = nSwathCols;
-
-                if (iX + nThisCols > nXSize)
-                    nThisCols = nXSize - iX;
-
-                int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                if (bCheckHoles)
-                {
-                    nStatus = 0;
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                    {
-                        nStatus |= poSrcDS->GetRasterBand(iBand + 1)
-                                       ->GetDataCoverageStatus(
-                                           iX, iY, nThisCols, nThisLines,
-                                           GDAL_DATA_COVERAGE_STATUS_DATA);
-                        if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                            break;
-                    }
-                }
+                nStatus |=
+                    poSrcDS
+                        ->GetRasterBand(panBandMap ? panBandMap[i] : i + 1)
+                        ->GetDataCoverageStatus(
+                            oSwath.nXOff, oSwath.nYOff, oSwath.nXSize,
+                            oSwath.nYSize, GDAL_DATA_COVERAGE_STATUS_DATA);
                 if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                {
-                    sExtraArg.pfnProgress = GDALScaledProgress;
-                    sExtraArg.pProgressData = GDALCreateScaledProgress(
-                        nBlocksDone / static_cast<double>(nTotalBlocks),
-                        (nBlocksDone + 0.5) / static_cast<double>(nTotalBlocks),
-                        pfnProgress, pProgressData);
-                    if (sExtraArg.pProgressData == nullptr)
-                        sExtraArg.pfnProgress = nullptr;
-
-                    eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                             nThisLines, pSwathBuf, nThisCols,
-                                             nThisLines, eDT, nBandCount,
-                                             nullptr, 0, 0, 0, &sExtraArg);
-
-                    GDALDestroyScaledProgress(sExtraArg.pProgressData);
-
-                    if (eErr == CE_None)
-                        eErr = poDstDS->RasterIO(
-                            GF_Write, iX, iY, nThisCols, nThisLines, pSwathBuf,
-                            nThisCols, nThisLines, eDT, nBandCount, nullptr, 0,
-                            0, 0, nullptr);
-                }
-
-                nBlocksDone++;
-                if (eErr == CE_None &&
-                    !pfnProgress(nBlocksDone /
-                                     static_cast<double>(nTotalBlocks),
-                                 nullptr, pProgressData))
-                {
-                    eErr = CE_Failure;
-                    CPLError(CE_Failure, CPLE_UserInterrupt,
-                             "User terminated CreateCopy()");
-                }
+                    break;
+            }
+            if (!(nStatus & GDAL_DATA_COVERAGE_STATUS_DATA))
+            {
+                bHasData = false;
+                return CE_None;
             }
         }
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*      Cleanup                                                         */
-    /* -------------------------------------------------------------------- */
-    CPLFree(pSwathBuf);
 
-    return eErr;
+        return poSrcDS->RasterIO(GF_Read, oSwath.nXOff, oSwath.nYOff,
+                                 oSwath.nXSize, oSwath.nYSize, pSwathBuf,
+                                 oSwath.nXSize, oSwath.nYSize, eDT,
+                                 nSwathBandCount, panBandMap, 0, 0, 0,
+                                 psExtraArg);
+    };
+
+    const auto WriteSwath =
+        [poDstDS, eDT, nBandCount](const GDALCopyWholeRasterSwath &oSwath,
+                                   void *pSwathBuf)
+    {
+        const int nSwathBandCount = oSwath.nBand == 0 ? nBandCount : 1;
+        int nBand = oSwath.nBand;
+        return poDstDS->RasterIO(GF_Write, oSwath.nXOff, oSwath.nYOff,
+                                 oSwath.nXSize, oSwath.nYSize, pSwathBuf,
+                                 oSwath.nXSize, oSwath.nYSize, eDT,
+                                 nSwathBandCount,
+                                 oSwath.nBand == 0 ? nullptr : &nBand, 0, 0, 0,
+                                 nullptr);
+    };
+
+    const int nReadAhead = GDALCopyWholeRasterGetReadAhead(
+        poSrcDS, papszOptions, aoSwaths.size(), nSwathBufSize);
+
+    return GDALCopyWholeRasterProcessSwaths(
+        aoSwaths, nSwathBufSize, nReadAhead, ReadSwath, WriteSwath,
+        pfnProgress, pProgressData);
 }
 
 /************************************************************************/
@@ -4983,6 +5266,8 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
  * achieve best compression.</li>
  * <li>"SKIP_HOLES=YES" to skip chunks for which GDALGetDataCoverageStatus()
  * returns GDAL_DATA_COVERAGE_STATUS_EMPTY (GDAL &gt;= 2.2)</li>
+ * <li>"ASYNC_READ=AUTO/YES/NO": see GDALDatasetCopyWholeRaster()
+ * (GDAL &gt;= 3.12)</li>
  * </ul>
  *
  * @param hSrcBand the source band
@@ -5005,7 +5290,6 @@ CPLErr CPL_STDCALL GDALRasterBandCopyWholeRaster(
 
     GDALRasterBand *poSrcBand = GDALRasterBand::FromHandle(hSrcBand);
     GDALRasterBand *poDstBand = GDALRasterBand::FromHandle(hDstBand);
-    CPLErr eErr = CE_None;
 
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -5056,11 +5340,15 @@ CPLErr CPL_STDCALL GDALRasterBandCopyWholeRaster(
 
     const int nPixelSize = GDALGetDataTypeSizeBytes(eDT);
 
-    void *pSwathBuf = VSI_MALLOC3_VERBOSE(nSwathCols, nSwathLines, nPixelSize);
-    if (pSwathBuf == nullptr)
+    if (static_cast<double>(nSwathCols) * nSwathLines * nPixelSize >
+        static_cast<double>(std::numeric_limits<size_t>::max()))
     {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Too large swath buffer in GDALRasterBandCopyWholeRaster()");
         return CE_Failure;
     }
+    const size_t nSwathBufSize =
+        static_cast<size_t>(nSwathCols) * nSwathLines * nPixelSize;
 
     CPLDebug("GDAL", "GDALRasterBandCopyWholeRaster(): %d*%d swaths",
              nSwathCols, nSwathLines);
@@ -5071,60 +5359,65 @@ CPLErr CPL_STDCALL GDALRasterBandCopyWholeRaster(
     // Advise the source raster that we are going to read it completely
     poSrcBand->AdviseRead(0, 0, nXSize, nYSize, nXSize, nYSize, eDT, nullptr);
 
-    /* ==================================================================== */
-    /*      Band oriented (uninterleaved) case.                             */
-    /* ==================================================================== */
-
-    for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+    std::vector<GDALCopyWholeRasterSwath> aoSwaths;
+    for (int iY = 0; iY < nYSize; iY += nSwathLines)
     {
-        int nThisLines = nSwathLines;
-
-        if (iY + nThisLines > nYSize)
-            nThisLines = nYSize - iY;
-
-        for (int iX = 0; iX < nXSize && eErr == CE_None; iX += nSwathCols)
+        const int nThisLines = std::min(nSwathLines, nYSize - iY);
+        for (int iX = 0; iX < nXSize; iX += nSwathCols)
         {
-            int nThisCols = nSwathCols;
-
-            if (iX + nThisCols > nXSize)
-                nThisCols = nXSize - iX;
-
-            int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-            if (bCheckHoles)
-            {
-                nStatus = poSrcBand->GetDataCoverageStatus(
-                    iX, iY, nThisCols, nThisLines,
-                    GDAL_DATA_COVERAGE_STATUS_DATA);
-            }
-            if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-            {
-                eErr = poSrcBand->RasterIO(GF_Read, iX, iY, nThisCols,
-                                           nThisLines, pSwathBuf, nThisCols,
-                                           nThisLines, eDT, 0, 0, nullptr);
-
-                if (eErr == CE_None)
-                    eErr = poDstBand->RasterIO(GF_Write, iX, iY, nThisCols,
-                                               nThisLines, pSwathBuf, nThisCols,
-                                               nThisLines, eDT, 0, 0, nullptr);
-            }
+            GDALCopyWholeRasterSwath oSwath;
+            oSwath.nBand = 1;
+            oSwath.nXOff = iX;
+            oSwath.nYOff = iY;
+            oSwath.nXSize = std::min(nSwathCols, nXSize - iX);
+            oSwath.nYSize = nThisLines;
+            oSwath.dfProgressStart = iY / static_cast<double>(nYSize);
+            oSwath.dfProgressEnd =
+                (iY + nThisLines) / static_cast<double>(nYSize);
+            aoSwaths.push_back(oSwath);
+        }
+    }
 
-            if (eErr == CE_None &&
-                !pfnProgress((iY + nThisLines) / static_cast<float>(nYSize),
-                             nullptr, pProgressData))
+    const auto ReadSwath = [poSrcBand, eDT, bCheckHoles](
+                               const GDALCopyWholeRasterSwath &oSwath,
+                               void *pSwathBuf,
+                               GDALRasterIOExtraArg *psExtraArg, bool &bHasData)
+    {
+        if (bCheckHoles)
+        {
+            const int nStatus = poSrcBand->GetDataCoverageStatus(
+                oSwath.nXOff, oSwath.nYOff, oSwath.nXSize, oSwath.nYSize,
+                GDAL_DATA_COVERAGE_STATUS_DATA);
+            if (!(nStatus & GDAL_DATA_COVERAGE_STATUS_DATA))
             {
-                eErr = CE_Failure;
-                CPLError(CE_Failure, CPLE_UserInterrupt,
-                         "User terminated CreateCopy()");
+                bHasData = false;
+                return CE_None;
             }
         }
-    }
 
-    /* -------------------------------------------------------------------- */
-    /*      Cleanup                                                         */
-    /* -------------------------------------------------------------------- */
-    CPLFree(pSwathBuf);
-
-    return eErr;
+        return poSrcBand->RasterIO(GF_Read, oSwath.nXOff, oSwath.nYOff,
+                                   oSwath.nXSize, oSwath.nYSize, pSwathBuf,
+                                   oSwath.nXSize, oSwath.nYSize, eDT, 0, 0,
+                                   psExtraArg);
+    };
+
+    const auto WriteSwath = [poDstBand, eDT](
+                                const GDALCopyWholeRasterSwath &oSwath,
+                                void *pSwathBuf)
+    {
+        return poDstBand->RasterIO(GF_Write, oSwath.nXOff, oSwath.nYOff,
+                                   oSwath.nXSize, oSwath.nYSize, pSwathBuf,
+                                   oSwath.nXSize, oSwath.nYSize, eDT, 0, 0,
+                                   nullptr);
+    };
+
+    const int nReadAhead = GDALCopyWholeRasterGetReadAhead(
+        poSrcBand->GetDataset(), papszOptions, aoSwaths.size(),
+        nSwathBufSize);
+
+    return GDALCopyWholeRasterProcessSwaths(
+        aoSwaths, nSwathBufSize, nReadAhead, ReadSwath, WriteSwath,
+        pfnProgress, pProgressData);
 }
 
 /************************************************************************/
@@ -5609,6 +5902,156 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
 
 #endif
 
+/************************************************************************/
+/*                    GDALDeinterleaveBlocked()                         */
+/************************************************************************/
+
+// Number of bytes of the interleaved buffer processed at once, so that the
+// corresponding parts of the per-component buffers remain in the L1 cache.
+constexpr size_t GDAL_INTERLEAVE_BLOCK_SIZE = 16 * 1024;
+
+template <class T>
+static void GDALDeinterleaveBlocked(const T *CPL_RESTRICT pSrc,
+                                    int nComponents, void *const *ppDest,
+                                    size_t nIters)
+{
+    const size_t nBlockIters = std::max<size_t>(
+        1, GDAL_INTERLEAVE_BLOCK_SIZE / (nComponents * sizeof(T)));
+    for (size_t i0 = 0; i0 < nIters; i0 += nBlockIters)
+    {
+        const size_t i1 = std::min(nIters, i0 + nBlockIters);
+        for (int iComp = 0; iComp < nComponents; ++iComp)
+        {
+            T *CPL_RESTRICT pDest = static_cast<T *>(ppDest[iComp]);
+            for (size_t i = i0; i < i1; ++i)
+                pDest[i] = pSrc[i * nComponents + iComp];
+        }
+    }
+}
+
+/************************************************************************/
+/*                     GDALInterleaveBlocked()                          */
+/************************************************************************/
+
+template <class T>
+static void GDALInterleaveBlocked(const void *const *ppSrc, int nComponents,
+                                  T *CPL_RESTRICT pDest, size_t nIters)
+{
+    const size_t nBlockIters = std::max<size_t>(
+        1, GDAL_INTERLEAVE_BLOCK_SIZE / (nComponents * sizeof(T)));
+    for (size_t i0 = 0; i0 < nIters; i0 += nBlockIters)
+    {
+        const size_t i1 = std::min(nIters, i0 + nBlockIters);
+        for (int iComp = 0; iComp < nComponents; ++iComp)
+        {
+            const T *CPL_RESTRICT pSrc = static_cast<const T *>(ppSrc[iComp]);
+            for (size_t i = i0; i < i1; ++i)
+                pDest[i * nComponents + iComp] = pSrc[i];
+        }
+    }
+}
+
+/************************************************************************/
+/*                    GDALCanUseAVX2Interleave()                        */
+/************************************************************************/
+
+#ifdef HAVE_AVX2_RASTERIO
+// The AVX2 kernels transpose tiles of 8x8 words (4x4 for 8-byte words), and
+// need at least that number of components and pixels.
+static bool GDALCanUseAVX2Interleave(int nWordSize, int nComponents,
+                                     size_t nIters)
+{
+    const int nTileSize = nWordSize == 8 ? 4 : 8;
+    return nComponents >= nTileSize &&
+           nIters >= static_cast<size_t>(nTileSize) && CPLHaveRuntimeAVX2();
+}
+#endif
+
+/************************************************************************/
+/*                    GDALDeinterleaveSameType()                        */
+/************************************************************************/
+
+/** De-interleave a buffer of 1, 2, 4 or 8-byte words, without conversion.
+ *
+ * Returns false if nWordSize is not handled.
+ */
+static bool GDALDeinterleaveSameType(const void *pSrc, int nWordSize,
+                                     int nComponents, void *const *ppDest,
+                                     size_t nIters)
+{
+#ifdef HAVE_AVX2_RASTERIO
+    if (GDALCanUseAVX2Interleave(nWordSize, nComponents, nIters))
+    {
+        GDALDeinterleave_AVX2(pSrc, nComponents, ppDest, nWordSize, nIters);
+        return true;
+    }
+#endif
+    switch (nWordSize)
+    {
+        case 1:
+            GDALDeinterleaveBlocked(static_cast<const uint8_t *>(pSrc),
+                                    nComponents, ppDest, nIters);
+            return true;
+        case 2:
+            GDALDeinterleaveBlocked(static_cast<const uint16_t *>(pSrc),
+                                    nComponents, ppDest, nIters);
+            return true;
+        case 4:
+            GDALDeinterleaveBlocked(static_cast<const uint32_t *>(pSrc),
+                                    nComponents, ppDest, nIters);
+            return true;
+        case 8:
+            GDALDeinterleaveBlocked(static_cast<const uint64_t *>(pSrc),
+                                    nComponents, ppDest, nIters);
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     GDALInterleaveSameType()                         */
+/************************************************************************/
+
+/** Interleave buffers of 1, 2, 4 or 8-byte words, without conversion.
+ *
+ * Returns false if nWordSize is not handled.
+ */
+static bool GDALInterleaveSameType(const void *const *ppSrc, int nWordSize,
+                                   int nComponents, void *pDest, size_t nIters)
+{
+#ifdef HAVE_AVX2_RASTERIO
+    if (GDALCanUseAVX2Interleave(nWordSize, nComponents, nIters))
+    {
+        GDALInterleave_AVX2(ppSrc, nComponents, pDest, nWordSize, nIters);
+        return true;
+    }
+#endif
+    switch (nWordSize)
+    {
+        case 1:
+            GDALInterleaveBlocked(ppSrc, nComponents,
+                                  static_cast<uint8_t *>(pDest), nIters);
+            return true;
+        case 2:
+            GDALInterleaveBlocked(ppSrc, nComponents,
+                                  static_cast<uint16_t *>(pDest), nIters);
+            return true;
+        case 4:
+            GDALInterleaveBlocked(ppSrc, nComponents,
+                                  static_cast<uint32_t *>(pDest), nIters);
+            return true;
+        case 8:
+            GDALInterleaveBlocked(ppSrc, nComponents,
+                                  static_cast<uint64_t *>(pDest), nIters);
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                      GDALDeinterleave()                              */
 /************************************************************************/
@@ -5624,7 +6067,8 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
     \endverbatim
 
     The implementation is optimized for a few cases, like de-interleaving
-    of 3 or 4-components Byte buffers.
+    of 3 or 4-components Byte buffers, and for an arbitrary number of
+    components when eSourceDT == eDestDT.
 
     \since GDAL 3.6
  */
@@ -5709,6 +6153,22 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
 #endif
         }
 #endif
+
+        // For a small number of components, the per-component strided
+        // copies below are already efficient enough, unless the AVX2
+        // kernels can be used.
+        const int nDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
+        bool bBlocked = nComponents > 4;
+#ifdef HAVE_AVX2_RASTERIO
+        bBlocked =
+            bBlocked || GDALCanUseAVX2Interleave(nDTSize, nComponents, nIters);
+#endif
+        if (bBlocked && GDALDeinterleaveSameType(pSourceBuffer, nDTSize,
+                                                 nComponents, ppDestBuffer,
+                                                 nIters))
+        {
+            return;
+        }
     }
 
     const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
@@ -5722,6 +6182,49 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
     }
 }
 
+/************************************************************************/
+/*                       GDALInterleave()                               */
+/************************************************************************/
+
+/*! Copy values from multiple per-component buffers to a pixel-interleave
+    buffer.
+
+    This is the reverse operation of GDALDeinterleave().
+
+    In pseudo-code
+    \verbatim
+    for(size_t i = 0; i < nIters; ++i)
+        for(int iComp = 0; iComp < nComponents; iComp++ )
+            pDestBuffer[nComponents * i + iComp] = ppSourceBuffer[iComp][i]
+    \endverbatim
+
+    The implementation is optimized for the case where eSourceDT == eDestDT.
+
+    \since GDAL 3.12
+ */
+void GDALInterleave(const void *const *ppSourceBuffer, GDALDataType eSourceDT,
+                    int nComponents, void *pDestBuffer, GDALDataType eDestDT,
+                    size_t nIters)
+{
+    if (eSourceDT == eDestDT &&
+        GDALInterleaveSameType(ppSourceBuffer,
+                               GDALGetDataTypeSizeBytes(eSourceDT),
+                               nComponents, pDestBuffer, nIters))
+    {
+        return;
+    }
+
+    const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
+    const int nDestDTSize = GDALGetDataTypeSizeBytes(eDestDT);
+    for (int iComp = 0; iComp < nComponents; iComp++)
+    {
+        GDALCopyWords64(ppSourceBuffer[iComp], eSourceDT, nSourceDTSize,
+                        static_cast<GByte *>(pDestBuffer) +
+                            iComp * nDestDTSize,
+                        eDestDT, nComponents * nDestDTSize, nIters);
+    }
+}
+
 /************************************************************************/
 /*                    GDALTranspose2DSingleToSingle()                   */
 /************************************************************************/
@@ -6171,6 +6674,42 @@ void GDALTranspose2D(const void *pSrc, GDALDataType eSrcType, void *pDst,
         }
 #endif
     }
+#ifdef HAVE_AVX2_RASTERIO
+    else if (eSrcType == eDstType && nSrcWidth < INT_MAX &&
+             nSrcHeight < INT_MAX)
+    {
+        // Transposing is interleaving the rows of the source array.
+        // The AVX2 kernels are only measurably faster than the generic
+        // implementation for 2-byte words, or 4-byte words with a wide
+        // enough source array.
+        const int nDTSize = GDALGetDataTypeSizeBytes(eSrcType);
+        if ((nDTSize == 2 || (nDTSize == 4 && nSrcWidth >= 64)) &&
+            GDALCanUseAVX2Interleave(nDTSize, static_cast<int>(nSrcHeight),
+                                     nSrcWidth))
+        {
+            std::vector<const void *> apSrcRows;
+            try
+            {
+                apSrcRows.resize(nSrcHeight);
+            }
+            catch (const std::exception &)
+            {
+            }
+            if (!apSrcRows.empty())
+            {
+                for (size_t i = 0; i < nSrcHeight; ++i)
+                {
+                    apSrcRows[i] = static_cast<const GByte *>(pSrc) +
+                                   i * nSrcWidth * nDTSize;
+                }
+                GDALInterleave_AVX2(apSrcRows.data(),
+                                    static_cast<int>(nSrcHeight), pDst,
+                                    nDTSize, nSrcWidth);
+                return;
+            }
+        }
+    }
+#endif
 
 #define CALL_GDALTranspose2D_internal(DST_TYPE, DST_IS_COMPLEX)                \
     GDALTranspose2D<DST_TYPE, DST_IS_COMPLEX>(                                 \
@@ -6394,3 +6933,446 @@ void GDALExpandPackedBitsToByteAt0Or1(const GByte *CPL_RESTRICT pabyInput,
         ++pabyOutput;
     }
 }
+
+/************************************************************************/
+/*               GDALValidateMultiRangeRasterIOWindows()                */
+/************************************************************************/
+
+static bool GDALValidateMultiRangeRasterIOWindows(
+    const char *pszFuncName, int nWindowCount,
+    const GDALRasterIOWindow *pasWindows, GDALDataType eBufType,
+    int nRasterXSize, int nRasterYSize)
+{
+    if (nWindowCount < 0 || (nWindowCount > 0 && pasWindows == nullptr))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "%s(): invalid window list",
+                 pszFuncName);
+        return false;
+    }
+    if (eBufType == GDT_Unknown || eBufType == GDT_TypeCount)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "%s(): illegal GDT_Unknown/GDT_TypeCount argument",
+                 pszFuncName);
+        return false;
+    }
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        const GDALRasterIOWindow &sWindow = pasWindows[i];
+        if (sWindow.pData == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "%s(): the buffer of window %d is null", pszFuncName, i);
+            return false;
+        }
+        if (sWindow.nXSize < 1 || sWindow.nYSize < 1 || sWindow.nXOff < 0 ||
+            sWindow.nXOff > nRasterXSize - sWindow.nXSize ||
+            sWindow.nYOff < 0 || sWindow.nYOff > nRasterYSize - sWindow.nYSize)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "%s(): window %d (%d,%d) of size %dx%d is invalid or "
+                     "out of the raster of %dx%d",
+                     pszFuncName, i, sWindow.nXOff, sWindow.nYOff,
+                     sWindow.nXSize, sWindow.nYSize, nRasterXSize,
+                     nRasterYSize);
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*               GDALGetMultiRangeRasterIOAdviseWindow()                */
+/************************************************************************/
+
+// Compute the window to pass to AdviseRead() for a multi-range request.
+// AdviseRead() only accepts a single window, so this is only worth it when
+// the blocks intersecting the requested windows are a significant part of
+// those of their bounding box. Otherwise, for example for scattered points,
+// much more data than needed would be fetched. Drivers that know the exact
+// location of their blocks, such as GTiff, override IMultiRangeRasterIO() to
+// advise the ranges of the touched blocks whatever their density.
+static bool GDALGetMultiRangeRasterIOAdviseWindow(
+    int nWindowCount, const GDALRasterIOWindow *pasWindows, int nBlockXSize,
+    int nBlockYSize, int &nXOff, int &nYOff, int &nXSize, int &nYSize)
+{
+    if (nWindowCount == 0 || nBlockXSize <= 0 || nBlockYSize <= 0)
+        return false;
+
+    int nX1 = INT_MAX;
+    int nY1 = INT_MAX;
+    int nX2 = 0;
+    int nY2 = 0;
+    std::vector<uint64_t> anBlocks;
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        const GDALRasterIOWindow &sWindow = pasWindows[i];
+        nX1 = std::min(nX1, sWindow.nXOff);
+        nY1 = std::min(nY1, sWindow.nYOff);
+        nX2 = std::max(nX2, sWindow.nXOff + sWindow.nXSize);
+        nY2 = std::max(nY2, sWindow.nYOff + sWindow.nYSize);
+        const int nBlockX1 = sWindow.nXOff / nBlockXSize;
+        const int nBlockX2 = (sWindow.nXOff + sWindow.nXSize - 1) / nBlockXSize;
+        const int nBlockY1 = sWindow.nYOff / nBlockYSize;
+        const int nBlockY2 = (sWindow.nYOff + sWindow.nYSize - 1) / nBlockYSize;
+        for (int iBlockY = nBlockY1; iBlockY <= nBlockY2; ++iBlockY)
+        {
+            for (int iBlockX = nBlockX1; iBlockX <= nBlockX2; ++iBlockX)
+            {
+                anBlocks.push_back((static_cast<uint64_t>(iBlockY) << 32) |
+                                   static_cast<uint32_t>(iBlockX));
+            }
+        }
+    }
+    std::sort(anBlocks.begin(), anBlocks.end());
+    const size_t nTouchedBlocks = static_cast<size_t>(
+        std::unique(anBlocks.begin(), anBlocks.end()) - anBlocks.begin());
+    const uint64_t nBoundingBoxBlocks =
+        static_cast<uint64_t>((nX2 - 1) / nBlockXSize - nX1 / nBlockXSize + 1) *
+        ((nY2 - 1) / nBlockYSize - nY1 / nBlockYSize + 1);
+    if (static_cast<uint64_t>(nTouchedBlocks) * 2 < nBoundingBoxBlocks)
+        return false;
+
+    nXOff = nX1;
+    nYOff = nY1;
+    nXSize = nX2 - nX1;
+    nYSize = nY2 - nY1;
+    return true;
+}
+
+/************************************************************************/
+/*                  GDALRasterBand::MultiRangeRasterIO()                */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of a raster band at once.
+ *
+ * This is functionally equivalent to calling RasterIO() in GF_Read mode on
+ * each window, at full resolution, but is more efficient when reading many
+ * small windows (for example to extract values at points). Arguments are
+ * validated once, windows are processed in the order of the blocks they
+ * belong to, and windows contained in a block already in the block cache are
+ * directly copied from it. When the blocks of the windows are dense enough
+ * in their bounding box, a single AdviseRead() call is issued for the whole
+ * batch, so that drivers for cloud sources can fetch them in a single
+ * multi-range request. Some drivers, such as GTiff, additionally advise the
+ * exact byte ranges of the blocks touched by sparse windows.
+ *
+ * This method is the same as the C GDALRasterMultiRangeRasterIO() function.
+ *
+ * @param nWindowCount Number of windows.
+ * @param pasWindows Array of nWindowCount windows. The nBandSpace member
+ * is ignored.
+ * @param eBufType Data type of the buffers of the windows.
+ *
+ * @return CE_Failure if the access fails, otherwise CE_None.
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALRasterBand::MultiRangeRasterIO(int nWindowCount,
+                                          const GDALRasterIOWindow *pasWindows,
+                                          GDALDataType eBufType)
+{
+    if (!GDALValidateMultiRangeRasterIOWindows("MultiRangeRasterIO",
+                                               nWindowCount, pasWindows,
+                                               eBufType, nRasterXSize,
+                                               nRasterYSize))
+    {
+        return CE_Failure;
+    }
+    if (nWindowCount == 0)
+        return CE_None;
+
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    if (GDALGetMultiRangeRasterIOAdviseWindow(nWindowCount, pasWindows,
+                                              nBlockXSize, nBlockYSize, nXOff,
+                                              nYOff, nXSize, nYSize))
+    {
+        CPL_IGNORE_RET_VAL(AdviseRead(nXOff, nYOff, nXSize, nYSize, nXSize,
+                                      nYSize, eBufType, nullptr));
+    }
+
+    const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(GF_Read));
+    const CPLErr eErr =
+        IMultiRangeRasterIO(nWindowCount, pasWindows, eBufType);
+    if (bCallLeaveReadWrite)
+        LeaveReadWrite();
+    return eErr;
+}
+
+/************************************************************************/
+/*                   GDALRasterMultiRangeRasterIO()                     */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of a raster band at once.
+ *
+ * @see GDALRasterBand::MultiRangeRasterIO()
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALRasterMultiRangeRasterIO(GDALRasterBandH hBand, int nWindowCount,
+                                    const GDALRasterIOWindow *pasWindows,
+                                    GDALDataType eBufType)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterMultiRangeRasterIO", CE_Failure);
+
+    return GDALRasterBand::FromHandle(hBand)->MultiRangeRasterIO(
+        nWindowCount, pasWindows, eBufType);
+}
+
+/************************************************************************/
+/*                 GDALRasterBand::IMultiRangeRasterIO()                */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Read several windows of a raster band at once.
+ *
+ * The default implementation processes windows in the order of the blocks
+ * they belong to. Windows contained in a block already in the block cache
+ * are directly copied from it, and the other ones go through IRasterIO().
+ *
+ * Windows have been validated by MultiRangeRasterIO() before.
+ */
+CPLErr GDALRasterBand::IMultiRangeRasterIO(int nWindowCount,
+                                           const GDALRasterIOWindow *pasWindows,
+                                           GDALDataType eBufType)
+{
+    const auto GetKey = [this, pasWindows](int i)
+    {
+        const GDALRasterIOWindow &sWindow = pasWindows[i];
+        return std::make_tuple(sWindow.nYOff / nBlockYSize,
+                               sWindow.nXOff / nBlockXSize, sWindow.nYOff,
+                               sWindow.nXOff);
+    };
+    std::vector<int> anOrder(nWindowCount);
+    std::iota(anOrder.begin(), anOrder.end(), 0);
+    std::sort(anOrder.begin(), anOrder.end(),
+              [&GetKey](int a, int b) { return GetKey(a) < GetKey(b); });
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nBufDTSize = GDALGetDataTypeSizeBytes(eBufType);
+    for (const int i : anOrder)
+    {
+        const GDALRasterIOWindow &sWindow = pasWindows[i];
+        const GSpacing nPixelSpace =
+            sWindow.nPixelSpace ? sWindow.nPixelSpace : nBufDTSize;
+        const GSpacing nLineSpace = sWindow.nLineSpace
+                                        ? sWindow.nLineSpace
+                                        : nPixelSpace * sWindow.nXSize;
+        GByte *pabyData = static_cast<GByte *>(sWindow.pData);
+
+        const int nBlockXOff = sWindow.nXOff / nBlockXSize;
+        const int nBlockYOff = sWindow.nYOff / nBlockYSize;
+        if ((sWindow.nXOff + sWindow.nXSize - 1) / nBlockXSize == nBlockXOff &&
+            (sWindow.nYOff + sWindow.nYSize - 1) / nBlockYSize == nBlockYOff &&
+            nPixelSpace >= INT_MIN && nPixelSpace <= INT_MAX)
+        {
+            GDALRasterBlock *poBlock =
+                TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                const GByte *pabyBlock =
+                    static_cast<const GByte *>(poBlock->GetDataRef()) +
+                    (static_cast<size_t>(sWindow.nYOff -
+                                         nBlockYOff * nBlockYSize) *
+                         nBlockXSize +
+                     (sWindow.nXOff - nBlockXOff * nBlockXSize)) *
+                        nDTSize;
+                for (int iY = 0; iY < sWindow.nYSize; ++iY)
+                {
+                    GDALCopyWords64(
+                        pabyBlock +
+                            static_cast<size_t>(iY) * nBlockXSize * nDTSize,
+                        eDataType, nDTSize, pabyData + iY * nLineSpace,
+                        eBufType, static_cast<int>(nPixelSpace),
+                        sWindow.nXSize);
+                }
+                poBlock->DropLock();
+                continue;
+            }
+        }
+
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        const CPLErr eErr =
+            bForceCachedIO
+                ? GDALRasterBand::IRasterIO(
+                      GF_Read, sWindow.nXOff, sWindow.nYOff, sWindow.nXSize,
+                      sWindow.nYSize, pabyData, sWindow.nXSize, sWindow.nYSize,
+                      eBufType, nPixelSpace, nLineSpace, &sExtraArg)
+                : IRasterIO(GF_Read, sWindow.nXOff, sWindow.nYOff,
+                            sWindow.nXSize, sWindow.nYSize, pabyData,
+                            sWindow.nXSize, sWindow.nYSize, eBufType,
+                            nPixelSpace, nLineSpace, &sExtraArg);
+        if (eErr != CE_None)
+            return eErr;
+    }
+    return CE_None;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                   GDALDataset::MultiRangeRasterIO()                  */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of several bands of a dataset at once.
+ *
+ * This is functionally equivalent to calling RasterIO() in GF_Read mode on
+ * each window, at full resolution, but is more efficient when reading many
+ * small windows (for example to extract values at points).
+ * See GDALRasterBand::MultiRangeRasterIO() for details.
+ *
+ * This method is the same as the C GDALDatasetMultiRangeRasterIO() function.
+ *
+ * @param nWindowCount Number of windows.
+ * @param pasWindows Array of nWindowCount windows.
+ * @param eBufType Data type of the buffers of the windows.
+ * @param nBandCount Number of bands to read.
+ * @param panBandMap List of nBandCount band numbers (1-based), or nullptr to
+ * select the first nBandCount bands.
+ *
+ * @return CE_Failure if the access fails, otherwise CE_None.
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALDataset::MultiRangeRasterIO(int nWindowCount,
+                                       const GDALRasterIOWindow *pasWindows,
+                                       GDALDataType eBufType, int nBandCount,
+                                       const int *panBandMap)
+{
+    if (!GDALValidateMultiRangeRasterIOWindows("MultiRangeRasterIO",
+                                               nWindowCount, pasWindows,
+                                               eBufType, nRasterXSize,
+                                               nRasterYSize))
+    {
+        return CE_Failure;
+    }
+
+    std::vector<int> anBandMap;
+    if (panBandMap == nullptr)
+    {
+        if (nBandCount < 0 || nBandCount > nBands)
+        {
+            ReportError(CE_Failure, CPLE_IllegalArg,
+                        "MultiRangeRasterIO(): nBandCount cannot be greater "
+                        "than %d",
+                        nBands);
+            return CE_Failure;
+        }
+        anBandMap.resize(nBandCount);
+        std::iota(anBandMap.begin(), anBandMap.end(), 1);
+        panBandMap = anBandMap.data();
+    }
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        if (panBandMap[i] < 1 || panBandMap[i] > nBands)
+        {
+            ReportError(CE_Failure, CPLE_IllegalArg,
+                        "MultiRangeRasterIO(): panBandMap[%d] = %d, this band "
+                        "does not exist on dataset.",
+                        i, panBandMap[i]);
+            return CE_Failure;
+        }
+    }
+    if (nWindowCount == 0 || nBandCount <= 0)
+        return CE_None;
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    papoBands[panBandMap[0] - 1]->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    if (GDALGetMultiRangeRasterIOAdviseWindow(nWindowCount, pasWindows,
+                                              nBlockXSize, nBlockYSize, nXOff,
+                                              nYOff, nXSize, nYSize))
+    {
+        CPL_IGNORE_RET_VAL(AdviseRead(nXOff, nYOff, nXSize, nYSize, nXSize,
+                                      nYSize, eBufType, nBandCount,
+                                      const_cast<int *>(panBandMap), nullptr));
+    }
+
+    const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(GF_Read));
+    const CPLErr eErr = IMultiRangeRasterIO(nWindowCount, pasWindows, eBufType,
+                                            nBandCount, panBandMap);
+    if (bCallLeaveReadWrite)
+        LeaveReadWrite();
+    return eErr;
+}
+
+/************************************************************************/
+/*                   GDALDatasetMultiRangeRasterIO()                    */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of several bands of a dataset at once.
+ *
+ * @see GDALDataset::MultiRangeRasterIO()
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALDatasetMultiRangeRasterIO(GDALDatasetH hDS, int nWindowCount,
+                                     const GDALRasterIOWindow *pasWindows,
+                                     GDALDataType eBufType, int nBandCount,
+                                     const int *panBandMap)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetMultiRangeRasterIO", CE_Failure);
+
+    return GDALDataset::FromHandle(hDS)->MultiRangeRasterIO(
+        nWindowCount, pasWindows, eBufType, nBandCount, panBandMap);
+}
+
+/************************************************************************/
+/*                  GDALDataset::IMultiRangeRasterIO()                  */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Read several windows of several bands of a dataset at once.
+ *
+ * The default implementation reads the windows band after band with
+ * GDALRasterBand::IMultiRangeRasterIO().
+ *
+ * Windows and bands have been validated by MultiRangeRasterIO() before.
+ */
+CPLErr GDALDataset::IMultiRangeRasterIO(int nWindowCount,
+                                        const GDALRasterIOWindow *pasWindows,
+                                        GDALDataType eBufType, int nBandCount,
+                                        const int *panBandMap)
+{
+    const int nBufDTSize = GDALGetDataTypeSizeBytes(eBufType);
+    std::vector<GDALRasterIOWindow> asBandWindows(
+        pasWindows, pasWindows + nWindowCount);
+    for (int iBand = 0; iBand < nBandCount; ++iBand)
+    {
+        // Point to the buffers of the current band.
+        for (int i = 0; iBand > 0 && i < nWindowCount; ++i)
+        {
+            const GDALRasterIOWindow &sWindow = pasWindows[i];
+            const GSpacing nPixelSpace =
+                sWindow.nPixelSpace ? sWindow.nPixelSpace : nBufDTSize;
+            const GSpacing nLineSpace = sWindow.nLineSpace
+                                            ? sWindow.nLineSpace
+                                            : nPixelSpace * sWindow.nXSize;
+            const GSpacing nBandSpace = sWindow.nBandSpace
+                                            ? sWindow.nBandSpace
+                                            : nLineSpace * sWindow.nYSize;
+            asBandWindows[i].pData =
+                static_cast<GByte *>(sWindow.pData) + iBand * nBandSpace;
+        }
+        GDALRasterBand *poBand = papoBands[panBandMap[iBand] - 1];
+        const CPLErr eErr = poBand->IMultiRangeRasterIO(
+            nWindowCount, asBandWindows.data(), eBufType);
+        if (eErr != CE_None)
+            return eErr;
+    }
+    return CE_None;
+}
+
+//! @endcond
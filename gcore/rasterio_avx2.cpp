@@ -0,0 +1,803 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#include "rasterio_avx2.h"
+
+#include "cpl_error.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+// This file is compiled with AVX2 enabled, so we must be careful not to
+// instantiate here inline functions (like GDALCopyWord()) that could end up
+// being shared with translation units compiled without it. All code here is
+// thus self-contained and lives in an anonymous namespace.
+
+namespace
+{
+
+/************************************************************************/
+/*                           LoadAsInt32()                              */
+/************************************************************************/
+
+// Load 8 consecutive integer words and widen them to 8 int32 lanes.
+
+inline __m256i LoadAsInt32(const GByte *CPL_RESTRICT pSrc)
+{
+    return _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(pSrc)));
+}
+
+inline __m256i LoadAsInt32(const GUInt16 *CPL_RESTRICT pSrc)
+{
+    return _mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc)));
+}
+
+inline __m256i LoadAsInt32(const GInt16 *CPL_RESTRICT pSrc)
+{
+    return _mm256_cvtepi16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc)));
+}
+
+inline __m256i LoadAsInt32(const GInt32 *CPL_RESTRICT pSrc)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pSrc));
+}
+
+/************************************************************************/
+/*                          StoreFromInt32()                            */
+/************************************************************************/
+
+// Store 8 int32 lanes, saturating them to the range of the output type.
+// The saturating packs give the same result as the clamping done by
+// GDALCopyWord() for integer to integer conversions.
+
+inline void StoreFromInt32(__m256i ymm, GByte *CPL_RESTRICT pDst)
+{
+    const __m128i xmm = _mm_packs_epi32(_mm256_castsi256_si128(ymm),
+                                        _mm256_extracti128_si256(ymm, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(pDst),
+                     _mm_packus_epi16(xmm, xmm));
+}
+
+inline void StoreFromInt32(__m256i ymm, GUInt16 *CPL_RESTRICT pDst)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pDst),
+                     _mm_packus_epi32(_mm256_castsi256_si128(ymm),
+                                      _mm256_extracti128_si256(ymm, 1)));
+}
+
+inline void StoreFromInt32(__m256i ymm, GInt16 *CPL_RESTRICT pDst)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pDst),
+                     _mm_packs_epi32(_mm256_castsi256_si128(ymm),
+                                     _mm256_extracti128_si256(ymm, 1)));
+}
+
+// Only used for sources that cannot be negative.
+inline void StoreFromInt32(__m256i ymm, GUInt32 *CPL_RESTRICT pDst)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst), ymm);
+}
+
+inline void StoreFromInt32(__m256i ymm, GInt32 *CPL_RESTRICT pDst)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst), ymm);
+}
+
+inline void StoreFromInt32(__m256i ymm, float *CPL_RESTRICT pDst)
+{
+    _mm256_storeu_ps(pDst, _mm256_cvtepi32_ps(ymm));
+}
+
+inline void StoreFromInt32(__m256i ymm, double *CPL_RESTRICT pDst)
+{
+    _mm256_storeu_pd(pDst, _mm256_cvtepi32_pd(_mm256_castsi256_si128(ymm)));
+    _mm256_storeu_pd(pDst + 4,
+                     _mm256_cvtepi32_pd(_mm256_extracti128_si256(ymm, 1)));
+}
+
+/************************************************************************/
+/*                     Floating-point rounding helpers                  */
+/************************************************************************/
+
+// Set NaN lanes to zero.
+inline __m256 ZeroNaN(__m256 ymm)
+{
+    return _mm256_and_ps(ymm, _mm256_cmp_ps(ymm, ymm, _CMP_ORD_Q));
+}
+
+inline __m256d ZeroNaN(__m256d ymm)
+{
+    return _mm256_and_pd(ymm, _mm256_cmp_pd(ymm, ymm, _CMP_ORD_Q));
+}
+
+// Add 0.5 with the sign of the value, i.e. round half away from zero once
+// truncated.
+inline __m256 AddHalfAwayFromZero(__m256 ymm)
+{
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    return _mm256_add_ps(
+        ymm, _mm256_or_ps(_mm256_and_ps(ymm, signMask), _mm256_set1_ps(0.5f)));
+}
+
+inline __m256d AddHalfAwayFromZero(__m256d ymm)
+{
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    return _mm256_add_pd(
+        ymm, _mm256_or_pd(_mm256_and_pd(ymm, signMask), _mm256_set1_pd(0.5)));
+}
+
+// Round to an unsigned type of maximum value fMax: NaN becomes 0.
+inline __m256i RoundToUnsigned(__m256 ymm, float fMax)
+{
+    ymm = _mm256_add_ps(ymm, _mm256_set1_ps(0.5f));
+    // _mm256_max_ps() returns its second argument when the first one is NaN
+    ymm = _mm256_max_ps(ymm, _mm256_setzero_ps());
+    ymm = _mm256_min_ps(ymm, _mm256_set1_ps(fMax));
+    return _mm256_cvttps_epi32(ymm);
+}
+
+inline __m128i RoundToUnsigned(__m256d ymm, double dfMax)
+{
+    ymm = _mm256_add_pd(ymm, _mm256_set1_pd(0.5));
+    ymm = _mm256_max_pd(ymm, _mm256_setzero_pd());
+    ymm = _mm256_min_pd(ymm, _mm256_set1_pd(dfMax));
+    return _mm256_cvttpd_epi32(ymm);
+}
+
+// Round to a signed type of range [dfMin, dfMax]: NaN becomes 0.
+inline __m256i RoundToSigned(__m256 ymm, float fMin, float fMax)
+{
+    ymm = AddHalfAwayFromZero(ZeroNaN(ymm));
+    ymm = _mm256_max_ps(ymm, _mm256_set1_ps(fMin));
+    ymm = _mm256_min_ps(ymm, _mm256_set1_ps(fMax));
+    return _mm256_cvttps_epi32(ymm);
+}
+
+inline __m128i RoundToSigned(__m256d ymm, double dfMin, double dfMax)
+{
+    ymm = AddHalfAwayFromZero(ZeroNaN(ymm));
+    ymm = _mm256_max_pd(ymm, _mm256_set1_pd(dfMin));
+    ymm = _mm256_min_pd(ymm, _mm256_set1_pd(dfMax));
+    return _mm256_cvttpd_epi32(ymm);
+}
+
+inline __m256i Combine(__m128i xmmLow, __m128i xmmHigh)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(xmmLow), xmmHigh,
+                                   1);
+}
+
+/************************************************************************/
+/*                            CopyWord8                                 */
+/************************************************************************/
+
+// Convert 8 consecutive words.
+
+template <class Tin, class Tout> struct CopyWord8
+{
+    // Integer input: widen to int32 and saturate to the output type.
+    static inline void f(const Tin *CPL_RESTRICT pSrc, Tout *CPL_RESTRICT pDst)
+    {
+        StoreFromInt32(LoadAsInt32(pSrc), pDst);
+    }
+};
+
+template <> struct CopyWord8<float, GByte>
+{
+    static inline void f(const float *CPL_RESTRICT pSrc,
+                         GByte *CPL_RESTRICT pDst)
+    {
+        StoreFromInt32(RoundToUnsigned(_mm256_loadu_ps(pSrc), 255.0f), pDst);
+    }
+};
+
+template <> struct CopyWord8<float, GUInt16>
+{
+    static inline void f(const float *CPL_RESTRICT pSrc,
+                         GUInt16 *CPL_RESTRICT pDst)
+    {
+        StoreFromInt32(RoundToUnsigned(_mm256_loadu_ps(pSrc), 65535.0f),
+                       pDst);
+    }
+};
+
+template <> struct CopyWord8<float, GInt16>
+{
+    static inline void f(const float *CPL_RESTRICT pSrc,
+                         GInt16 *CPL_RESTRICT pDst)
+    {
+        StoreFromInt32(
+            RoundToSigned(_mm256_loadu_ps(pSrc), -32768.0f, 32767.0f), pDst);
+    }
+};
+
+template <> struct CopyWord8<float, GInt32>
+{
+    static inline void f(const float *CPL_RESTRICT pSrc,
+                         GInt32 *CPL_RESTRICT pDst)
+    {
+        const __m256 ymm = ZeroNaN(_mm256_loadu_ps(pSrc));
+        // Values <= INT_MIN are converted to 0x80000000 by cvtt, which is
+        // INT_MIN, but values >= 2^31 must be explicitly set to INT_MAX.
+        const __m256i ymmTooLarge = _mm256_castps_si256(
+            _mm256_cmp_ps(ymm, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ));
+        const __m256i ymmRes = _mm256_blendv_epi8(
+            _mm256_cvttps_epi32(AddHalfAwayFromZero(ymm)),
+            _mm256_set1_epi32(std::numeric_limits<GInt32>::max()),
+            ymmTooLarge);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst), ymmRes);
+    }
+};
+
+template <> struct CopyWord8<float, double>
+{
+    static inline void f(const float *CPL_RESTRICT pSrc,
+                         double *CPL_RESTRICT pDst)
+    {
+        _mm256_storeu_pd(pDst, _mm256_cvtps_pd(_mm_loadu_ps(pSrc)));
+        _mm256_storeu_pd(pDst + 4, _mm256_cvtps_pd(_mm_loadu_ps(pSrc + 4)));
+    }
+};
+
+template <> struct CopyWord8<double, GByte>
+{
+    static inline void f(const double *CPL_RESTRICT pSrc,
+                         GByte *CPL_RESTRICT pDst)
+    {
+        StoreFromInt32(
+            Combine(RoundToUnsigned(_mm256_loadu_pd(pSrc), 255.0),
+                    RoundToUnsigned(_mm256_loadu_pd(pSrc + 4), 255.0)),
+            pDst);
+    }
+};
+
+template <> struct CopyWord8<double, GUInt16>
+{
+    static inline void f(const double *CPL_RESTRICT pSrc,
+                         GUInt16 *CPL_RESTRICT pDst)
+    {
+        StoreFromInt32(
+            Combine(RoundToUnsigned(_mm256_loadu_pd(pSrc), 65535.0),
+                    RoundToUnsigned(_mm256_loadu_pd(pSrc + 4), 65535.0)),
+            pDst);
+    }
+};
+
+template <> struct CopyWord8<double, GInt16>
+{
+    static inline void f(const double *CPL_RESTRICT pSrc,
+                         GInt16 *CPL_RESTRICT pDst)
+    {
+        StoreFromInt32(
+            Combine(
+                RoundToSigned(_mm256_loadu_pd(pSrc), -32768.0, 32767.0),
+                RoundToSigned(_mm256_loadu_pd(pSrc + 4), -32768.0, 32767.0)),
+            pDst);
+    }
+};
+
+template <> struct CopyWord8<double, GInt32>
+{
+    static inline void f(const double *CPL_RESTRICT pSrc,
+                         GInt32 *CPL_RESTRICT pDst)
+    {
+        constexpr double dfMin = std::numeric_limits<GInt32>::min();
+        constexpr double dfMax = std::numeric_limits<GInt32>::max();
+        StoreFromInt32(
+            Combine(RoundToSigned(_mm256_loadu_pd(pSrc), dfMin, dfMax),
+                    RoundToSigned(_mm256_loadu_pd(pSrc + 4), dfMin, dfMax)),
+            pDst);
+    }
+};
+
+template <> struct CopyWord8<double, float>
+{
+    static inline __m128 Convert4(__m256d ymm)
+    {
+        // Values out of the float range become infinity.
+        const __m256d ymmMax =
+            _mm256_set1_pd(std::numeric_limits<float>::max());
+        const __m256d ymmInf =
+            _mm256_set1_pd(std::numeric_limits<double>::infinity());
+        ymm = _mm256_blendv_pd(ymm, ymmInf,
+                               _mm256_cmp_pd(ymm, ymmMax, _CMP_GT_OQ));
+        ymm = _mm256_blendv_pd(
+            ymm, _mm256_sub_pd(_mm256_setzero_pd(), ymmInf),
+            _mm256_cmp_pd(ymm, _mm256_sub_pd(_mm256_setzero_pd(), ymmMax),
+                          _CMP_LT_OQ));
+        return _mm256_cvtpd_ps(ymm);
+    }
+
+    static inline void f(const double *CPL_RESTRICT pSrc,
+                         float *CPL_RESTRICT pDst)
+    {
+        _mm_storeu_ps(pDst, Convert4(_mm256_loadu_pd(pSrc)));
+        _mm_storeu_ps(pDst + 4, Convert4(_mm256_loadu_pd(pSrc + 4)));
+    }
+};
+
+/************************************************************************/
+/*                         GDALCopyWordsAVX2()                          */
+/************************************************************************/
+
+template <class Tin, class Tout>
+size_t GDALCopyWordsAVX2(const void *CPL_RESTRICT pSrc,
+                         void *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    const Tin *CPL_RESTRICT pSrcT = static_cast<const Tin *>(pSrc);
+    Tout *CPL_RESTRICT pDstT = static_cast<Tout *>(pDst);
+    constexpr size_t VECTOR_WIDTH = 8;
+    size_t i = 0;
+    if (nWordCount >= 2 * VECTOR_WIDTH)
+    {
+        for (; i <= nWordCount - 2 * VECTOR_WIDTH; i += 2 * VECTOR_WIDTH)
+        {
+            CopyWord8<Tin, Tout>::f(pSrcT + i, pDstT + i);
+            CopyWord8<Tin, Tout>::f(pSrcT + i + VECTOR_WIDTH,
+                                    pDstT + i + VECTOR_WIDTH);
+        }
+    }
+    if (i + VECTOR_WIDTH <= nWordCount)
+    {
+        CopyWord8<Tin, Tout>::f(pSrcT + i, pDstT + i);
+        i += VECTOR_WIDTH;
+    }
+    return i;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     GDALGetCopyWordsFunc_AVX2()                      */
+/************************************************************************/
+
+/** Return the AVX2 kernel converting from eSrcType to eDstType, or nullptr
+ * if that pair of data types has no AVX2 specialization.
+ */
+GDALCopyWordsAVX2Func GDALGetCopyWordsFunc_AVX2(GDALDataType eSrcType,
+                                                GDALDataType eDstType)
+{
+    switch (eSrcType)
+    {
+        case GDT_Byte:
+            switch (eDstType)
+            {
+                case GDT_UInt16:
+                    return GDALCopyWordsAVX2<GByte, GUInt16>;
+                case GDT_Int16:
+                    return GDALCopyWordsAVX2<GByte, GInt16>;
+                case GDT_UInt32:
+                    return GDALCopyWordsAVX2<GByte, GUInt32>;
+                case GDT_Int32:
+                    return GDALCopyWordsAVX2<GByte, GInt32>;
+                case GDT_Float32:
+                    return GDALCopyWordsAVX2<GByte, float>;
+                case GDT_Float64:
+                    return GDALCopyWordsAVX2<GByte, double>;
+                default:
+                    break;
+            }
+            break;
+
+        case GDT_UInt16:
+            switch (eDstType)
+            {
+                case GDT_Byte:
+                    return GDALCopyWordsAVX2<GUInt16, GByte>;
+                case GDT_Int16:
+                    return GDALCopyWordsAVX2<GUInt16, GInt16>;
+                case GDT_UInt32:
+                    return GDALCopyWordsAVX2<GUInt16, GUInt32>;
+                case GDT_Int32:
+                    return GDALCopyWordsAVX2<GUInt16, GInt32>;
+                case GDT_Float32:
+                    return GDALCopyWordsAVX2<GUInt16, float>;
+                case GDT_Float64:
+                    return GDALCopyWordsAVX2<GUInt16, double>;
+                default:
+                    break;
+            }
+            break;
+
+        case GDT_Int16:
+            switch (eDstType)
+            {
+                case GDT_Byte:
+                    return GDALCopyWordsAVX2<GInt16, GByte>;
+                case GDT_UInt16:
+                    return GDALCopyWordsAVX2<GInt16, GUInt16>;
+                case GDT_Int32:
+                    return GDALCopyWordsAVX2<GInt16, GInt32>;
+                case GDT_Float32:
+                    return GDALCopyWordsAVX2<GInt16, float>;
+                case GDT_Float64:
+                    return GDALCopyWordsAVX2<GInt16, double>;
+                default:
+                    break;
+            }
+            break;
+
+        case GDT_Int32:
+            switch (eDstType)
+            {
+                case GDT_Byte:
+                    return GDALCopyWordsAVX2<GInt32, GByte>;
+                case GDT_UInt16:
+                    return GDALCopyWordsAVX2<GInt32, GUInt16>;
+                case GDT_Int16:
+                    return GDALCopyWordsAVX2<GInt32, GInt16>;
+                case GDT_Float32:
+                    return GDALCopyWordsAVX2<GInt32, float>;
+                case GDT_Float64:
+                    return GDALCopyWordsAVX2<GInt32, double>;
+                default:
+                    break;
+            }
+            break;
+
+        case GDT_Float32:
+            switch (eDstType)
+            {
+                case GDT_Byte:
+                    return GDALCopyWordsAVX2<float, GByte>;
+                case GDT_UInt16:
+                    return GDALCopyWordsAVX2<float, GUInt16>;
+                case GDT_Int16:
+                    return GDALCopyWordsAVX2<float, GInt16>;
+                case GDT_Int32:
+                    return GDALCopyWordsAVX2<float, GInt32>;
+                case GDT_Float64:
+                    return GDALCopyWordsAVX2<float, double>;
+                default:
+                    break;
+            }
+            break;
+
+        case GDT_Float64:
+            switch (eDstType)
+            {
+                case GDT_Byte:
+                    return GDALCopyWordsAVX2<double, GByte>;
+                case GDT_UInt16:
+                    return GDALCopyWordsAVX2<double, GUInt16>;
+                case GDT_Int16:
+                    return GDALCopyWordsAVX2<double, GInt16>;
+                case GDT_Int32:
+                    return GDALCopyWordsAVX2<double, GInt32>;
+                case GDT_Float32:
+                    return GDALCopyWordsAVX2<double, float>;
+                default:
+                    break;
+            }
+            break;
+
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        Transposition kernels                         */
+/************************************************************************/
+
+namespace
+{
+
+// Transpose a tile of K x K words: apDst[j][i] = apSrc[i][j]
+
+template <class T> struct TransposeTile;
+
+template <> struct TransposeTile<uint8_t>
+{
+    static constexpr int K = 8;
+
+    static inline void f(const uint8_t *const *apSrc, uint8_t *const *apDst)
+    {
+        __m128i a[K];
+        for (int i = 0; i < K; ++i)
+            a[i] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(apSrc[i]));
+        // b0 = a0_0 a1_0 a0_1 a1_1 ... a0_7 a1_7
+        const __m128i b0 = _mm_unpacklo_epi8(a[0], a[1]);
+        const __m128i b1 = _mm_unpacklo_epi8(a[2], a[3]);
+        const __m128i b2 = _mm_unpacklo_epi8(a[4], a[5]);
+        const __m128i b3 = _mm_unpacklo_epi8(a[6], a[7]);
+        // c0 = a0_0 a1_0 a2_0 a3_0 a0_1 a1_1 a2_1 a3_1 ... (columns 0-3)
+        const __m128i c0 = _mm_unpacklo_epi16(b0, b1);
+        const __m128i c1 = _mm_unpackhi_epi16(b0, b1);
+        const __m128i c2 = _mm_unpacklo_epi16(b2, b3);
+        const __m128i c3 = _mm_unpackhi_epi16(b2, b3);
+        // d0 = columns 0 and 1, d1 = columns 2 and 3, etc.
+        const __m128i d[4] = {
+            _mm_unpacklo_epi32(c0, c2), _mm_unpackhi_epi32(c0, c2),
+            _mm_unpacklo_epi32(c1, c3), _mm_unpackhi_epi32(c1, c3)};
+        for (int i = 0; i < 4; ++i)
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(apDst[2 * i]), d[i]);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(apDst[2 * i + 1]),
+                             _mm_unpackhi_epi64(d[i], d[i]));
+        }
+    }
+};
+
+template <> struct TransposeTile<uint16_t>
+{
+    static constexpr int K = 8;
+
+    static inline void f(const uint16_t *const *apSrc, uint16_t *const *apDst)
+    {
+        __m128i a[K];
+        for (int i = 0; i < K; ++i)
+            a[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(apSrc[i]));
+        __m128i b[K];
+        for (int i = 0; i < K / 2; ++i)
+        {
+            b[2 * i] = _mm_unpacklo_epi16(a[2 * i], a[2 * i + 1]);
+            b[2 * i + 1] = _mm_unpackhi_epi16(a[2 * i], a[2 * i + 1]);
+        }
+        // c0 = columns 0 and 1 of rows 0-3, c1 = columns 2 and 3 of rows 0-3,
+        // c2 = columns 4 and 5 of rows 0-3, c3 = columns 6 and 7 of rows 0-3
+        // c4..c7 = same for rows 4-7
+        const __m128i c[K] = {
+            _mm_unpacklo_epi32(b[0], b[2]), _mm_unpackhi_epi32(b[0], b[2]),
+            _mm_unpacklo_epi32(b[1], b[3]), _mm_unpackhi_epi32(b[1], b[3]),
+            _mm_unpacklo_epi32(b[4], b[6]), _mm_unpackhi_epi32(b[4], b[6]),
+            _mm_unpacklo_epi32(b[5], b[7]), _mm_unpackhi_epi32(b[5], b[7])};
+        for (int i = 0; i < K / 2; ++i)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(apDst[2 * i]),
+                             _mm_unpacklo_epi64(c[i], c[i + 4]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(apDst[2 * i + 1]),
+                             _mm_unpackhi_epi64(c[i], c[i + 4]));
+        }
+    }
+};
+
+template <> struct TransposeTile<uint32_t>
+{
+    static constexpr int K = 8;
+
+    static inline void f(const uint32_t *const *apSrc, uint32_t *const *apDst)
+    {
+        __m256 a[K];
+        for (int i = 0; i < K; ++i)
+            a[i] = _mm256_loadu_ps(reinterpret_cast<const float *>(apSrc[i]));
+        __m256 b[K];
+        for (int i = 0; i < K / 2; ++i)
+        {
+            b[2 * i] = _mm256_unpacklo_ps(a[2 * i], a[2 * i + 1]);
+            b[2 * i + 1] = _mm256_unpackhi_ps(a[2 * i], a[2 * i + 1]);
+        }
+        __m256 c[K];
+        for (int i = 0; i < K / 4; ++i)
+        {
+            c[4 * i + 0] = _mm256_shuffle_ps(b[4 * i], b[4 * i + 2],
+                                             _MM_SHUFFLE(1, 0, 1, 0));
+            c[4 * i + 1] = _mm256_shuffle_ps(b[4 * i], b[4 * i + 2],
+                                             _MM_SHUFFLE(3, 2, 3, 2));
+            c[4 * i + 2] = _mm256_shuffle_ps(b[4 * i + 1], b[4 * i + 3],
+                                             _MM_SHUFFLE(1, 0, 1, 0));
+            c[4 * i + 3] = _mm256_shuffle_ps(b[4 * i + 1], b[4 * i + 3],
+                                             _MM_SHUFFLE(3, 2, 3, 2));
+        }
+        for (int i = 0; i < K / 2; ++i)
+        {
+            _mm256_storeu_ps(reinterpret_cast<float *>(apDst[i]),
+                             _mm256_permute2f128_ps(c[i], c[i + 4], 0x20));
+            _mm256_storeu_ps(reinterpret_cast<float *>(apDst[i + 4]),
+                             _mm256_permute2f128_ps(c[i], c[i + 4], 0x31));
+        }
+    }
+};
+
+template <> struct TransposeTile<uint64_t>
+{
+    static constexpr int K = 4;
+
+    static inline void f(const uint64_t *const *apSrc, uint64_t *const *apDst)
+    {
+        __m256d a[K];
+        for (int i = 0; i < K; ++i)
+            a[i] = _mm256_loadu_pd(reinterpret_cast<const double *>(apSrc[i]));
+        const __m256d b0 = _mm256_unpacklo_pd(a[0], a[1]);
+        const __m256d b1 = _mm256_unpackhi_pd(a[0], a[1]);
+        const __m256d b2 = _mm256_unpacklo_pd(a[2], a[3]);
+        const __m256d b3 = _mm256_unpackhi_pd(a[2], a[3]);
+        _mm256_storeu_pd(reinterpret_cast<double *>(apDst[0]),
+                         _mm256_permute2f128_pd(b0, b2, 0x20));
+        _mm256_storeu_pd(reinterpret_cast<double *>(apDst[1]),
+                         _mm256_permute2f128_pd(b1, b3, 0x20));
+        _mm256_storeu_pd(reinterpret_cast<double *>(apDst[2]),
+                         _mm256_permute2f128_pd(b0, b2, 0x31));
+        _mm256_storeu_pd(reinterpret_cast<double *>(apDst[3]),
+                         _mm256_permute2f128_pd(b1, b3, 0x31));
+    }
+};
+
+// Number of bytes of the pixel-interleaved buffer processed at once, so that
+// it remains in the L1 cache while being scanned once per group of
+// components.
+constexpr size_t INTERLEAVED_BLOCK_SIZE = 16 * 1024;
+
+/************************************************************************/
+/*                        GDALDeinterleaveT()                           */
+/************************************************************************/
+
+template <class T>
+void GDALDeinterleaveT(const T *CPL_RESTRICT pSrc, int nComponents,
+                       T *const *ppDst, size_t nIters)
+{
+    constexpr int K = TransposeTile<T>::K;
+    CPLAssert(nComponents >= K && nIters >= static_cast<size_t>(K));
+    const size_t nPixelsPerBlock = std::max<size_t>(
+        K, INTERLEAVED_BLOCK_SIZE / (nComponents * sizeof(T)) / K * K);
+    const T *apSrc[K];
+    T *apDst[K];
+    for (size_t i0 = 0; i0 < nIters; i0 += nPixelsPerBlock)
+    {
+        const size_t i1 = std::min(nIters, i0 + nPixelsPerBlock);
+        int c = 0;
+        for (; c + K <= nComponents; c += K)
+        {
+            // The last group of pixels may overlap the previous one, which
+            // is harmless.
+            for (size_t i = i0; i < i1; i += K)
+            {
+                const size_t iTile = std::min(i, i1 - K);
+                for (int k = 0; k < K; ++k)
+                {
+                    apSrc[k] = pSrc + (iTile + k) * nComponents + c;
+                    apDst[k] = ppDst[c + k] + iTile;
+                }
+                TransposeTile<T>::f(apSrc, apDst);
+            }
+        }
+        for (; c < nComponents; ++c)
+        {
+            T *CPL_RESTRICT pDst = ppDst[c];
+            for (size_t i = i0; i < i1; ++i)
+                pDst[i] = pSrc[i * nComponents + c];
+        }
+    }
+}
+
+/************************************************************************/
+/*                         GDALInterleaveT()                            */
+/************************************************************************/
+
+template <class T>
+void GDALInterleaveT(const T *const *ppSrc, int nComponents,
+                     T *CPL_RESTRICT pDst, size_t nIters)
+{
+    constexpr int K = TransposeTile<T>::K;
+    CPLAssert(nComponents >= K && nIters >= static_cast<size_t>(K));
+    const size_t nPixelsPerBlock = std::max<size_t>(
+        K, INTERLEAVED_BLOCK_SIZE / (nComponents * sizeof(T)) / K * K);
+    const T *apSrc[K];
+    T *apDst[K];
+    for (size_t i0 = 0; i0 < nIters; i0 += nPixelsPerBlock)
+    {
+        const size_t i1 = std::min(nIters, i0 + nPixelsPerBlock);
+        int c = 0;
+        for (; c + K <= nComponents; c += K)
+        {
+            for (size_t i = i0; i < i1; i += K)
+            {
+                const size_t iTile = std::min(i, i1 - K);
+                for (int k = 0; k < K; ++k)
+                {
+                    apSrc[k] = ppSrc[c + k] + iTile;
+                    apDst[k] = pDst + (iTile + k) * nComponents + c;
+                }
+                TransposeTile<T>::f(apSrc, apDst);
+            }
+        }
+        for (; c < nComponents; ++c)
+        {
+            const T *CPL_RESTRICT pSrc = ppSrc[c];
+            for (size_t i = i0; i < i1; ++i)
+                pDst[i * nComponents + c] = pSrc[i];
+        }
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                       GDALDeinterleave_AVX2()                        */
+/************************************************************************/
+
+/** Deinterleave nIters pixels of nComponents words of nWordSize bytes.
+ *
+ * nWordSize must be 1, 2, 4 or 8, and nComponents and nIters must be at
+ * least 8 (4 for nWordSize == 8).
+ */
+void GDALDeinterleave_AVX2(const void *CPL_RESTRICT pSrc, int nComponents,
+                           void *const *ppDst, int nWordSize, size_t nIters)
+{
+    switch (nWordSize)
+    {
+        case 1:
+            GDALDeinterleaveT(static_cast<const uint8_t *>(pSrc), nComponents,
+                              reinterpret_cast<uint8_t *const *>(ppDst),
+                              nIters);
+            break;
+        case 2:
+            GDALDeinterleaveT(static_cast<const uint16_t *>(pSrc), nComponents,
+                              reinterpret_cast<uint16_t *const *>(ppDst),
+                              nIters);
+            break;
+        case 4:
+            GDALDeinterleaveT(static_cast<const uint32_t *>(pSrc), nComponents,
+                              reinterpret_cast<uint32_t *const *>(ppDst),
+                              nIters);
+            break;
+        case 8:
+            GDALDeinterleaveT(static_cast<const uint64_t *>(pSrc), nComponents,
+                              reinterpret_cast<uint64_t *const *>(ppDst),
+                              nIters);
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                        GDALInterleave_AVX2()                         */
+/************************************************************************/
+
+/** Interleave nComponents buffers of nIters words of nWordSize bytes.
+ *
+ * Same constraints as GDALDeinterleave_AVX2().
+ */
+void GDALInterleave_AVX2(const void *const *ppSrc, int nComponents,
+                         void *CPL_RESTRICT pDst, int nWordSize, size_t nIters)
+{
+    switch (nWordSize)
+    {
+        case 1:
+            GDALInterleaveT(reinterpret_cast<const uint8_t *const *>(ppSrc),
+                            nComponents, static_cast<uint8_t *>(pDst), nIters);
+            break;
+        case 2:
+            GDALInterleaveT(reinterpret_cast<const uint16_t *const *>(ppSrc),
+                            nComponents, static_cast<uint16_t *>(pDst),
+                            nIters);
+            break;
+        case 4:
+            GDALInterleaveT(reinterpret_cast<const uint32_t *const *>(ppSrc),
+                            nComponents, static_cast<uint32_t *>(pDst),
+                            nIters);
+            break;
+        case 8:
+            GDALInterleaveT(reinterpret_cast<const uint64_t *const *>(ppSrc),
+                            nComponents, static_cast<uint64_t *>(pDst),
+                            nIters);
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+#endif
@@ -0,0 +1,45 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef RASTERIO_AVX2_H_INCLUDED
+#define RASTERIO_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+#include "gdal.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+/** Signature of a packed conversion kernel.
+ *
+ * Converts the first nWordCount words of the packed (contiguous) pSrc
+ * buffer into pDst, with the same semantics as GDALCopyWord().
+ * Only a multiple of the vector width is processed: the number of words
+ * actually converted is returned, and the caller is responsible for the
+ * remaining ones.
+ */
+typedef size_t (*GDALCopyWordsAVX2Func)(const void *CPL_RESTRICT pSrc,
+                                        void *CPL_RESTRICT pDst,
+                                        size_t nWordCount);
+
+GDALCopyWordsAVX2Func GDALGetCopyWordsFunc_AVX2(GDALDataType eSrcType,
+                                                GDALDataType eDstType);
+
+void GDALDeinterleave_AVX2(const void *CPL_RESTRICT pSrc, int nComponents,
+                           void *const *ppDst, int nWordSize, size_t nIters);
+
+void GDALInterleave_AVX2(const void *const *ppSrc, int nComponents,
+                         void *CPL_RESTRICT pDst, int nWordSize,
+                         size_t nIters);
+
+#endif
+
+#endif /* RASTERIO_AVX2_H_INCLUDED */
@@ -647,15 +647,16 @@ CPLErr RawRasterBand::IReadBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
     if (eErr == CE_Failure)
         return eErr;
 
-    // Copy data from disk buffer to user block buffer.
     const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
-    GDALCopyWords64(pLineStart, eDataType, nPixelOffset, pImage, eDataType,
-                    nDTSize, nBlockXSize);
+    bool bDeinterleaved = false;
 
     // Pre-cache block cache of other bands
     if (poDS != nullptr && poDS->GetRasterCount() > 1 && IsBIP())
     {
-        for (int iBand = 1; iBand <= poDS->GetRasterCount(); iBand++)
+        const int nBands = poDS->GetRasterCount();
+        std::vector<GDALRasterBlock *> apoBlocks(nBands);
+        bool bAllOtherBlocksToLoad = true;
+        for (int iBand = 1; iBand <= nBands; iBand++)
         {
             if (iBand != nBand)
             {
@@ -666,20 +667,60 @@ CPLErr RawRasterBand::IReadBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
                 if (poBlock != nullptr)
                 {
                     poBlock->DropLock();
+                    bAllOtherBlocksToLoad = false;
                     continue;
                 }
                 poBlock = poOtherBand->GetLockedBlockRef(0, nBlockYOff, true);
-                if (poBlock != nullptr)
+                if (poBlock == nullptr)
+                    bAllOtherBlocksToLoad = false;
+                apoBlocks[iBand - 1] = poBlock;
+            }
+        }
+
+        if (bAllOtherBlocksToLoad && nBands >= 3 &&
+            nPixelOffset == nBands * nDTSize)
+        {
+            bDeinterleaved = true;
+            // Packed pixel-interleaved scanline: de-interleave all bands in a
+            // single pass.
+            std::vector<void *> apDest(nBands);
+            for (int iBand = 0; iBand < nBands; iBand++)
+            {
+                apDest[iBand] = iBand + 1 == nBand
+                                    ? pImage
+                                    : apoBlocks[iBand]->GetDataRef();
+            }
+            GDALDeinterleave(static_cast<const GByte *>(pLineStart) -
+                                 (nBand - 1) * nDTSize,
+                             eDataType, nBands, apDest.data(), eDataType,
+                             nBlockXSize);
+        }
+
+        for (int iBand = 1; iBand <= nBands; iBand++)
+        {
+            GDALRasterBlock *poBlock = apoBlocks[iBand - 1];
+            if (poBlock != nullptr)
+            {
+                if (!bDeinterleaved)
                 {
+                    auto poOtherBand = cpl::down_cast<RawRasterBand *>(
+                        poDS->GetRasterBand(iBand));
                     GDALCopyWords64(poOtherBand->pLineStart, eDataType,
                                     nPixelOffset, poBlock->GetDataRef(),
                                     eDataType, nDTSize, nBlockXSize);
-                    poBlock->DropLock();
                 }
+                poBlock->DropLock();
             }
         }
     }
 
+    // Copy data from disk buffer to user block buffer.
+    if (!bDeinterleaved)
+    {
+        GDALCopyWords64(pLineStart, eDataType, nPixelOffset, pImage, eDataType,
+                        nDTSize, nBlockXSize);
+    }
+
     return eErr;
 }
 
@@ -741,6 +782,32 @@ CPLErr RawRasterBand::BIPWriteBlock(int nBlockYOff, int nCallingBand,
             return CE_Failure;
         }
     }
+    else if (nBands >= 3 && nPixelOffset == nBands * nDTSize)
+    {
+        // Packed pixel-interleaved scanline, and all bands are available:
+        // interleave them in a single pass.
+        std::vector<const void *> apSrc(nBands);
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            apSrc[iBand] = iBand + 1 == nCallingBand
+                               ? pImage
+                               : apoBlocks[iBand]->GetDataRef();
+        }
+        GDALInterleave(apSrc.data(), eDataType, nBands, pLineStart, eDataType,
+                       nBlockXSize);
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            if (apoBlocks[iBand] != nullptr)
+            {
+                apoBlocks[iBand]->MarkClean();
+                apoBlocks[iBand]->DropLock();
+            }
+        }
+
+        nLoadedScanline = nBlockYOff;
+        bLoadedScanlineDirty = true;
+        return FlushCurrentLine(true) ? CE_None : CE_Failure;
+    }
 
     for (int iBand = 0; iBand < nBands; ++iBand)
     {
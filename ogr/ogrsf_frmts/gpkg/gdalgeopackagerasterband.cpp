@@ -15,9 +15,12 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <set>
@@ -27,6 +30,54 @@
 #define DEBUG_VERBOSE
 #endif
 
+/************************************************************************/
+/*                          GPKGTileEncodeJob                           */
+/************************************************************************/
+
+// Tile encoded by a worker thread, and waiting to be inserted in the
+// database by the main thread.
+struct GPKGTileEncodeJob
+{
+    GDALGPKGMBTilesLikePseudoDataset *poDS = nullptr;
+    int nRow = 0;
+    int nCol = 0;
+    GDALDriver *poDriver = nullptr;
+    std::unique_ptr<GDALDataset> poSrcDS{};
+    CPLStringList aosOptions{};
+    CPLString osMemFileName{};
+    CPLErrorAccumulator oErrorAccumulator{};
+    GByte *pabyBlob = nullptr;
+    vsi_l_offset nBlobSize = 0;
+    std::atomic<bool> bReady{false};
+
+    GPKGTileEncodeJob() = default;
+
+    ~GPKGTileEncodeJob()
+    {
+        CPLFree(pabyBlob);
+    }
+
+    void Run()
+    {
+        {
+            auto oContext = oErrorAccumulator.InstallForCurrentScope();
+            GDALDataset *poOutDS =
+                poDriver->CreateCopy(osMemFileName, poSrcDS.get(), FALSE,
+                                     aosOptions.List(), nullptr, nullptr);
+            if (poOutDS)
+            {
+                GDALClose(poOutDS);
+                pabyBlob = VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
+            }
+            VSIUnlink(osMemFileName);
+            poSrcDS.reset();
+        }
+        bReady = true;
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GPKGTileEncodeJob)
+};
+
 /************************************************************************/
 /*                    GDALGPKGMBTilesLikePseudoDataset()                */
 /************************************************************************/
@@ -70,6 +121,36 @@ GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
     CPLFree(m_pabyHugeColorArray);
 }
 
+/************************************************************************/
+/*                       ParseNumThreadsOption()                        */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::ParseNumThreadsOption(
+    CSLConstList papszOptions)
+{
+    const char *pszValue = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszValue == nullptr)
+        pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszValue)
+    {
+        int nThreads =
+            EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+        if (nThreads > 1024)
+            nThreads = 1024;  // to please Coverity
+        if (nThreads > 1)
+        {
+            m_nEncodeThreads = nThreads;
+        }
+        else if (nThreads < 0 ||
+                 (!EQUAL(pszValue, "0") && !EQUAL(pszValue, "1") &&
+                  !EQUAL(pszValue, "ALL_CPUS")))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value for NUM_THREADS: %s", pszValue);
+        }
+    }
+}
+
 /************************************************************************/
 /*                            SetDataType()                             */
 /************************************************************************/
@@ -156,6 +237,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushTiles()
         }
     }
 
+    if (FlushEncodeJobs() != CE_None)
+        eErr = CE_Failure;
+
     if (poMainDS->m_nTileInsertionCount > 0)
     {
         if (poMainDS->ICommitTransaction() != OGRERR_NONE)
@@ -869,6 +953,11 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
 
+    // Make sure that a tile being encoded by a worker thread is in the
+    // database
+    if (HasPendingEncodeJob(nRow, nCol))
+        FlushEncodeJobs();
+
     char *pszSQL = sqlite3_mprintf(
         "SELECT tile_data%s FROM \"%w\" "
         "WHERE zoom_level = %d AND tile_row = %d AND tile_column = %d%s",
@@ -1400,6 +1489,11 @@ GIntBig GDALGPKGMBTilesLikePseudoDataset::GetTileId(int nRow, int nCol)
 
 bool GDALGPKGMBTilesLikePseudoDataset::DeleteTile(int nRow, int nCol)
 {
+    // Make sure that a pending insertion of the same tile does not happen
+    // after its deletion
+    if (HasPendingEncodeJob(nRow, nCol))
+        FlushEncodeJobs();
+
     char *pszSQL =
         sqlite3_mprintf("DELETE FROM \"%w\" "
                         "WHERE zoom_level = %d AND tile_row = %d AND "
@@ -1547,6 +1641,194 @@ static void ProcessInt16UInt16Tile(
     }
 }
 
+/************************************************************************/
+/*                          SubmitEncodeJob()                           */
+/************************************************************************/
+
+// Submit the encoding of a tile to a worker thread. The pixel content of
+// poMEMDS is copied, so it can be discarded by the caller.
+bool GDALGPKGMBTilesLikePseudoDataset::SubmitEncodeJob(
+    int nRow, int nCol, GDALDriver *poDriver, GDALDataset *poMEMDS,
+    CSLConstList papszOptions)
+{
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nEncodeThreads <= 1)
+        return false;
+    if (!poMainDS->m_poEncodeQueue)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(poMainDS->m_nEncodeThreads);
+        if (!poThreadPool)
+        {
+            poMainDS->m_nEncodeThreads = 0;
+            return false;
+        }
+        CPLDebug("GPKG", "Using up to %d threads for tile encoding",
+                 poMainDS->m_nEncodeThreads);
+        poMainDS->m_poEncodeQueue = poThreadPool->CreateJobQueue();
+    }
+
+    auto psJob = std::make_unique<GPKGTileEncodeJob>();
+    psJob->poDS = this;
+    psJob->nRow = nRow;
+    psJob->nCol = nCol;
+    psJob->poDriver = poDriver;
+    psJob->aosOptions = CSLDuplicate(papszOptions);
+    psJob->osMemFileName = VSIMemGenerateHiddenFilename("gpkg_encode_tile");
+
+    const int nTileBands = poMEMDS->GetRasterCount();
+    psJob->poSrcDS.reset(MEMDataset::Create(
+        "", poMEMDS->GetRasterXSize(), poMEMDS->GetRasterYSize(), nTileBands,
+        poMEMDS->GetRasterBand(1)->GetRasterDataType(), nullptr));
+    if (!psJob->poSrcDS ||
+        GDALDatasetCopyWholeRaster(GDALDataset::ToHandle(poMEMDS),
+                                   GDALDataset::ToHandle(psJob->poSrcDS.get()),
+                                   nullptr, nullptr, nullptr) != CE_None)
+    {
+        return false;
+    }
+    if (const auto poCT = poMEMDS->GetRasterBand(1)->GetColorTable())
+        psJob->poSrcDS->GetRasterBand(1)->SetColorTable(poCT);
+
+    auto psJobRaw = psJob.get();
+    poMainDS->m_apoEncodeJobs.push_back(std::move(psJob));
+    if (!poMainDS->m_poEncodeQueue->SubmitJob([psJobRaw]()
+                                              { psJobRaw->Run(); }))
+    {
+        poMainDS->m_apoEncodeJobs.pop_back();
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        HasPendingEncodeJob()                         */
+/************************************************************************/
+
+bool GDALGPKGMBTilesLikePseudoDataset::HasPendingEncodeJob(int nRow, int nCol)
+{
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    for (const auto &psJob : poMainDS->m_apoEncodeJobs)
+    {
+        if (psJob->poDS == this && psJob->nRow == nRow && psJob->nCol == nCol)
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          FlushEncodeJobs()                           */
+/************************************************************************/
+
+// Insert in the database the tiles encoded by worker threads, in the order
+// in which they have been submitted, until there are no more than
+// nMaxPendingJobs jobs pending.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushEncodeJobs(size_t nMaxPendingJobs)
+{
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    auto &apoJobs = poMainDS->m_apoEncodeJobs;
+    CPLErr eErr = CE_None;
+    while (!apoJobs.empty())
+    {
+        if (!apoJobs.front()->bReady)
+        {
+            if (apoJobs.size() <= nMaxPendingJobs)
+                break;
+            poMainDS->m_poEncodeQueue->WaitEvent();
+            continue;
+        }
+
+        auto psJob = std::move(apoJobs.front());
+        apoJobs.pop_front();
+        psJob->oErrorAccumulator.ReplayErrors();
+        if (psJob->pabyBlob == nullptr)
+        {
+            eErr = CE_Failure;
+            continue;
+        }
+        GByte *pabyBlob = psJob->pabyBlob;
+        psJob->pabyBlob = nullptr;
+        if (psJob->poDS->InsertTile(psJob->nRow, psJob->nCol, pabyBlob,
+                                    psJob->nBlobSize) != CE_None)
+        {
+            eErr = CE_Failure;
+        }
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                            InsertTile()                              */
+/************************************************************************/
+
+// Insert an encoded tile in the database. Takes ownership of pabyBlob.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::InsertTile(int nRow, int nCol,
+                                                    GByte *pabyBlob,
+                                                    vsi_l_offset nBlobSize)
+{
+    /* Create or commit and recreate transaction */
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nTileInsertionCount < 0)
+    {
+        CPLFree(pabyBlob);
+        return CE_Failure;
+    }
+    if (poMainDS->m_nTileInsertionCount == 0)
+    {
+        poMainDS->IStartTransaction();
+    }
+    else if (poMainDS->m_nTileInsertionCount == 1000)
+    {
+        if (poMainDS->ICommitTransaction() != OGRERR_NONE)
+        {
+            poMainDS->m_nTileInsertionCount = -1;
+            CPLFree(pabyBlob);
+            return CE_Failure;
+        }
+        poMainDS->IStartTransaction();
+        poMainDS->m_nTileInsertionCount = 0;
+    }
+    poMainDS->m_nTileInsertionCount++;
+
+    char *pszSQL = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
+                                   "(zoom_level, tile_row, tile_column, "
+                                   "tile_data) VALUES (%d, %d, %d, ?)",
+                                   m_osRasterTable.c_str(), m_nZoomLevel,
+                                   GetRowFromIntoTopConvention(nRow), nCol);
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+    CPLErr eErr = CE_Failure;
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    if (rc != SQLITE_OK)
+    {
+        CPLFree(pabyBlob);
+    }
+    else
+    {
+        sqlite3_bind_blob(hStmt, 1, pabyBlob, static_cast<int>(nBlobSize),
+                          CPLFree);
+        rc = sqlite3_step(hStmt);
+        if (rc == SQLITE_DONE)
+            eErr = CE_None;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when inserting tile (row=%d,col=%d) at "
+                     "zoom_level=%d : %s",
+                     GetRowFromIntoTopConvention(nRow), nCol, m_nZoomLevel,
+                     sqlite3_errmsg(IGetDB()));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    sqlite3_free(pszSQL);
+    return eErr;
+}
+
 /************************************************************************/
 /*                         WriteTile()                                  */
 /************************************************************************/
@@ -2362,6 +2644,23 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                                     CPLSPrintf("%d", nBlockYSize));
             }
         }
+        // Elevation tiles require extra insertions in
+        // gpkg_2d_gridded_tile_ancillary, so they are encoded synchronously.
+        if (m_eTF != GPKG_TF_PNG_16BIT && m_eTF != GPKG_TF_TIFF_32BIT_FLOAT &&
+            SubmitEncodeJob(nRow, nCol, l_poDriver, poMEMDS,
+                            papszDriverOptions))
+        {
+            CSLDestroy(papszDriverOptions);
+            delete poMEMDS;
+
+            // Insert the tiles whose encoding is finished, and limit the
+            // number of pending tiles to a few times the number of threads.
+            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+                m_poParentDS ? m_poParentDS : this;
+            return FlushEncodeJobs(
+                static_cast<size_t>(poMainDS->m_nEncodeThreads) * 2);
+        }
+
 #ifdef DEBUG
         VSIStatBufL sStat;
         CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
@@ -2379,63 +2678,10 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             GByte *pabyBlob =
                 VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
 
-            /* Create or commit and recreate transaction */
-            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
-                m_poParentDS ? m_poParentDS : this;
-            if (poMainDS->m_nTileInsertionCount == 0)
-            {
-                poMainDS->IStartTransaction();
-            }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
-            {
-                if (poMainDS->ICommitTransaction() != OGRERR_NONE)
-                {
-                    poMainDS->m_nTileInsertionCount = -1;
-                    CPLFree(pabyBlob);
-                    VSIUnlink(osMemFileName);
-                    delete poMEMDS;
-                    return CE_Failure;
-                }
-                poMainDS->IStartTransaction();
-                poMainDS->m_nTileInsertionCount = 0;
-            }
-            poMainDS->m_nTileInsertionCount++;
-
-            char *pszSQL =
-                sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
-                                "(zoom_level, tile_row, tile_column, "
-                                "tile_data) VALUES (%d, %d, %d, ?)",
-                                m_osRasterTable.c_str(), m_nZoomLevel,
-                                GetRowFromIntoTopConvention(nRow), nCol);
-#ifdef DEBUG_VERBOSE
-            CPLDebug("GPKG", "%s", pszSQL);
-#endif
-            sqlite3_stmt *hStmt = nullptr;
-            int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
-            if (rc != SQLITE_OK)
-            {
-                CPLFree(pabyBlob);
-            }
-            else
-            {
-                sqlite3_bind_blob(hStmt, 1, pabyBlob,
-                                  static_cast<int>(nBlobSize), CPLFree);
-                rc = sqlite3_step(hStmt);
-                if (rc == SQLITE_DONE)
-                    eErr = CE_None;
-                else
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Failure when inserting tile (row=%d,col=%d) at "
-                             "zoom_level=%d : %s",
-                             GetRowFromIntoTopConvention(nRow), nCol,
-                             m_nZoomLevel, sqlite3_errmsg(IGetDB()));
-                }
-            }
-            sqlite3_finalize(hStmt);
-            sqlite3_free(pszSQL);
+            eErr = InsertTile(nRow, nCol, pabyBlob, nBlobSize);
 
-            if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
+            if (eErr == CE_None && (m_eTF == GPKG_TF_PNG_16BIT ||
+                                    m_eTF == GPKG_TF_TIFF_32BIT_FLOAT))
             {
                 GIntBig nTileId = GetTileId(nRow, nCol);
                 if (nTileId == 0)
@@ -2444,7 +2690,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 {
                     DeleteFromGriddedTileAncillary(nTileId);
 
-                    pszSQL = sqlite3_mprintf(
+                    char *pszSQL = sqlite3_mprintf(
                         "INSERT INTO gpkg_2d_gridded_tile_ancillary "
                         "(tpudt_name, tpudt_id, scale, offset, min, max, "
                         "mean, std_dev) VALUES "
@@ -2453,9 +2699,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 #ifdef DEBUG_VERBOSE
                     CPLDebug("GPKG", "%s", pszSQL);
 #endif
-                    hStmt = nullptr;
-                    rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt,
-                                             nullptr);
+                    sqlite3_stmt *hStmt = nullptr;
+                    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt,
+                                                 nullptr);
                     if (rc != SQLITE_OK)
                     {
                         eErr = CE_Failure;
@@ -14,9 +14,13 @@
 #define GPKGMBTILESCOMMON_H_INCLUDED
 
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <deque>
+#include <memory>
+
 typedef struct
 {
     int nRow;
@@ -39,6 +43,8 @@ typedef enum
 GPKGTileFormat GDALGPKGMBTilesGetTileFormat(const char *pszTF);
 const char *GDALMBTilesGetTileFormatName(GPKGTileFormat);
 
+struct GPKGTileEncodeJob;
+
 class GDALGPKGMBTilesLikePseudoDataset
 {
     friend class GDALGPKGMBTilesLikeRasterBand;
@@ -93,11 +99,29 @@ class GDALGPKGMBTilesLikePseudoDataset
 
     int m_nTileInsertionCount = 0;
 
+    // Number of threads used to encode tiles (only on the main dataset)
+    int m_nEncodeThreads = 0;
+
     GDALGPKGMBTilesLikePseudoDataset *m_poParentDS = nullptr;
 
+    void ParseNumThreadsOption(CSLConstList papszOptions);
+
   private:
     bool m_bInWriteTile = false;
+
+    // Tiles being encoded by worker threads, in submission order. Only
+    // used on the main dataset. Must be declared before
+    // m_poEncodeQueue, so that the jobs are destroyed after the queue
+    // has been waited for.
+    std::deque<std::unique_ptr<GPKGTileEncodeJob>> m_apoEncodeJobs{};
+    CPLJobQueuePtr m_poEncodeQueue{};
+
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
+    bool SubmitEncodeJob(int nRow, int nCol, GDALDriver *poDriver,
+                         GDALDataset *poMEMDS, CSLConstList papszOptions);
+    bool HasPendingEncodeJob(int nRow, int nCol);
+    CPLErr InsertTile(int nRow, int nCol, GByte *pabyBlob,
+                      vsi_l_offset nBlobSize);
     GIntBig GetTileId(int nRow, int nCol);
     bool DeleteTile(int nRow, int nCol);
     bool DeleteFromGriddedTileAncillary(GIntBig nTileId);
@@ -122,6 +146,7 @@ class GDALGPKGMBTilesLikePseudoDataset
                     bool *pbIsLossyFormat = nullptr);
 
     CPLErr WriteTile();
+    CPLErr FlushEncodeJobs(size_t nMaxPendingJobs = 0);
 
     CPLErr FlushTiles();
     CPLErr FlushRemainingShiftedTiles(bool bPartialFlush);
@@ -6391,6 +6391,8 @@ void GDALGeoPackageDataset::ParseCompressionOptions(char **papszOptions)
     const char *pszDither = CSLFetchNameValue(papszOptions, "DITHER");
     if (pszDither)
         m_bDither = CPLTestBool(pszDither);
+
+    ParseNumThreadsOption(papszOptions);
 }
 
 /************************************************************************/
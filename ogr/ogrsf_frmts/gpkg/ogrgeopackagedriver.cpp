@@ -456,7 +456,10 @@ class GDALGPKGDriver final : public GDALDriver
     "description='DEFLATE compression level for PNG tiles' default='6'/>"      \
     "  <Option name='DITHER' type='boolean' scope='raster' "                   \
     "description='Whether to apply Floyd-Steinberg dithering (for "            \
-    "TILE_FORMAT=PNG8)' default='NO'/>"
+    "TILE_FORMAT=PNG8)' default='NO'/>"                                        \
+    "  <Option name='NUM_THREADS' type='string' scope='raster' "               \
+    "description='Number of worker threads for tile encoding. Can be set "     \
+    "to ALL_CPUS' default='1'/>"
 
 void GDALGPKGDriver::InitializeCreationOptionList()
 {
@@ -20,8 +20,8 @@
 
 int main(int /* argc */, char * /* argv */[])
 {
-    void *in = calloc(1, 256 * 256 * 16);
-    void *out = malloc(256 * 256 * 16);
+    void *in = calloc(1, 256 * 256 * 32);
+    void *out = malloc(256 * 256 * 32);
 
     int i;
     int intype, outtype;
@@ -97,5 +97,61 @@ int main(int /* argc */, char * /* argv */[])
     }
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 
+    // Conversions that have AVX2 specializations
+    const GDALDataType aeTypes[] = {GDT_Byte,  GDT_UInt16,  GDT_Int16,
+                                    GDT_Int32, GDT_Float32, GDT_Float64};
+    for (int k = 0; k < 2; k++)
+    {
+        if (k == 1)
+        {
+            printf("Disabling AVX2\n");
+            CPLSetConfigOption("GDAL_USE_AVX2", "NO");
+        }
+
+        for (const GDALDataType eInType : aeTypes)
+        {
+            for (const GDALDataType eOutType : aeTypes)
+            {
+                if (eInType == eOutType)
+                    continue;
+                const int nInSize = GDALGetDataTypeSizeBytes(eInType);
+                const int nOutSize = GDALGetDataTypeSizeBytes(eOutType);
+
+                start = clock();
+                for (i = 0; i < 1000; i++)
+                    GDALCopyWords(in, eInType, nInSize, out, eOutType,
+                                  nOutSize, 256 * 256);
+                end = clock();
+                printf("%s -> %s (packed) : %.2f s\n",
+                       GDALGetDataTypeName(eInType),
+                       GDALGetDataTypeName(eOutType),
+                       (end - start) * 1.0 / CLOCKS_PER_SEC);
+
+                // 3-band pixel-interleaved --> packed
+                start = clock();
+                for (i = 0; i < 1000; i++)
+                    GDALCopyWords(in, eInType, 3 * nInSize, out, eOutType,
+                                  nOutSize, 256 * 256);
+                end = clock();
+                printf("%s -> %s (3-word stride -> packed) : %.2f s\n",
+                       GDALGetDataTypeName(eInType),
+                       GDALGetDataTypeName(eOutType),
+                       (end - start) * 1.0 / CLOCKS_PER_SEC);
+
+                // packed --> 4-band pixel-interleaved
+                start = clock();
+                for (i = 0; i < 1000; i++)
+                    GDALCopyWords(in, eInType, nInSize, out, eOutType,
+                                  4 * nOutSize, 256 * 256);
+                end = clock();
+                printf("%s -> %s (packed -> 4-word stride) : %.2f s\n",
+                       GDALGetDataTypeName(eInType),
+                       GDALGetDataTypeName(eOutType),
+                       (end - start) * 1.0 / CLOCKS_PER_SEC);
+            }
+        }
+    }
+    CPLSetConfigOption("GDAL_USE_AVX2", nullptr);
+
     return 0;
 }
@@ -17,6 +17,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <vector>
 
 int main(int /* argc */, char * /* argv */[])
 {
@@ -81,6 +82,57 @@ int main(int /* argc */, char * /* argv */[])
     }
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 
+    // N-components cases, with the same total size of SIZE * SIZE * 4 bytes
+    constexpr int MAX_COMPONENTS = 16;
+    std::vector<std::vector<GByte>> aabyComps(MAX_COMPONENTS);
+    std::vector<void *> apComps;
+    for (auto &abyComp : aabyComps)
+    {
+        abyComp.resize(SIZE * SIZE * 4 / 8);
+        apComps.push_back(abyComp.data());
+    }
+    std::vector<const void *> apConstComps(apComps.begin(), apComps.end());
+
+    for (int k = 0; k < 2; k++)
+    {
+        if (k == 1)
+        {
+            printf("Disabling AVX2\n");
+            CPLSetConfigOption("GDAL_USE_AVX2", "NO");
+        }
+
+        for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+        {
+            for (const int nComponents : {8, 12, 16})
+            {
+                const size_t nIters =
+                    static_cast<size_t>(SIZE) * SIZE * 4 /
+                    (nComponents * GDALGetDataTypeSizeBytes(eDT));
+                {
+                    const auto start = clock();
+                    for (int i = 0; i < 200; ++i)
+                        GDALDeinterleave(src, eDT, nComponents,
+                                         apComps.data(), eDT, nIters);
+                    const auto end = clock();
+                    printf("GDALDeinterleave %s %d : %.2f\n",
+                           GDALGetDataTypeName(eDT), nComponents,
+                           (end - start) * 1.0 / CLOCKS_PER_SEC);
+                }
+                {
+                    const auto start = clock();
+                    for (int i = 0; i < 200; ++i)
+                        GDALInterleave(apConstComps.data(), eDT, nComponents,
+                                       src, eDT, nIters);
+                    const auto end = clock();
+                    printf("GDALInterleave %s %d : %.2f\n",
+                           GDALGetDataTypeName(eDT), nComponents,
+                           (end - start) * 1.0 / CLOCKS_PER_SEC);
+                }
+            }
+        }
+    }
+    CPLSetConfigOption("GDAL_USE_AVX2", nullptr);
+
     VSIFree(src);
     VSIFree(dst0);
     VSIFree(dst1);
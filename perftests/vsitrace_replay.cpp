@@ -0,0 +1,614 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  Summarize and replay traces recorded by /vsitrace/
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Keep in sync with port/cpl_vsil_trace.cpp
+constexpr const char TRACE_SIGNATURE[] = "GDALVTR1";
+constexpr size_t TRACE_SIGNATURE_SIZE = 8;
+
+enum TraceRecordType
+{
+    OPEN = 1,
+    CLOSE = 2,
+    SEEK = 3,
+    READ = 4,
+    READ_MULTI_RANGE = 5,
+    STAT = 6,
+    READDIR = 7,
+};
+
+// Reads or ranges below that size are reported as small
+constexpr uint64_t SMALL_READ_SIZE = 4096;
+
+/************************************************************************/
+/*                              TraceRecord                             */
+/************************************************************************/
+
+struct TraceRecord
+{
+    int nType = 0;
+    uint32_t nThread = 0;
+    uint32_t nHandle = 0;
+    uint64_t nStart = 0;
+    uint64_t nDuration = 0;
+    bool bSuccess = false;
+    int nRet = 0;
+    std::string osFilename{};
+    std::string osAccess{};
+    uint64_t nOffset = 0;
+    uint64_t nRequestedSize = 0;
+    uint64_t nReadSize = 0;
+    std::vector<std::pair<uint64_t, uint64_t>> aoRanges{};
+};
+
+/************************************************************************/
+/*                               FileStats                              */
+/************************************************************************/
+
+struct FileStats
+{
+    int nOpens = 0;
+    int nStats = 0;
+    int nReadDirs = 0;
+    uint64_t nReads = 0;
+    uint64_t nSmallReads = 0;
+    uint64_t nSequentialReads = 0;
+    uint64_t nMultiRangeCalls = 0;
+    uint64_t nRanges = 0;
+    uint64_t nBytesRead = 0;
+    uint64_t nIOTime = 0;
+    std::set<uint32_t> oThreads{};
+    std::vector<std::pair<uint64_t, uint64_t>> aoIntervals{};
+};
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: vsitrace_replay [--replay] [--substitute <old> <new>]*\n");
+    printf("                       <trace_file>\n");
+    printf("\n");
+    printf("Summarize a trace recorded with /vsitrace/ and "
+           "CPL_VSIL_TRACE_FILE.\n");
+    printf("--replay: replay the operations sequentially, and report "
+           "timing and network\n");
+    printf("          statistics.\n");
+    printf("--substitute: replace the <old> prefix of recorded filenames "
+           "with <new> when\n");
+    printf("              replaying, e.g. to replay a local trace against "
+           "/vsis3/.\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                             ParseTrace()                             */
+/************************************************************************/
+
+static bool ParseTrace(const char *pszFilename,
+                       std::vector<TraceRecord> &aoRecords)
+{
+    GByte *pabyData = nullptr;
+    vsi_l_offset nDataSize = 0;
+    if (!VSIIngestFile(nullptr, pszFilename, &pabyData, &nDataSize, -1))
+        return false;
+    const GByte *pabyIter = pabyData;
+    const GByte *const pabyEnd = pabyData + nDataSize;
+
+    if (nDataSize < TRACE_SIGNATURE_SIZE ||
+        memcmp(pabyData, TRACE_SIGNATURE, TRACE_SIGNATURE_SIZE) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s is not a /vsitrace/ file",
+                 pszFilename);
+        VSIFree(pabyData);
+        return false;
+    }
+    pabyIter += TRACE_SIGNATURE_SIZE;
+
+    bool bOK = true;
+    const auto ReadUInt8 = [&pabyIter, pabyEnd, &bOK]() -> int
+    {
+        if (pabyIter + 1 > pabyEnd)
+        {
+            bOK = false;
+            return 0;
+        }
+        return *(pabyIter++);
+    };
+    const auto ReadUInt32 = [&pabyIter, pabyEnd, &bOK]()
+    {
+        uint32_t nVal = 0;
+        if (pabyIter + sizeof(nVal) > pabyEnd)
+        {
+            bOK = false;
+            return nVal;
+        }
+        memcpy(&nVal, pabyIter, sizeof(nVal));
+        CPL_LSBPTR32(&nVal);
+        pabyIter += sizeof(nVal);
+        return nVal;
+    };
+    const auto ReadUInt64 = [&pabyIter, pabyEnd, &bOK]()
+    {
+        uint64_t nVal = 0;
+        if (pabyIter + sizeof(nVal) > pabyEnd)
+        {
+            bOK = false;
+            return nVal;
+        }
+        memcpy(&nVal, pabyIter, sizeof(nVal));
+        CPL_LSBPTR64(&nVal);
+        pabyIter += sizeof(nVal);
+        return nVal;
+    };
+    const auto ReadString = [&pabyIter, pabyEnd, &bOK, &ReadUInt32]()
+    {
+        const uint32_t nSize = ReadUInt32();
+        if (!bOK || nSize > static_cast<size_t>(pabyEnd - pabyIter))
+        {
+            bOK = false;
+            return std::string();
+        }
+        std::string osRet(reinterpret_cast<const char *>(pabyIter), nSize);
+        pabyIter += nSize;
+        return osRet;
+    };
+
+    while (bOK && pabyIter < pabyEnd)
+    {
+        TraceRecord oRecord;
+        oRecord.nType = ReadUInt8();
+        oRecord.nThread = ReadUInt32();
+        oRecord.nHandle = ReadUInt32();
+        oRecord.nStart = ReadUInt64();
+        oRecord.nDuration = ReadUInt64();
+        switch (oRecord.nType)
+        {
+            case OPEN:
+                oRecord.bSuccess = ReadUInt8() != 0;
+                oRecord.osFilename = ReadString();
+                oRecord.osAccess = ReadString();
+                break;
+            case CLOSE:
+                break;
+            case SEEK:
+                oRecord.nOffset = ReadUInt64();
+                break;
+            case READ:
+                oRecord.nOffset = ReadUInt64();
+                oRecord.nRequestedSize = ReadUInt64();
+                oRecord.nReadSize = ReadUInt64();
+                break;
+            case READ_MULTI_RANGE:
+            {
+                oRecord.nRet = static_cast<int>(ReadUInt32());
+                const uint32_t nRanges = ReadUInt32();
+                for (uint32_t i = 0; bOK && i < nRanges; ++i)
+                {
+                    const uint64_t nOffset = ReadUInt64();
+                    const uint64_t nSize = ReadUInt64();
+                    oRecord.aoRanges.emplace_back(nOffset, nSize);
+                    oRecord.nRequestedSize += nSize;
+                }
+                break;
+            }
+            case STAT:
+            case READDIR:
+                oRecord.nRet = static_cast<int>(ReadUInt32());
+                oRecord.osFilename = ReadString();
+                break;
+            default:
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Unknown record type %d at offset %" PRIu64,
+                         oRecord.nType,
+                         static_cast<uint64_t>(pabyIter - pabyData));
+                bOK = false;
+                break;
+        }
+        if (bOK)
+            aoRecords.emplace_back(std::move(oRecord));
+    }
+    if (!bOK)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Truncated or corrupted trace. Only %d records used",
+                 static_cast<int>(aoRecords.size()));
+    }
+    VSIFree(pabyData);
+    return true;
+}
+
+/************************************************************************/
+/*                         GetUniqueByteCount()                         */
+/************************************************************************/
+
+static uint64_t
+GetUniqueByteCount(std::vector<std::pair<uint64_t, uint64_t>> &aoIntervals)
+{
+    std::sort(aoIntervals.begin(), aoIntervals.end());
+    uint64_t nUnique = 0;
+    uint64_t nCurStart = 0;
+    uint64_t nCurEnd = 0;
+    for (const auto &[nStart, nEnd] : aoIntervals)
+    {
+        if (nStart > nCurEnd)
+        {
+            nUnique += nCurEnd - nCurStart;
+            nCurStart = nStart;
+            nCurEnd = nEnd;
+        }
+        else
+        {
+            nCurEnd = std::max(nCurEnd, nEnd);
+        }
+    }
+    nUnique += nCurEnd - nCurStart;
+    return nUnique;
+}
+
+/************************************************************************/
+/*                            Summarize()                               */
+/************************************************************************/
+
+static void Summarize(const std::vector<TraceRecord> &aoRecords)
+{
+    std::map<std::string, FileStats> oMapStats;
+    std::map<uint32_t, std::string> oMapHandleToFilename;
+    std::map<uint32_t, uint64_t> oMapHandleToPos;
+    uint64_t nLastTime = 0;
+
+    for (const auto &oRecord : aoRecords)
+    {
+        nLastTime = std::max(nLastTime, oRecord.nStart + oRecord.nDuration);
+        FileStats *poStats = nullptr;
+        if (oRecord.nType == OPEN || oRecord.nType == STAT ||
+            oRecord.nType == READDIR)
+        {
+            poStats = &oMapStats[oRecord.osFilename];
+        }
+        else
+        {
+            const auto oIter = oMapHandleToFilename.find(oRecord.nHandle);
+            if (oIter == oMapHandleToFilename.end())
+                continue;
+            poStats = &oMapStats[oIter->second];
+        }
+        poStats->nIOTime += oRecord.nDuration;
+        poStats->oThreads.insert(oRecord.nThread);
+
+        switch (oRecord.nType)
+        {
+            case OPEN:
+                ++poStats->nOpens;
+                if (oRecord.bSuccess)
+                    oMapHandleToFilename[oRecord.nHandle] = oRecord.osFilename;
+                break;
+            case STAT:
+                ++poStats->nStats;
+                break;
+            case READDIR:
+                ++poStats->nReadDirs;
+                break;
+            case CLOSE:
+                oMapHandleToFilename.erase(oRecord.nHandle);
+                oMapHandleToPos.erase(oRecord.nHandle);
+                break;
+            case SEEK:
+                break;
+            case READ:
+            {
+                ++poStats->nReads;
+                if (oRecord.nRequestedSize < SMALL_READ_SIZE)
+                    ++poStats->nSmallReads;
+                const auto oIter = oMapHandleToPos.find(oRecord.nHandle);
+                if (oIter != oMapHandleToPos.end() &&
+                    oIter->second == oRecord.nOffset)
+                {
+                    ++poStats->nSequentialReads;
+                }
+                oMapHandleToPos[oRecord.nHandle] =
+                    oRecord.nOffset + oRecord.nReadSize;
+                poStats->nBytesRead += oRecord.nReadSize;
+                if (oRecord.nReadSize)
+                {
+                    poStats->aoIntervals.emplace_back(
+                        oRecord.nOffset, oRecord.nOffset + oRecord.nReadSize);
+                }
+                break;
+            }
+            case READ_MULTI_RANGE:
+            {
+                ++poStats->nMultiRangeCalls;
+                poStats->nRanges += oRecord.aoRanges.size();
+                if (oRecord.nRet != 0)
+                    break;
+                poStats->nBytesRead += oRecord.nRequestedSize;
+                for (const auto &[nOffset, nSize] : oRecord.aoRanges)
+                {
+                    if (nSize < SMALL_READ_SIZE)
+                        ++poStats->nSmallReads;
+                    if (nSize)
+                        poStats->aoIntervals.emplace_back(nOffset,
+                                                          nOffset + nSize);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    printf("%d records, spanning %.3f s\n", static_cast<int>(aoRecords.size()),
+           static_cast<double>(nLastTime) * 1e-9);
+    for (auto &[osFilename, oStats] : oMapStats)
+    {
+        printf("\n%s:\n", osFilename.c_str());
+        printf("  Opens: %d, stats: %d, readdirs: %d, threads: %d\n",
+               oStats.nOpens, oStats.nStats, oStats.nReadDirs,
+               static_cast<int>(oStats.oThreads.size()));
+        if (oStats.nReads || oStats.nMultiRangeCalls)
+        {
+            const uint64_t nUnique = GetUniqueByteCount(oStats.aoIntervals);
+            printf("  Reads: %" PRIu64 " (%.1f %% sequential), "
+                   "multi-range reads: %" PRIu64 " (%" PRIu64 " ranges)\n",
+                   oStats.nReads,
+                   oStats.nReads ? 100.0 *
+                                       static_cast<double>(
+                                           oStats.nSequentialReads) /
+                                       static_cast<double>(oStats.nReads)
+                                 : 0.0,
+                   oStats.nMultiRangeCalls, oStats.nRanges);
+            printf("  Requests smaller than %d bytes: %" PRIu64 "\n",
+                   static_cast<int>(SMALL_READ_SIZE), oStats.nSmallReads);
+            printf("  Bytes read: %" PRIu64 ", unique bytes: %" PRIu64
+                   ", re-read ratio: %.3f\n",
+                   oStats.nBytesRead, nUnique,
+                   oStats.nBytesRead
+                       ? static_cast<double>(oStats.nBytesRead - nUnique) /
+                             static_cast<double>(oStats.nBytesRead)
+                       : 0.0);
+        }
+        printf("  Time spent in I/O: %.3f s\n",
+               static_cast<double>(oStats.nIOTime) * 1e-9);
+    }
+}
+
+/************************************************************************/
+/*                               Replay()                               */
+/************************************************************************/
+
+static void
+Replay(const std::vector<TraceRecord> &aoRecords,
+       const std::vector<std::pair<std::string, std::string>> &aoSubstitutions)
+{
+    const auto Substitute = [&aoSubstitutions](const std::string &osFilename)
+    {
+        for (const auto &[osOld, osNew] : aoSubstitutions)
+        {
+            if (STARTS_WITH(osFilename.c_str(), osOld.c_str()))
+                return osNew + osFilename.substr(osOld.size());
+        }
+        return osFilename;
+    };
+
+    CPLSetConfigOption("CPL_VSIL_NETWORK_STATS_ENABLED", "YES");
+    VSINetworkStatsReset();
+
+    std::map<uint32_t, VSILFILE *> oMapHandles;
+    std::vector<GByte> abyBuffer;
+    uint64_t nBytesRead = 0;
+    std::vector<std::pair<uint64_t, uint64_t>> aoIntervals;
+    int nSkippedOpens = 0;
+    int nFailures = 0;
+
+    const auto oStart = std::chrono::steady_clock::now();
+    for (const auto &oRecord : aoRecords)
+    {
+        if (oRecord.nType == OPEN)
+        {
+            if (!oRecord.bSuccess)
+                continue;
+            // Do not risk modifying or truncating files when replaying
+            if (oRecord.osAccess.find_first_of("wa+") != std::string::npos)
+            {
+                ++nSkippedOpens;
+                continue;
+            }
+            VSILFILE *fp =
+                VSIFOpenL(Substitute(oRecord.osFilename).c_str(), "rb");
+            if (fp)
+                oMapHandles[oRecord.nHandle] = fp;
+            else
+                ++nFailures;
+            continue;
+        }
+        if (oRecord.nType == STAT)
+        {
+            VSIStatBufL sStat;
+            CPL_IGNORE_RET_VAL(
+                VSIStatL(Substitute(oRecord.osFilename).c_str(), &sStat));
+            continue;
+        }
+        if (oRecord.nType == READDIR)
+        {
+            CSLDestroy(VSIReadDir(Substitute(oRecord.osFilename).c_str()));
+            continue;
+        }
+
+        const auto oIter = oMapHandles.find(oRecord.nHandle);
+        if (oIter == oMapHandles.end())
+            continue;
+        VSILFILE *fp = oIter->second;
+        switch (oRecord.nType)
+        {
+            case CLOSE:
+                VSIFCloseL(fp);
+                oMapHandles.erase(oIter);
+                break;
+            case SEEK:
+                VSIFSeekL(fp, oRecord.nOffset, SEEK_SET);
+                break;
+            case READ:
+            {
+                if (oRecord.nRequestedSize == 0)
+                    break;
+                abyBuffer.resize(static_cast<size_t>(oRecord.nRequestedSize));
+                if (VSIFTellL(fp) != oRecord.nOffset)
+                    VSIFSeekL(fp, oRecord.nOffset, SEEK_SET);
+                const size_t nRead =
+                    VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), fp);
+                nBytesRead += nRead;
+                if (nRead)
+                    aoIntervals.emplace_back(oRecord.nOffset,
+                                             oRecord.nOffset + nRead);
+                break;
+            }
+            case READ_MULTI_RANGE:
+            {
+                const int nRanges = static_cast<int>(oRecord.aoRanges.size());
+                if (nRanges == 0)
+                    break;
+                abyBuffer.resize(static_cast<size_t>(oRecord.nRequestedSize));
+                std::vector<void *> apData;
+                std::vector<vsi_l_offset> anOffsets;
+                std::vector<size_t> anSizes;
+                size_t nBufferOffset = 0;
+                for (const auto &[nOffset, nSize] : oRecord.aoRanges)
+                {
+                    apData.push_back(abyBuffer.data() + nBufferOffset);
+                    anOffsets.push_back(nOffset);
+                    anSizes.push_back(static_cast<size_t>(nSize));
+                    nBufferOffset += static_cast<size_t>(nSize);
+                    if (nSize)
+                        aoIntervals.emplace_back(nOffset, nOffset + nSize);
+                }
+                if (VSIFReadMultiRangeL(nRanges, apData.data(),
+                                        anOffsets.data(), anSizes.data(),
+                                        fp) == 0)
+                {
+                    nBytesRead += oRecord.nRequestedSize;
+                }
+                else
+                {
+                    ++nFailures;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    for (auto &[nHandle, fp] : oMapHandles)
+        VSIFCloseL(fp);
+    const double dfElapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      oStart)
+            .count();
+
+    const uint64_t nUnique = GetUniqueByteCount(aoIntervals);
+    printf("\nReplay:\n");
+    printf("  Elapsed time: %.3f s\n", dfElapsed);
+    printf("  Bytes read: %" PRIu64 ", unique bytes: %" PRIu64 "\n",
+           nBytesRead, nUnique);
+    if (nSkippedOpens)
+        printf("  Skipped opens in update mode: %d\n", nSkippedOpens);
+    if (nFailures)
+        printf("  Failed operations: %d\n", nFailures);
+
+    char *pszStats = VSINetworkStatsGetAsSerializedJSON(nullptr);
+    CPLJSONDocument oDoc;
+    if (pszStats && oDoc.LoadMemory(pszStats))
+    {
+        const auto oGet = oDoc.GetRoot().GetObj("methods/GET");
+        if (oGet.IsValid())
+        {
+            const GIntBig nDownloaded = oGet.GetLong("downloaded_bytes");
+            printf("  GET requests: %d, downloaded bytes: " CPL_FRMT_GIB
+                   ", amplification: %.3f\n",
+                   oGet.GetInteger("count"), nDownloaded,
+                   nUnique ? static_cast<double>(nDownloaded) /
+                                 static_cast<double>(nUnique)
+                           : 0.0);
+        }
+    }
+    CPLFree(pszStats);
+}
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    const char *pszTraceFile = nullptr;
+    bool bReplay = false;
+    std::vector<std::pair<std::string, std::string>> aoSubstitutions;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (strcmp(argv[iArg], "--replay") == 0)
+        {
+            bReplay = true;
+        }
+        else if (iArg + 2 < argc && strcmp(argv[iArg], "--substitute") == 0)
+        {
+            aoSubstitutions.emplace_back(argv[iArg + 1], argv[iArg + 2]);
+            iArg += 2;
+        }
+        else if (argv[iArg][0] == '-')
+        {
+            Usage();
+        }
+        else if (pszTraceFile == nullptr)
+        {
+            pszTraceFile = argv[iArg];
+        }
+        else
+        {
+            Usage();
+        }
+    }
+    if (pszTraceFile == nullptr)
+        Usage();
+
+    std::vector<TraceRecord> aoRecords;
+    if (!ParseTrace(pszTraceFile, aoRecords))
+    {
+        CSLDestroy(argv);
+        exit(1);
+    }
+
+    Summarize(aoRecords);
+    if (bReplay)
+        Replay(aoRecords, aoSubstitutions);
+
+    CSLDestroy(argv);
+    VSICleanupFileManager();
+    return 0;
+}
@@ -82,6 +82,32 @@ bool CPLHaveRuntimeAVX();
 #endif
 #endif
 
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+#if __AVX2__
+#define HAVE_INLINE_AVX2
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+#ifdef DEBUG
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX2", "YES")))
+        return false;
+#endif
+    return true;
+}
+#else
+#if defined(__GNUC__) && !defined(DEBUG)
+extern bool bCPLHasAVX2;
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+    return bCPLHasAVX2;
+}
+#else
+bool CPLHaveRuntimeAVX2();
+#endif
+#endif
+#endif
+
 //! @endcond
 
 #endif  // CPL_CPU_FEATURES_H
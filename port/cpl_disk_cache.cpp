@@ -0,0 +1,313 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Directory based persistent cache, with LRU eviction
+ *
+ **********************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_disk_cache.h"
+
+#include "cpl_conv.h"
+#include "cpl_md5.h"
+#include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <utility>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+// Access times are refreshed at most every TOUCH_INTERVAL_IN_SEC, to save I/O.
+constexpr int TOUCH_INTERVAL_IN_SEC = 600;
+// Temporary files older than that are leftovers of a process that died.
+constexpr int STALLED_TMP_FILE_DELAY_IN_SEC = 3600;
+
+/************************************************************************/
+/*                            CPLDiskCache()                            */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param pszSignature Signature of SIGNATURE_SIZE characters at the start of
+ *                     cached files.
+ * @param pszExtension Extension of cached files.
+ * @param pszDebugKey Key used for CPLDebug() messages.
+ * @param pfnGetFileSize Function returning the space taken by a cached file,
+ *                       or nullptr to use its size as returned by VSIStatL().
+ */
+CPLDiskCache::CPLDiskCache(const char *pszSignature, const char *pszExtension,
+                           const char *pszDebugKey,
+                           GetFileSizeFunc pfnGetFileSize)
+    : m_osSignature(pszSignature), m_osExtension(pszExtension),
+      m_osDebugKey(pszDebugKey), m_pfnGetFileSize(std::move(pfnGetFileSize))
+{
+    CPLAssert(m_osSignature.size() == SIGNATURE_SIZE);
+}
+
+/************************************************************************/
+/*                            ParseMaxSize()                            */
+/************************************************************************/
+
+/** Parse the value of the configuration option pszOptionName, giving the
+ * maximum size of the cache, defaulting to 1 GB if it is invalid. */
+GIntBig CPLDiskCache::ParseMaxSize(const char *pszMaxSize,
+                                   const char *pszOptionName)
+{
+    GIntBig nMaxSize = 0;
+    if (CPLParseMemorySize(pszMaxSize, &nMaxSize, nullptr) != CE_None ||
+        nMaxSize <= 0)
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for %s: %s. Using 1GB instead", pszOptionName,
+                 pszMaxSize);
+        nMaxSize = static_cast<GIntBig>(1024) * 1024 * 1024;
+    }
+    return nMaxSize;
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+/** Return the name of the file caching the entry of key osKey, and
+ * optionally the name of the subdirectory it belongs to. */
+std::string CPLDiskCache::GetFilename(const std::string &osCacheDir,
+                                      const std::string &osKey,
+                                      std::string *posSubDir) const
+{
+    const std::string osMD5(CPLMD5String(osKey.c_str()));
+    std::string osSubDir = CPLFormFilenameSafe(
+        osCacheDir.c_str(), osMD5.substr(0, 2).c_str(), nullptr);
+    std::string osFilename = CPLFormFilenameSafe(
+        osSubDir.c_str(), osMD5.c_str(), m_osExtension.c_str());
+    if (posSubDir)
+        *posSubDir = std::move(osSubDir);
+    return osFilename;
+}
+
+/************************************************************************/
+/*                            CreateSubDir()                            */
+/************************************************************************/
+
+/** Create the cache directory and the subdirectory osSubDir, if needed. */
+void CPLDiskCache::CreateSubDir(const std::string &osCacheDir,
+                                const std::string &osSubDir)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0)
+    {
+        VSIMkdir(osCacheDir.c_str(), 0755);
+        VSIMkdir(osSubDir.c_str(), 0755);
+    }
+}
+
+/************************************************************************/
+/*                           GetTmpFilename()                           */
+/************************************************************************/
+
+/** Return a name of temporary file, unique among processes and threads, to
+ * create osFilename. */
+std::string CPLDiskCache::GetTmpFilename(const std::string &osFilename)
+{
+    return osFilename + CPLSPrintf(".%d.%u.tmp",
+                                   static_cast<int>(CPLGetPID()),
+                                   m_nTmpCounter++);
+}
+
+/************************************************************************/
+/*                           InstallTmpFile()                           */
+/************************************************************************/
+
+/** Rename a completely written temporary file as osFilename.
+ *
+ * If bOverwrite is false, an existing osFilename, created in the meantime by
+ * another process, is kept. The temporary file is removed in all cases.
+ *
+ * @return true if osFilename exists on return.
+ */
+bool CPLDiskCache::InstallTmpFile(const std::string &osTmpFilename,
+                                  const std::string &osFilename,
+                                  bool bOverwrite)
+{
+    VSIStatBufL sStat;
+    if (bOverwrite || VSIStatL(osFilename.c_str(), &sStat) != 0)
+    {
+        if (VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0)
+            return true;
+    }
+    VSIUnlink(osTmpFilename.c_str());
+    return !bOverwrite && VSIStatL(osFilename.c_str(), &sStat) == 0;
+}
+
+/************************************************************************/
+/*                           CheckSignature()                           */
+/************************************************************************/
+
+/** Read the signature at the current position of fp, and check it. */
+bool CPLDiskCache::CheckSignature(VSIVirtualHandle *fp) const
+{
+    char achSignature[SIGNATURE_SIZE];
+    return fp->Read(achSignature, 1, SIGNATURE_SIZE) == SIGNATURE_SIZE &&
+           memcmp(achSignature, m_osSignature.data(), SIGNATURE_SIZE) == 0;
+}
+
+/************************************************************************/
+/*                           WriteSignature()                           */
+/************************************************************************/
+
+/** Write the signature at the current position of fp. */
+bool CPLDiskCache::WriteSignature(VSIVirtualHandle *fp) const
+{
+    return fp->Write(m_osSignature.data(), 1, SIGNATURE_SIZE) ==
+           SIGNATURE_SIZE;
+}
+
+/************************************************************************/
+/*                               Touch()                                */
+/************************************************************************/
+
+/** Refresh the modification time of a cached file that has just been read,
+ * which serves as its access time for the LRU eviction. Done only from time
+ * to time to save I/O.
+ */
+void CPLDiskCache::Touch(const std::string &osFilename,
+                         const VSIStatBufL &sStat) const
+{
+    if (sStat.st_mtime + TOUCH_INTERVAL_IN_SEC < time(nullptr))
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "r+b"));
+        if (fp)
+            CPL_IGNORE_RET_VAL(WriteSignature(fp.get()));
+    }
+}
+
+/************************************************************************/
+/*                         NotifyBytesWritten()                         */
+/************************************************************************/
+
+/** Account for nSize bytes written to the cache by this process, and evict
+ * least recently used files if the cache exceeds nMaxSize.
+ *
+ * The size of the cache is checked at the first write, and then each time
+ * that 1/10th of its maximum size has been written by this process.
+ */
+void CPLDiskCache::NotifyBytesWritten(const std::string &osCacheDir,
+                                      size_t nSize, GIntBig nMaxSize)
+{
+    bool bEvict = false;
+    {
+        std::lock_guard oLock(m_oMutex);
+        if (m_nBytesWrittenSinceLastCheck < 0 ||
+            m_nBytesWrittenSinceLastCheck + static_cast<GIntBig>(nSize) >
+                nMaxSize / 10)
+        {
+            m_nBytesWrittenSinceLastCheck = 0;
+            bEvict = true;
+        }
+        else
+        {
+            m_nBytesWrittenSinceLastCheck += static_cast<GIntBig>(nSize);
+        }
+    }
+    if (bEvict)
+        Evict(osCacheDir, nMaxSize);
+}
+
+/************************************************************************/
+/*                               Evict()                                */
+/************************************************************************/
+
+void CPLDiskCache::Evict(const std::string &osCacheDir, GIntBig nMaxSize) const
+{
+    const std::string osLockFilename =
+        CPLFormFilenameSafe(osCacheDir.c_str(), ".lock", nullptr);
+    CPLLockFileHandle hLockFileHandle = nullptr;
+    CPLStringList aosLockOptions;
+    aosLockOptions.SetNameValue("WAIT_TIME", "0");
+    if (CPLLockFileEx(osLockFilename.c_str(), &hLockFileHandle,
+                      aosLockOptions.List()) != CLFS_OK)
+    {
+        // Another process is already evicting
+        return;
+    }
+
+    struct CachedFile
+    {
+        GIntBig nMTime;
+        GIntBig nSize;
+        std::string osFilename;
+    };
+
+    const std::string osSuffix = "." + m_osExtension;
+    std::vector<CachedFile> aoFiles;
+    GIntBig nTotalSize = 0;
+    const GIntBig nNow = static_cast<GIntBig>(time(nullptr));
+    const CPLStringList aosSubDirs(VSIReadDir(osCacheDir.c_str()));
+    for (const char *pszSubDir : aosSubDirs)
+    {
+        if (strlen(pszSubDir) != 2)
+            continue;
+        const std::string osSubDir =
+            CPLFormFilenameSafe(osCacheDir.c_str(), pszSubDir, nullptr);
+        const CPLStringList aosFiles(VSIReadDir(osSubDir.c_str()));
+        for (const char *pszFile : aosFiles)
+        {
+            const bool bIsCached = cpl::ends_with(std::string(pszFile),
+                                                  osSuffix);
+            const bool bIsTmp = cpl::ends_with(std::string(pszFile), ".tmp");
+            if (!bIsCached && !bIsTmp)
+                continue;
+            std::string osFilename =
+                CPLFormFilenameSafe(osSubDir.c_str(), pszFile, nullptr);
+            VSIStatBufL sStat;
+            if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+                continue;
+            if (bIsTmp)
+            {
+                if (static_cast<GIntBig>(sStat.st_mtime) +
+                        STALLED_TMP_FILE_DELAY_IN_SEC <
+                    nNow)
+                {
+                    VSIUnlink(osFilename.c_str());
+                }
+                continue;
+            }
+            const GIntBig nSize = m_pfnGetFileSize
+                                      ? m_pfnGetFileSize(osFilename, sStat)
+                                      : static_cast<GIntBig>(sStat.st_size);
+            nTotalSize += nSize;
+            aoFiles.push_back({static_cast<GIntBig>(sStat.st_mtime), nSize,
+                               std::move(osFilename)});
+        }
+    }
+
+    if (nTotalSize > nMaxSize)
+    {
+        std::sort(aoFiles.begin(), aoFiles.end(),
+                  [](const CachedFile &a, const CachedFile &b)
+                  { return a.nMTime < b.nMTime; });
+        // Evict a bit more than needed, so as not to trigger eviction
+        // again at the next write
+        const GIntBig nTargetSize = nMaxSize / 10 * 9;
+        for (const auto &oFile : aoFiles)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            if (VSIUnlink(oFile.osFilename.c_str()) == 0)
+                nTotalSize -= oFile.nSize;
+        }
+        CPLDebug(m_osDebugKey.c_str(), "Disk cache %s: size after eviction: %s",
+                 osCacheDir.c_str(), CPLSPrintf(CPL_FRMT_GIB, nTotalSize));
+    }
+
+    CPLUnlockFileEx(hLockFileHandle);
+}
+
+//! @endcond
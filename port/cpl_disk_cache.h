@@ -0,0 +1,93 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Directory based persistent cache, with LRU eviction
+ *
+ **********************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_DISK_CACHE_H_INCLUDED
+#define CPL_DISK_CACHE_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+
+//! @cond Doxygen_Suppress
+
+/** Directory based persistent cache, shared by several processes.
+ *
+ * Entries are stored in files named from the MD5 of their key, in
+ * <cache_dir>/<2 first hex digits of MD5>/<MD5>.<extension>, and start with
+ * a signature of SIGNATURE_SIZE bytes. The layout of the rest of the files
+ * is defined by users of this class.
+ *
+ * Files are created as temporary files that are renamed on completion, so
+ * that readers from other processes never see partially written files.
+ * The modification time of files is used as the access time of a least
+ * recently used eviction, which is serialized between processes through a
+ * lock file at the root of the cache directory.
+ */
+class CPL_DLL CPLDiskCache
+{
+  public:
+    static constexpr int SIGNATURE_SIZE = 8;
+
+    /** Returns the space taken by a cached file, given its name and
+     * VSIStatL() result. */
+    using GetFileSizeFunc =
+        std::function<GIntBig(const std::string &, const VSIStatBufL &)>;
+
+    CPLDiskCache(const char *pszSignature, const char *pszExtension,
+                 const char *pszDebugKey,
+                 GetFileSizeFunc pfnGetFileSize = nullptr);
+
+    static GIntBig ParseMaxSize(const char *pszMaxSize,
+                                const char *pszOptionName);
+
+    std::string GetFilename(const std::string &osCacheDir,
+                            const std::string &osKey,
+                            std::string *posSubDir = nullptr) const;
+    static void CreateSubDir(const std::string &osCacheDir,
+                             const std::string &osSubDir);
+    std::string GetTmpFilename(const std::string &osFilename);
+    static bool InstallTmpFile(const std::string &osTmpFilename,
+                               const std::string &osFilename,
+                               bool bOverwrite);
+
+    bool CheckSignature(VSIVirtualHandle *fp) const;
+    bool WriteSignature(VSIVirtualHandle *fp) const;
+    void Touch(const std::string &osFilename, const VSIStatBufL &sStat) const;
+
+    void NotifyBytesWritten(const std::string &osCacheDir, size_t nSize,
+                            GIntBig nMaxSize);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(CPLDiskCache)
+
+    const std::string m_osSignature;
+    const std::string m_osExtension;
+    const std::string m_osDebugKey;
+    const GetFileSizeFunc m_pfnGetFileSize;
+
+    std::atomic<unsigned> m_nTmpCounter{0};
+    std::mutex m_oMutex{};
+    GIntBig m_nBytesWrittenSinceLastCheck = -1;
+
+    void Evict(const std::string &osCacheDir, GIntBig nMaxSize) const;
+};
+
+//! @endcond
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif /* CPL_DISK_CACHE_H_INCLUDED */
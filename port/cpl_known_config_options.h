@@ -74,9 +74,10 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CHECK_WITH_INVERT_PROJ", // from gdaltransformer.cpp, gdalwarp_lib.cpp, gdalwarpoperation.cpp, ogrct.cpp
    "COG_DELETE_TEMP_FILES", // from cogdriver.cpp
    "COG_TMP_COMPRESSION", // from cogdriver.cpp
+   "COG_TMP_IN_MEMORY_MAX_SIZE", // from cogdriver.cpp
    "COMPRESS_GEOM", // from ogrsqlitelayer.cpp
    "COMPRESS_OVERVIEW", // from gt_overview.cpp
-   "CONVERT_YCBCR_TO_RGB", // from ecwdataset.cpp, geotiff.cpp, gtiffdataset.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp, gtiffrasterband.cpp
+   "CONVERT_YCBCR_TO_RGB", // from ecwdataset.cpp, geotiff.cpp, gtiffdataset.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp, gtiffrasterband.cpp, gtiffrasterband_read.cpp
    "CPL_ACCUM_ERROR_MSG", // from cpl_error.cpp
    "CPL_ALLOW_VSISTDIN", // from cpl_vsil_stdin.cpp, gdalsrsinfo.cpp
    "CPL_AWS_AUTODETECT_EC2", // from cpl_aws.cpp
@@ -124,26 +125,40 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSI_MEM_MTIME", // from cpl_vsi_mem.cpp
    "CPL_VSIAZ_UNLINK_BATCH_SIZE", // from cpl_vsil_az.cpp
    "CPL_VSIGS_UNLINK_BATCH_SIZE", // from cpl_vsil_gs.cpp
+   "CPL_VSIL_ARCHIVE_INDEX", // from cpl_vsil_abstract_archive.cpp
+   "CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR", // from cpl_vsil_abstract_archive.cpp
+   "CPL_VSIL_ARCHIVE_INDEX_CACHE_MAX_SIZE", // from cpl_vsil_abstract_archive.cpp
    "CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_FILENAME", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_AUTHORIZATION_HEADER_ALLOWED_IF_REDIRECT", // from cpl_http.cpp, cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_DIR", // from cpl_vsil_curl_disk_cache.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_MAX_SIZE", // from cpl_vsil_curl_disk_cache.cpp
    "CPL_VSIL_CURL_HONOR_CACHE_CONTROL", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD_STREAMS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
+   "CPL_VSIL_CURL_UPLOAD_MAX_MEMORY", // from cpl_vsil_s3.cpp
+   "CPL_VSIL_CURL_UPLOAD_NUM_THREADS", // from cpl_vsil_s3.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_USE_S3_REDIRECT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_DEFLATE_CHUNK_SIZE", // from cpl_minizip_zip.cpp, cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX_SPAN", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_SAVE_INFO", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_WRITE_PROPERTIES", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_NETWORK_STATS_ENABLED", // from cpl_vsil_curl.cpp
    "CPL_VSIL_SHOW_NETWORK_STATS", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_TRACE_FILE", // from cpl_vsil_trace.cpp
+   "CPL_VSIL_UNIX_MULTI_RANGE_READ", // from cpl_vsil_unix_stdio_64.cpp
+   "CPL_VSIL_UNIX_MULTI_RANGE_READ_QUEUE_DEPTH", // from cpl_vsil_unix_stdio_64.cpp
    "CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE", // from cpl_vsil_s3.cpp, ogrgeopackagedatasource.cpp, ogrlibkmldatasource.cpp, ogrsqlitedatasource.cpp
    "CPL_VSIL_ZIP_ALLOWED_EXTENSIONS", // from cpl_vsil_gzip.cpp
    "CPL_VSIS3_CREATE_DIR_OBJECT", // from cpl_vsil_s3.cpp
@@ -226,6 +241,8 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_CACHE_DIRECTORY", // from gdal_misc.cpp
    "GDAL_CACHEMAX", // from gdalrasterblock.cpp, nearblack_bin.cpp
    "GDAL_CONFIG_FILE", // from cpl_conv.cpp
+   "GDAL_COPY_WHOLE_RASTER_ASYNC_READ", // from rasterio.cpp
+   "GDAL_COPY_WHOLE_RASTER_ASYNC_READ_AHEAD", // from rasterio.cpp
    "GDAL_CURL_CA_BUNDLE", // from cpl_http.cpp
    "GDAL_DAAS_ACCESS_TOKEN", // from daasdataset.cpp
    "GDAL_DAAS_API_KEY", // from daasdataset.cpp
@@ -325,7 +342,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_MAX_CONNECTIONS", // from gdalogcapidataset.cpp, gdalwmsdataset.cpp
    "GDAL_MAX_DATASET_POOL_RAM_USAGE", // from gdalproxypool.cpp
    "GDAL_MAX_DATASET_POOL_SIZE", // from gdal_translate_bin.cpp, gdalproxypool.cpp, gdalwarp_bin.cpp
-   "GDAL_MAX_RAW_BLOCK_CACHE_SIZE", // from gtiffdataset_read.cpp
+   "GDAL_MAX_RAW_BLOCK_CACHE_SIZE", // from gtiffdataset_read.cpp, libertiffdataset.cpp
    "GDAL_MEM_ENABLE_OPEN", // from memdataset.cpp
    "GDAL_NETCDF_ASSUME_LONGLAT", // from netcdfdataset.cpp
    "GDAL_NETCDF_BOTTOMUP", // from netcdfdataset.cpp
@@ -335,7 +352,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_NETCDF_REPORT_EXTRA_DIM_VALUES", // from netcdfdataset.cpp
    "GDAL_NETCDF_VERIFY_DIMS", // from netcdfdataset.cpp
    "GDAL_NO_COSTLY_OVERVIEW", // from rasterio.cpp
-   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
+   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_crypt.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdalgeopackagerasterband.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
    "GDAL_OGCAPI_TILEMATRIXSET_LIMITS", // from gdalogcapidataset.cpp
    "GDAL_ONE_BIG_READ", // from jp2kakdataset.cpp, jpipkakdataset.cpp, mrsiddataset.cpp, rawdataset.cpp, wcsdataset.cpp
    "GDAL_OPEN_AFTER_COPY", // from jpgdataset.cpp, pngdataset.cpp
@@ -365,6 +382,9 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_PDF_USE_SPAWN", // from pdfdataset.cpp
    "GDAL_PDF_WRITE_ESRI_CODE_AS_EPSG", // from pdfcreatecopy.cpp
    "GDAL_PDF_WRITE_GEOREF_ON_IMAGE", // from pdfcreatecopy.cpp
+   "GDAL_PERSISTENT_BLOCK_CACHE_DIR", // from gdal_persistent_block_cache.cpp
+   "GDAL_PERSISTENT_BLOCK_CACHE_MAX_SIZE", // from gdal_persistent_block_cache.cpp
+   "GDAL_PERSISTENT_BLOCK_CACHE_REMOTE_ONLY", // from gdal_persistent_block_cache.cpp
    "GDAL_PNG_SINGLE_BLOCK", // from pngdataset.cpp
    "GDAL_PNG_WHOLE_IMAGE_OPTIM", // from pngdataset.cpp
    "GDAL_PROXY_AUTH", // from cpl_http.cpp
@@ -396,6 +416,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_TIFF_OVR_BLOCKSIZE", // from geotiff.cpp
    "GDAL_TRY_PDS3_WITH_VICAR", // from pdsdrivercore.cpp
    "GDAL_USE_AVX", // from gdalgrid.cpp
+   "GDAL_USE_AVX2", // from cpl_cpu_features.cpp
    "GDAL_USE_GEOJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_GMLJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_SSE", // from gdalgrid.cpp
@@ -497,6 +518,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GTI_NUM_THREADS", // from gdaltileindexdataset.cpp
    "GTIFF_ALLOW_PREAD", // from gtiffdataset_read.cpp
    "GTIFF_ALPHA", // from gtiffdataset_write.cpp, gtiffrasterband_write.cpp
+   "GTIFF_COPY_RAW_STRILES", // from gtiffdataset_write.cpp
    "GTIFF_DELETE_ON_ERROR", // from gtiffdataset_write.cpp
    "GTIFF_DIRECT_IO", // from gtiffdataset.cpp
    "GTIFF_DONT_WRITE_BLOCKS", // from gtiffdataset.cpp
@@ -509,7 +531,9 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GTIFF_IMPORT_FROM_EPSG", // from gt_wkt_srs.cpp
    "GTIFF_LINEAR_UNITS", // from gt_wkt_srs.cpp
    "GTIFF_MAX_CUMULATED_MEM_USAGE", // from tifvsi.cpp
+   "GTIFF_PARALLEL_WRITE", // from gtiffdataset_write.cpp
    "GTIFF_POINT_GEO_IGNORE", // from gt_wkt_srs.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp
+   "GTIFF_READ_AHEAD", // from gtiffdataset.cpp
    "GTIFF_READ_ANGULAR_PARAMS_IN_DEGREE", // from gt_wkt_srs.cpp
    "GTIFF_REPORT_COMPD_CS", // from gtiffdataset_read.cpp, gtiffdataset_write.cpp
    "GTIFF_SRS_SOURCE", // from gt_wkt_srs.cpp
@@ -1023,6 +1047,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "VRT_SHARED_SOURCE", // from vrtsources.cpp
    "VRT_VIRTUAL_OVERVIEWS", // from gdalbuildvrt_lib.cpp, vrtdataset.cpp
    "VSI_CACHE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp, cpl_vsil_unix_stdio_64.cpp, cpl_vsil_win32.cpp
+   "VSI_CACHE_PREFETCH", // from cpl_vsil_cache.cpp
    "VSI_CACHE_SIZE", // from cpl_vsil_cache.cpp
    "VSI_FLUSH", // from cpl_vsil_win32.cpp
    "VSIAZ_CHUNK_SIZE", // from cpl_vsil_az.cpp
@@ -518,6 +518,7 @@ void VSIInstallStdoutHandler(void);   /* No reason to export that */
 void CPL_DLL VSIInstallSparseFileHandler(void);
 void VSIInstallTarFileHandler(void);    /* No reason to export that */
 void VSIInstallCachedFileHandler(void); /* No reason to export that */
+void VSIInstallTraceFileHandler(void);  /* No reason to export that */
 void CPL_DLL VSIInstallCryptFileHandler(void);
 void CPL_DLL VSISetCryptKey(const GByte *pabyKey, int nKeySize);
 /*! @cond Doxygen_Suppress */
@@ -535,6 +536,15 @@ GByte CPL_DLL *VSIGetMemFileBuffer(const char *pszFilename,
                                    vsi_l_offset *pnDataLength,
                                    int bUnlinkAndSeize);
 
+/** Callback used by VSIVisitMemFileBuffer()
+ * @since GDAL 3.12
+ */
+typedef int (*VSIMemFileBufferVisitor)(const GByte *pabyData, size_t nSize,
+                                       void *pUserData);
+int CPL_DLL VSIVisitMemFileBuffer(const char *pszFilename,
+                                  VSIMemFileBufferVisitor pfnVisitor,
+                                  void *pUserData);
+
 const char CPL_DLL *VSIMemGenerateHiddenFilename(const char *pszFilename);
 
 /** Callback used by VSIStdoutSetRedirection() */
@@ -34,6 +34,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <mutex>
 // c++17 or VS2017
@@ -93,13 +94,17 @@ constexpr const char *szHIDDEN_DIRNAME = "/vsimem/.#!HIDDEN!#.";
 /*
 ** Notes on Multithreading:
 **
-** VSIMemFilesystemHandler: This class maintains a mutex to protect
-** access and update of the oFileList array which has all the "files" in
-** the memory filesystem area.  It is expected that multiple threads would
+** VSIMemFilesystemHandler: This class maintains a read-write mutex to
+** protect access and update of the oFileList array which has all the "files"
+** in the memory filesystem area.  It is expected that multiple threads would
 ** want to create and read different files at the same time and so might
-** collide access oFileList without the mutex.
+** collide access oFileList without the mutex.  Lookups (opening an existing
+** file, VSIStatL(), VSIReadDir()) only take it in shared mode, and it is
+** never held while accessing the content of a file.
 **
-** VSIMemFile: A mutex protects accesses to the file
+** VSIMemFile: A read-write mutex protects accesses to the file.  The content
+** is stored as a sequence of chunks, so that growing a file appends a new
+** chunk instead of reallocating and copying the existing content.
 **
 ** VSIMemHandle: This is essentially a "current location" representing
 ** on accessor to a file, and is inherently intended only to be used in
@@ -128,11 +133,23 @@ class VSIMemFile
     bool bIsDirectory = false;
 
     bool bOwnData = true;
-    GByte *pabyData = nullptr;
     vsi_l_offset nLength = 0;
     vsi_l_offset nAllocLength = 0;
     vsi_l_offset nMaxLength = GUINTBIG_MAX;
 
+    // Storage of the content, whose sizes sum to nAllocLength. Bytes between
+    // nLength and nAllocLength are always zero. A file whose buffer was
+    // provided by VSIFileFromMemBuffer() or requested by
+    // VSIGetMemFileBuffer() has a single chunk.
+    struct Chunk
+    {
+        GByte *pabyData = nullptr;
+        vsi_l_offset nOffset = 0;
+        size_t nSize = 0;
+    };
+
+    std::vector<Chunk> aoChunks{};
+
     time_t mTime = 0;
     CPL_SHARED_MUTEX_TYPE m_oMutex{};
 
@@ -140,6 +157,19 @@ class VSIMemFile
     virtual ~VSIMemFile();
 
     bool SetLength(vsi_l_offset nNewSize);
+
+    // Must be called under (at least) shared lock
+    void ReadContent(void *pBuffer, vsi_l_offset nOffset, size_t nSize) const;
+
+    // Must be called under exclusive lock
+    void WriteContent(const void *pBuffer, vsi_l_offset nOffset, size_t nSize);
+    void SetBuffer(GByte *pabyData, vsi_l_offset nDataLength);
+    GByte *GetContiguousBuffer();
+    void FreeChunks();
+
+  private:
+    template <class F>
+    void ForEachChunk(vsi_l_offset nOffset, size_t nSize, F &&f) const;
 };
 
 /************************************************************************/
@@ -180,6 +210,14 @@ class VSIMemHandle final : public VSIVirtualHandle
 
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+
+    bool HasPWrite() const override
+    {
+        return bUpdate;
+    }
+
+    size_t PWrite(const void * /*pBuffer*/, size_t /* nSize */,
+                  vsi_l_offset /*nOffset*/) override;
 };
 
 /************************************************************************/
@@ -195,7 +233,7 @@ class VSIMemFilesystemHandler final : public VSIFilesystemHandler
 
   public:
     std::map<std::string, std::shared_ptr<VSIMemFile>> oFileList{};
-    CPLMutex *hMutex = nullptr;
+    CPL_SHARED_MUTEX_TYPE m_oMutex{};
 
     explicit VSIMemFilesystemHandler(const char *pszPrefix)
         : m_osPrefix(pszPrefix)
@@ -252,8 +290,139 @@ VSIMemFile::VSIMemFile()
 
 VSIMemFile::~VSIMemFile()
 {
-    if (bOwnData && pabyData)
-        CPLFree(pabyData);
+    FreeChunks();
+}
+
+/************************************************************************/
+/*                             FreeChunks()                             */
+/************************************************************************/
+
+void VSIMemFile::FreeChunks()
+{
+    if (bOwnData)
+    {
+        for (const auto &oChunk : aoChunks)
+            CPLFree(oChunk.pabyData);
+    }
+    aoChunks.clear();
+    nAllocLength = 0;
+}
+
+/************************************************************************/
+/*                             SetBuffer()                              */
+/************************************************************************/
+
+// Must be called under exclusive lock
+void VSIMemFile::SetBuffer(GByte *pabyData, vsi_l_offset nDataLength)
+{
+    FreeChunks();
+    if (pabyData)
+    {
+        Chunk oChunk;
+        oChunk.pabyData = pabyData;
+        oChunk.nSize = static_cast<size_t>(nDataLength);
+        aoChunks.push_back(oChunk);
+    }
+    nLength = nDataLength;
+    nAllocLength = nDataLength;
+}
+
+/************************************************************************/
+/*                            ForEachChunk()                            */
+/************************************************************************/
+
+/** Call f(pabyChunkData, nChunkSize, nOffsetInRange) for each piece of the
+ * [nOffset, nOffset + nSize) range, which must be within nAllocLength.
+ */
+template <class F>
+void VSIMemFile::ForEachChunk(vsi_l_offset nOffset, size_t nSize, F &&f) const
+{
+    if (nSize == 0)
+        return;
+    auto oIter = aoChunks.begin();
+    if (aoChunks.size() > 1)
+    {
+        oIter = std::upper_bound(aoChunks.begin(), aoChunks.end(), nOffset,
+                                 [](vsi_l_offset nVal, const Chunk &oChunk)
+                                 { return nVal < oChunk.nOffset; }) -
+                1;
+    }
+    size_t nDone = 0;
+    for (; nDone < nSize; ++oIter)
+    {
+        CPLAssert(oIter != aoChunks.end());
+        const size_t nOffsetInChunk =
+            static_cast<size_t>(nOffset + nDone - oIter->nOffset);
+        const size_t nToProcess =
+            std::min(nSize - nDone, oIter->nSize - nOffsetInChunk);
+        f(oIter->pabyData + nOffsetInChunk, nToProcess, nDone);
+        nDone += nToProcess;
+    }
+}
+
+/************************************************************************/
+/*                            ReadContent()                             */
+/************************************************************************/
+
+void VSIMemFile::ReadContent(void *pBuffer, vsi_l_offset nOffset,
+                             size_t nSize) const
+{
+    ForEachChunk(nOffset, nSize,
+                 [pBuffer](const GByte *pabyChunk, size_t nChunkSize,
+                           size_t nOffsetInRange)
+                 {
+                     memcpy(static_cast<GByte *>(pBuffer) + nOffsetInRange,
+                            pabyChunk, nChunkSize);
+                 });
+}
+
+/************************************************************************/
+/*                            WriteContent()                            */
+/************************************************************************/
+
+void VSIMemFile::WriteContent(const void *pBuffer, vsi_l_offset nOffset,
+                              size_t nSize)
+{
+    ForEachChunk(nOffset, nSize,
+                 [pBuffer](GByte *pabyChunk, size_t nChunkSize,
+                           size_t nOffsetInRange)
+                 {
+                     memcpy(pabyChunk,
+                            static_cast<const GByte *>(pBuffer) +
+                                nOffsetInRange,
+                            nChunkSize);
+                 });
+}
+
+/************************************************************************/
+/*                        GetContiguousBuffer()                         */
+/************************************************************************/
+
+// Must be called under exclusive lock
+GByte *VSIMemFile::GetContiguousBuffer()
+{
+    if (aoChunks.empty())
+        return nullptr;
+    if (aoChunks.size() > 1)
+    {
+        // Gather the chunks into a single buffer, which is the only case
+        // where the content of a file is copied.
+        const size_t nNewAlloc = static_cast<size_t>(nAllocLength);
+        GByte *pabyNewData = static_cast<GByte *>(VSIMalloc(nNewAlloc));
+        if (pabyNewData == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate " CPL_FRMT_GUIB
+                     " bytes for in-memory file",
+                     nAllocLength);
+            return nullptr;
+        }
+        ReadContent(pabyNewData, 0, nNewAlloc);
+        const vsi_l_offset nLengthBackup = nLength;
+        SetBuffer(pabyNewData, nNewAlloc);
+        nLength = nLengthBackup;
+    }
+    return aoChunks[0].pabyData;
 }
 
 /************************************************************************/
@@ -289,45 +458,47 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
 
         // If the first allocation is 1 MB or above, just take that value
         // as the one to allocate
-        // Otherwise slightly reserve more to avoid too frequent reallocations.
-        const vsi_l_offset nNewAlloc =
-            (nAllocLength == 0 && nNewLength >= 1024 * 1024)
-                ? nNewLength
-                : nNewLength + nNewLength / 10 + 5000;
+        // Otherwise slightly reserve more to avoid too frequent allocations.
+        // Next chunks double the allocated size, up to MAX_GROWTH, like
+        // std::vector does, but without copying existing content.
+        constexpr vsi_l_offset MAX_GROWTH = 64 * 1024 * 1024;
+        const vsi_l_offset nNeeded = nNewLength - nAllocLength;
+        const vsi_l_offset nNewChunkSize =
+            nAllocLength == 0
+                ? (nNewLength >= 1024 * 1024
+                       ? nNewLength
+                       : nNewLength + nNewLength / 10 + 5000)
+                : std::max(nNeeded + nNeeded / 10,
+                           std::min(nAllocLength, MAX_GROWTH));
         GByte *pabyNewData = nullptr;
-        if (static_cast<vsi_l_offset>(static_cast<size_t>(nNewAlloc)) ==
-            nNewAlloc)
+        if (static_cast<vsi_l_offset>(static_cast<size_t>(nNewChunkSize)) ==
+            nNewChunkSize)
         {
             pabyNewData = static_cast<GByte *>(
-                nAllocLength == 0
-                    ? VSICalloc(1, static_cast<size_t>(nNewAlloc))
-                    : VSIRealloc(pabyData, static_cast<size_t>(nNewAlloc)));
+                VSICalloc(1, static_cast<size_t>(nNewChunkSize)));
         }
         if (pabyNewData == nullptr)
         {
             CPLError(CE_Failure, CPLE_OutOfMemory,
                      "Cannot extend in-memory file to " CPL_FRMT_GUIB
                      " bytes due to out-of-memory situation",
-                     nNewAlloc);
+                     nAllocLength + nNewChunkSize);
             return false;
         }
 
-        if (nAllocLength > 0)
-        {
-            // Clear the new allocated part of the buffer (only needed if
-            // there was already reserved memory, otherwise VSICalloc() has
-            // zeroized it already)
-            memset(pabyNewData + nAllocLength, 0,
-                   static_cast<size_t>(nNewAlloc - nAllocLength));
-        }
-
-        pabyData = pabyNewData;
-        nAllocLength = nNewAlloc;
+        Chunk oChunk;
+        oChunk.pabyData = pabyNewData;
+        oChunk.nOffset = nAllocLength;
+        oChunk.nSize = static_cast<size_t>(nNewChunkSize);
+        aoChunks.push_back(oChunk);
+        nAllocLength += nNewChunkSize;
     }
     else if (nNewLength < nLength)
     {
-        memset(pabyData + nNewLength, 0,
-               static_cast<size_t>(nLength - nNewLength));
+        const size_t nToClear = static_cast<size_t>(nLength - nNewLength);
+        ForEachChunk(nNewLength, nToClear,
+                     [](GByte *pabyChunk, size_t nChunkSize, size_t)
+                     { memset(pabyChunk, 0, nChunkSize); });
     }
 
     nLength = nNewLength;
@@ -466,9 +637,7 @@ size_t VSIMemHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
             bEOFTmp = true;
         }
 
-        if (nBytesToRead)
-            memcpy(pBuffer, poFile->pabyData + nOffset,
-                   static_cast<size_t>(nBytesToRead));
+        poFile->ReadContent(pBuffer, nOffset, nBytesToRead);
         return true;
     };
 
@@ -496,13 +665,40 @@ size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
         const size_t nToCopy = static_cast<size_t>(
             std::min(static_cast<vsi_l_offset>(poFile->nLength - nOffset),
                      static_cast<vsi_l_offset>(nSize)));
-        memcpy(pBuffer, poFile->pabyData + static_cast<size_t>(nOffset),
-               nToCopy);
+        poFile->ReadContent(pBuffer, nOffset, nToCopy);
         return nToCopy;
     }
     return 0;
 }
 
+/************************************************************************/
+/*                              PWrite()                                */
+/************************************************************************/
+
+size_t VSIMemHandle::PWrite(const void *pBuffer, size_t nSize,
+                            vsi_l_offset nOffset)
+{
+    if (!bUpdate)
+    {
+        errno = EACCES;
+        return 0;
+    }
+
+    CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
+
+    if (nSize + nOffset < nSize)
+        return 0;
+    if (nSize + nOffset > poFile->nLength)
+    {
+        if (!poFile->SetLength(nSize + nOffset))
+            return 0;
+    }
+    poFile->WriteContent(pBuffer, nOffset, nSize);
+    time(&poFile->mTime);
+
+    return nSize;
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -538,8 +734,7 @@ size_t VSIMemHandle::Write(const void *pBuffer, size_t nSize, size_t nCount)
                 return 0;
         }
 
-        if (nBytesToWrite)
-            memcpy(poFile->pabyData + nOffset, pBuffer, nBytesToWrite);
+        poFile->WriteContent(pBuffer, nOffset, nBytesToWrite);
 
         time(&poFile->mTime);
     }
@@ -616,10 +811,6 @@ VSIMemFilesystemHandler::~VSIMemFilesystemHandler()
 
 {
     oFileList.clear();
-
-    if (hMutex != nullptr)
-        CPLDestroyMutex(hMutex);
-    hMutex = nullptr;
 }
 
 /************************************************************************/
@@ -632,7 +823,6 @@ VSIVirtualHandle *VSIMemFilesystemHandler::Open(const char *pszFilename,
                                                 CSLConstList /* papszOptions */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
     const std::string osFilename = NormalizePath(pszFilename);
     if (osFilename.empty())
         return nullptr;
@@ -649,10 +839,13 @@ VSIVirtualHandle *VSIMemFilesystemHandler::Open(const char *pszFilename,
     /*      Get the filename we are opening, create if needed.              */
     /* -------------------------------------------------------------------- */
     std::shared_ptr<VSIMemFile> poFile = nullptr;
-    const auto oIter = oFileList.find(osFilename);
-    if (oIter != oFileList.end())
     {
-        poFile = oIter->second;
+        CPL_SHARED_LOCK oLock(m_oMutex);
+        const auto oIter = oFileList.find(osFilename);
+        if (oIter != oFileList.end())
+        {
+            poFile = oIter->second;
+        }
     }
 
     // If no file and opening in read, error out.
@@ -668,8 +861,11 @@ VSIVirtualHandle *VSIMemFilesystemHandler::Open(const char *pszFilename,
     }
 
     // Create.
+    bool bCreated = false;
     if (poFile == nullptr)
     {
+        // Done without holding m_oMutex, since VSIMkdirRecursive() calls
+        // Stat() and Mkdir()
         const std::string osFileDir = CPLGetPathSafe(osFilename.c_str());
         if (VSIMkdirRecursive(osFileDir.c_str(), 0755) == -1)
         {
@@ -683,17 +879,24 @@ VSIVirtualHandle *VSIMemFilesystemHandler::Open(const char *pszFilename,
             return nullptr;
         }
 
-        poFile = std::make_shared<VSIMemFile>();
-        poFile->osFilename = osFilename;
-        oFileList[poFile->osFilename] = poFile;
+        CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
+        // Another thread may have created it in the meantime
+        auto &poFileInList = oFileList[osFilename];
+        if (poFileInList == nullptr)
+        {
+            poFileInList = std::make_shared<VSIMemFile>();
+            poFileInList->osFilename = osFilename;
+            poFileInList->nMaxLength = nMaxLength;
+            bCreated = true;
 #ifdef DEBUG_VERBOSE
-        CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
-                 static_cast<int>(poFile.use_count()));
+            CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
+                     static_cast<int>(poFileInList.use_count()));
 #endif
-        poFile->nMaxLength = nMaxLength;
+        }
+        poFile = poFileInList;
     }
     // Overwrite
-    else if (strstr(pszAccess, "w"))
+    if (!bCreated && strstr(pszAccess, "w"))
     {
         CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
         poFile->SetLength(0);
@@ -743,8 +946,6 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
                                   VSIStatBufL *pStatBuf, int /* nFlags */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const std::string osFilename = NormalizePath(pszFilename);
 
     memset(pStatBuf, 0, sizeof(VSIStatBufL));
@@ -756,15 +957,18 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
         return 0;
     }
 
-    auto oIter = oFileList.find(osFilename);
-    if (oIter == oFileList.end())
+    std::shared_ptr<VSIMemFile> poFile;
     {
-        errno = ENOENT;
-        return -1;
+        CPL_SHARED_LOCK oLock(m_oMutex);
+        auto oIter = oFileList.find(osFilename);
+        if (oIter == oFileList.end())
+        {
+            errno = ENOENT;
+            return -1;
+        }
+        poFile = oIter->second;
     }
 
-    std::shared_ptr<VSIMemFile> poFile = oIter->second;
-
     memset(pStatBuf, 0, sizeof(VSIStatBufL));
 
     CPL_SHARED_LOCK oLock(poFile->m_oMutex);
@@ -799,7 +1003,7 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
 int VSIMemFilesystemHandler::Unlink(const char *pszFilename)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
     return Unlink_unlocked(pszFilename);
 }
 
@@ -836,8 +1040,6 @@ int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
 int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const std::string osPathname = NormalizePath(pszPathname);
     if (STARTS_WITH(osPathname.c_str(), szHIDDEN_DIRNAME))
     {
@@ -852,6 +1054,8 @@ int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
         // accept creating an explicit directory
     }
 
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
+
     if (oFileList.find(osPathname) != oFileList.end())
     {
         errno = EEXIST;
@@ -886,11 +1090,10 @@ int VSIMemFilesystemHandler::Rmdir(const char *pszPathname)
 
 int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPath = NormalizePath(pszDirname);
     const size_t nPathLen = osPath.size();
     int ret = 0;
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
     if (osPath == "/vsimem")
     {
         // Clean-up all files under pszDirname, except hidden directories
@@ -950,8 +1153,6 @@ int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPath = NormalizePath(pszPath);
 
     char **papszDir = nullptr;
@@ -962,6 +1163,8 @@ char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
     int nItems = 0;
     int nAllocatedItems = 0;
 
+    CPL_SHARED_LOCK oLock(m_oMutex);
+
     if (osPath == szHIDDEN_DIRNAME)
     {
         // Special mode for hidden filenames.
@@ -1053,13 +1256,13 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
                                     void *)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const std::string osOldPath = NormalizePath(pszOldPath);
     const std::string osNewPath = NormalizePath(pszNewPath);
     if (!STARTS_WITH(pszNewPath, m_osPrefix.c_str()))
         return -1;
 
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
+
     if (osOldPath.compare(osNewPath) == 0)
         return 0;
 
@@ -1251,13 +1454,11 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
 
     poFile->osFilename = osFilename;
     poFile->bOwnData = CPL_TO_BOOL(bTakeOwnership);
-    poFile->pabyData = pabyData;
-    poFile->nLength = nDataLength;
-    poFile->nAllocLength = nDataLength;
+    poFile->SetBuffer(pabyData, nDataLength);
 
     if (!osFilename.empty())
     {
-        CPLMutexHolder oHolder(&poHandler->hMutex);
+        CPL_EXCLUSIVE_LOCK oLock(poHandler->m_oMutex);
         poHandler->Unlink_unlocked(osFilename);
         poHandler->oFileList[poFile->osFilename] = poFile;
 #ifdef DEBUG_VERBOSE
@@ -1290,6 +1491,11 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
  * object will be deleted, and ownership of the buffer will pass to the
  * caller otherwise the underlying file will remain in existence.
  *
+ * The content of a file that has grown by writes is stored in several
+ * chunks, which this function gathers into a single buffer, at the cost of
+ * a copy. VSIVisitMemFileBuffer() gives access to the content without
+ * copying it.
+ *
  * @param pszFilename the name of the file to grab the buffer of.
  * @param pnDataLength (file) length returned in this variable.
  * @param bUnlinkAndSeize TRUE to remove the file, or FALSE to leave unaltered.
@@ -1310,36 +1516,109 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
     const std::string osFilename =
         VSIMemFilesystemHandler::NormalizePath(pszFilename);
 
-    CPLMutexHolder oHolder(&poHandler->hMutex);
+    std::shared_ptr<VSIMemFile> poFile;
+    {
+        CPL_EXCLUSIVE_LOCK oLock(poHandler->m_oMutex);
 
-    if (poHandler->oFileList.find(osFilename) == poHandler->oFileList.end())
-        return nullptr;
+        const auto oIter = poHandler->oFileList.find(osFilename);
+        if (oIter == poHandler->oFileList.end())
+            return nullptr;
+
+        poFile = oIter->second;
+        if (bUnlinkAndSeize)
+        {
+            // The content is gathered before unlinking the file, so that it
+            // is left untouched if that fails.
+            CPL_EXCLUSIVE_LOCK oFileLock(poFile->m_oMutex);
+            GByte *pabyData = poFile->GetContiguousBuffer();
+            if (pabyData == nullptr && !poFile->aoChunks.empty())
+                return nullptr;
+            if (pnDataLength != nullptr)
+                *pnDataLength = poFile->nLength;
+
+            poHandler->oFileList.erase(oIter);
+#ifdef DEBUG_VERBOSE
+            CPLDebug("VSIMEM",
+                     "VSIGetMemFileBuffer() %s: ref_count=%d (before)",
+                     poFile->osFilename.c_str(),
+                     static_cast<int>(poFile.use_count()));
+#endif
+
+            if (!poFile->bOwnData)
+                CPLDebug("VSIMemFile",
+                         "File doesn't own data in VSIGetMemFileBuffer!");
+            else
+                poFile->bOwnData = false;
 
-    std::shared_ptr<VSIMemFile> poFile = poHandler->oFileList[osFilename];
-    GByte *pabyData = poFile->pabyData;
+            poFile->FreeChunks();
+            poFile->nLength = 0;
+
+            return pabyData;
+        }
+    }
+
+    CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
+    GByte *pabyData = poFile->GetContiguousBuffer();
     if (pnDataLength != nullptr)
         *pnDataLength = poFile->nLength;
 
-    if (bUnlinkAndSeize)
-    {
-        if (!poFile->bOwnData)
-            CPLDebug("VSIMemFile",
-                     "File doesn't own data in VSIGetMemFileBuffer!");
-        else
-            poFile->bOwnData = false;
+    return pabyData;
+}
 
-        poHandler->oFileList.erase(poHandler->oFileList.find(osFilename));
-#ifdef DEBUG_VERBOSE
-        CPLDebug("VSIMEM", "VSIGetMemFileBuffer() %s: ref_count=%d (before)",
-                 poFile->osFilename.c_str(),
-                 static_cast<int>(poFile.use_count()));
-#endif
-        poFile->pabyData = nullptr;
-        poFile->nLength = 0;
-        poFile->nAllocLength = 0;
+/************************************************************************/
+/*                       VSIVisitMemFileBuffer()                        */
+/************************************************************************/
+
+/**
+ * \brief Visit the buffers underlying a memory file, without copying them.
+ *
+ * pfnVisitor is called, in order, on each of the contiguous buffers that
+ * make the content of the file, until it returns FALSE. The file cannot be
+ * modified during the visit, and the visitor must not write to it.
+ *
+ * @param pszFilename the name of the file to visit.
+ * @param pfnVisitor function called with a pointer to a buffer, its size,
+ *                   and pUserData.
+ * @param pUserData user data passed to pfnVisitor.
+ *
+ * @return TRUE if the file exists and pfnVisitor never returned FALSE.
+ *
+ * @since GDAL 3.12
+ */
+
+int VSIVisitMemFileBuffer(const char *pszFilename,
+                          VSIMemFileBufferVisitor pfnVisitor, void *pUserData)
+{
+    VSIMemFilesystemHandler *poHandler = static_cast<VSIMemFilesystemHandler *>(
+        VSIFileManager::GetHandler("/vsimem/"));
+
+    if (pszFilename == nullptr)
+        return FALSE;
+
+    const std::string osFilename =
+        VSIMemFilesystemHandler::NormalizePath(pszFilename);
+
+    std::shared_ptr<VSIMemFile> poFile;
+    {
+        CPL_SHARED_LOCK oLock(poHandler->m_oMutex);
+        const auto oIter = poHandler->oFileList.find(osFilename);
+        if (oIter == poHandler->oFileList.end())
+            return FALSE;
+        poFile = oIter->second;
     }
 
-    return pabyData;
+    CPL_SHARED_LOCK oLock(poFile->m_oMutex);
+    for (const auto &oChunk : poFile->aoChunks)
+    {
+        if (oChunk.nOffset >= poFile->nLength)
+            break;
+        const size_t nSize = static_cast<size_t>(std::min(
+            static_cast<vsi_l_offset>(oChunk.nSize),
+            poFile->nLength - oChunk.nOffset));
+        if (nSize && !pfnVisitor(oChunk.pabyData, nSize, pUserData))
+            return FALSE;
+    }
+    return TRUE;
 }
 
 /************************************************************************/
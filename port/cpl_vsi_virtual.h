@@ -123,6 +123,10 @@ struct CPL_DLL VSIVirtualHandle
     virtual size_t PRead(void *pBuffer, size_t nSize,
                          vsi_l_offset nOffset) const;
 
+    virtual bool HasPWrite() const;
+    virtual size_t PWrite(const void *pBuffer, size_t nSize,
+                          vsi_l_offset nOffset);
+
     /** Ask current operations to be interrupted.
      * Implementations must be thread-safe, as this will typically be called
      * from another thread than the active one for this file.
@@ -438,6 +442,10 @@ class VSIArchiveEntryFileOffset
 {
   public:
     virtual ~VSIArchiveEntryFileOffset();
+
+    /* Serialize the offset into the persistent index of the archive.
+     * Returns false if the offset cannot be persisted. */
+    virtual bool Serialize(std::string &osData) const;
 };
 
 typedef struct
@@ -491,6 +499,15 @@ class VSIArchiveFilesystemHandler : public VSIFilesystemHandler
     virtual std::vector<CPLString> GetExtensions() = 0;
     virtual VSIArchiveReader *CreateReader(const char *pszArchiveFileName) = 0;
 
+    /* Reverse of VSIArchiveEntryFileOffset::Serialize() */
+    virtual VSIArchiveEntryFileOffset *
+    DeserializeFileOffset(const std::string &osData);
+
+    VSIArchiveContent *LoadArchiveIndex(const char *archiveFilename,
+                                        const VSIStatBufL &sStat);
+    void SaveArchiveIndex(const char *archiveFilename,
+                          const VSIArchiveContent *content, bool bSidecar);
+
   public:
     VSIArchiveFilesystemHandler();
     virtual ~VSIArchiveFilesystemHandler();
@@ -571,6 +588,10 @@ VSIVirtualHandle *VSICreateGZipWritable(VSIVirtualHandle *poBaseHandle,
                                         size_t nSOZIPIndexEltSize,
                                         std::vector<uint8_t> *panSOZIPIndex);
 
+//! @cond Doxygen_Suppress
+std::string CPL_DLL VSICurlGetCachedETag(const char *pszFilename);
+//! @endcond
+
 VSIVirtualHandle *
 VSICreateUploadOnCloseFile(VSIVirtualHandleUniquePtr &&poWritableHandle,
                            VSIVirtualHandleUniquePtr &&poTmpFile,
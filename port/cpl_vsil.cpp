@@ -4132,6 +4132,7 @@ VSIFileManager *VSIFileManager::Get()
     VSIInstallSparseFileHandler();
     VSIInstallTarFileHandler();
     VSIInstallCachedFileHandler();
+    VSIInstallTraceFileHandler();
     VSIInstallCryptFileHandler();
 
     return poManager;
@@ -4346,3 +4347,48 @@ size_t VSIVirtualHandle::PRead(CPL_UNUSED void *pBuffer,
 {
     return 0;
 }
+
+/************************************************************************/
+/*                            HasPWrite()                               */
+/************************************************************************/
+
+/** Returns whether this file handle supports the PWrite() method.
+ *
+ * @since GDAL 3.12
+ */
+bool VSIVirtualHandle::HasPWrite() const
+{
+    return false;
+}
+
+/************************************************************************/
+/*                             PWrite()                                 */
+/************************************************************************/
+
+/** Do a parallel-compatible write operation.
+ *
+ * This methods writes nSize bytes from pBuffer at offset nOffset in the file,
+ * extending it if needed. The current file offset is not affected by this
+ * method.
+ *
+ * The implementation is thread-safe: several threads can issue PWrite()
+ * concurrently on the same VSIVirtualHandle object, on non-overlapping
+ * ranges, while another thread uses the Seek()/Write() interface. It is the
+ * responsibility of the caller to make sure that data written with PWrite()
+ * is not concurrently read or written through other methods.
+ *
+ * This method has the same semantics as pwrite() Linux operation. It is only
+ * available if HasPWrite() returns true.
+ *
+ * @param pBuffer input buffer (must be at least nSize bytes large).
+ * @param nSize   number of bytes to write in the file.
+ * @param nOffset file offset at which to write.
+ * @return number of bytes written.
+ * @since GDAL 3.12
+ */
+size_t VSIVirtualHandle::PWrite(CPL_UNUSED const void *pBuffer,
+                                CPL_UNUSED size_t nSize,
+                                CPL_UNUSED vsi_l_offset nOffset)
+{
+    return 0;
+}
@@ -13,7 +13,10 @@
 #include "cpl_port.h"
 #include "cpl_vsi_virtual.h"
 
+#include <algorithm>
+#include <climits>
 #include <cstring>
+#include <functional>
 #if HAVE_SYS_STAT_H
 #include <sys/stat.h>
 #endif
@@ -25,6 +28,7 @@
 #include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_disk_cache.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
@@ -45,6 +49,15 @@ VSIArchiveEntryFileOffset::~VSIArchiveEntryFileOffset()
 {
 }
 
+/************************************************************************/
+/*                             Serialize()                              */
+/************************************************************************/
+
+bool VSIArchiveEntryFileOffset::Serialize(std::string & /* osData */) const
+{
+    return false;
+}
+
 /************************************************************************/
 /*                        ~VSIArchiveReader()                           */
 /************************************************************************/
@@ -93,6 +106,16 @@ VSIArchiveFilesystemHandler::~VSIArchiveFilesystemHandler()
     hMutex = nullptr;
 }
 
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+VSIArchiveEntryFileOffset *VSIArchiveFilesystemHandler::DeserializeFileOffset(
+    const std::string & /* osData */)
+{
+    return nullptr;
+}
+
 /************************************************************************/
 /*                       GetStrippedFilename()                          */
 /************************************************************************/
@@ -130,6 +153,364 @@ static CPLString GetStrippedFilename(const CPLString &osFileName, bool &bIsDir)
     return osRet;
 }
 
+/************************************************************************/
+/*                     Persistent archive index                         */
+/************************************************************************/
+
+// The listing of an archive can be persisted, so that other processes do
+// not need to scan it again, which for a .tar means reading all its member
+// headers. Two locations are possible:
+// - a <archive>.vsiidx sidecar file, when CPL_VSIL_ARCHIVE_INDEX=YES
+// - <cache_dir>/<2 first hex digits of MD5>/<MD5 of archive name>.vsiidx,
+//   when CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR is set.
+// The files of the cache directory are managed by a CPLDiskCache, with least
+// recently used eviction when it exceeds CPL_VSIL_ARCHIVE_INDEX_CACHE_MAX_SIZE.
+// Both use the same layout, with all integers stored as LSB:
+// - 8 bytes: "GDALAIX1" signature
+// - uint64: size of the archive
+// - uint64: modification time of the archive
+// - uint32: size of the archive name, followed by the archive name (only
+//   checked for files of the cache directory, to detect MD5 collisions)
+// - uint64: number of entries, followed for each entry by:
+//   - uint32: size of the entry name, followed by the entry name
+//   - uint64: uncompressed size
+//   - uint64: modification time
+//   - uint8: 1 for a directory, 0 otherwise
+//   - uint32: size of the serialized file offset, followed by it (the
+//     intermediate directories, not present in the archive, have none)
+
+constexpr const char ARCHIVE_INDEX_SIGNATURE[] = "GDALAIX1";
+constexpr size_t ARCHIVE_INDEX_SIGNATURE_SIZE = CPLDiskCache::SIGNATURE_SIZE;
+constexpr const char ARCHIVE_INDEX_EXTENSION[] = "vsiidx";
+// Minimum size of a serialized entry
+constexpr size_t ARCHIVE_INDEX_MIN_ENTRY_SIZE = 4 + 1 + 8 + 8 + 1 + 4;
+
+static bool UseArchiveIndexSidecar()
+{
+    return CPLTestBool(CPLGetConfigOption("CPL_VSIL_ARCHIVE_INDEX", "NO"));
+}
+
+static std::string GetArchiveIndexSidecarFilename(const char *archiveFilename)
+{
+    return std::string(archiveFilename).append(".").append(
+        ARCHIVE_INDEX_EXTENSION);
+}
+
+static CPLDiskCache &GetArchiveIndexDiskCache()
+{
+    static CPLDiskCache goDiskCache(ARCHIVE_INDEX_SIGNATURE,
+                                    ARCHIVE_INDEX_EXTENSION, "VSIArchive");
+    return goDiskCache;
+}
+
+static std::string GetArchiveIndexCacheDir()
+{
+    return CPLGetConfigOption("CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR", "");
+}
+
+static GIntBig GetArchiveIndexCacheMaxSize()
+{
+    return CPLDiskCache::ParseMaxSize(
+        CPLGetConfigOption("CPL_VSIL_ARCHIVE_INDEX_CACHE_MAX_SIZE", "100MB"),
+        "CPL_VSIL_ARCHIVE_INDEX_CACHE_MAX_SIZE");
+}
+
+static std::string GetArchiveIndexCacheFilename(const std::string &osCacheDir,
+                                                const char *archiveFilename,
+                                                std::string *posSubDir)
+{
+    if (osCacheDir.empty())
+        return std::string();
+    return GetArchiveIndexDiskCache().GetFilename(osCacheDir, archiveFilename,
+                                                  posSubDir);
+}
+
+/************************************************************************/
+/*                         ParseArchiveIndex()                          */
+/************************************************************************/
+
+static VSIArchiveContent *ParseArchiveIndex(
+    const GByte *pabyData, size_t nDataSize, const char *archiveFilename,
+    const VSIStatBufL &sStat,
+    const std::function<VSIArchiveEntryFileOffset *(const std::string &)>
+        &deserializeFileOffset)
+{
+    size_t nPos = 0;
+    const auto ReadBytes = [pabyData, nDataSize, &nPos](void *pDst, size_t n)
+    {
+        if (n > nDataSize - nPos)
+            return false;
+        memcpy(pDst, pabyData + nPos, n);
+        nPos += n;
+        return true;
+    };
+    const auto ReadUInt64 = [&ReadBytes](uint64_t &nVal)
+    {
+        if (!ReadBytes(&nVal, sizeof(nVal)))
+            return false;
+        CPL_LSBPTR64(&nVal);
+        return true;
+    };
+    const auto ReadString = [pabyData, nDataSize, &nPos,
+                             &ReadBytes](std::string &osStr)
+    {
+        uint32_t nSize = 0;
+        if (!ReadBytes(&nSize, sizeof(nSize)))
+            return false;
+        CPL_LSBPTR32(&nSize);
+        if (nSize > nDataSize - nPos)
+            return false;
+        osStr.assign(reinterpret_cast<const char *>(pabyData) + nPos, nSize);
+        nPos += nSize;
+        return true;
+    };
+
+    char achSignature[ARCHIVE_INDEX_SIGNATURE_SIZE];
+    uint64_t nArchiveSize = 0;
+    uint64_t nMTime = 0;
+    std::string osArchiveFilename;
+    uint64_t nEntries = 0;
+    if (!ReadBytes(achSignature, ARCHIVE_INDEX_SIGNATURE_SIZE) ||
+        memcmp(achSignature, ARCHIVE_INDEX_SIGNATURE,
+               ARCHIVE_INDEX_SIGNATURE_SIZE) != 0 ||
+        !ReadUInt64(nArchiveSize) || !ReadUInt64(nMTime) ||
+        !ReadString(osArchiveFilename) || !ReadUInt64(nEntries))
+    {
+        return nullptr;
+    }
+    if (nArchiveSize != static_cast<uint64_t>(sStat.st_size) ||
+        nMTime != static_cast<uint64_t>(sStat.st_mtime) ||
+        (archiveFilename && osArchiveFilename != archiveFilename))
+    {
+        return nullptr;
+    }
+    if (nEntries > (nDataSize - nPos) / ARCHIVE_INDEX_MIN_ENTRY_SIZE)
+        return nullptr;
+
+    auto content = std::make_unique<VSIArchiveContent>();
+    content->mTime = sStat.st_mtime;
+    content->nFileSize = static_cast<vsi_l_offset>(sStat.st_size);
+    content->entries = static_cast<VSIArchiveEntry *>(VSI_CALLOC_VERBOSE(
+        static_cast<size_t>(std::max<uint64_t>(nEntries, 1)),
+        sizeof(VSIArchiveEntry)));
+    if (!content->entries)
+        return nullptr;
+
+    std::string osName;
+    std::string osFileOffset;
+    for (uint64_t i = 0; i < nEntries; ++i)
+    {
+        uint64_t nUncompressedSize = 0;
+        uint64_t nModifiedTime = 0;
+        GByte byIsDir = 0;
+        if (!ReadString(osName) || osName.empty() ||
+            !ReadUInt64(nUncompressedSize) || !ReadUInt64(nModifiedTime) ||
+            !ReadBytes(&byIsDir, 1) || byIsDir > 1 ||
+            !ReadString(osFileOffset))
+        {
+            return nullptr;
+        }
+        VSIArchiveEntryFileOffset *poFileOffset = nullptr;
+        if (!osFileOffset.empty())
+        {
+            poFileOffset = deserializeFileOffset(osFileOffset);
+            if (!poFileOffset)
+                return nullptr;
+        }
+        else if (!byIsDir)
+        {
+            return nullptr;
+        }
+        VSIArchiveEntry &entry = content->entries[content->nEntries];
+        entry.fileName = CPLStrdup(osName.c_str());
+        entry.uncompressed_size = static_cast<vsi_l_offset>(nUncompressedSize);
+        entry.file_pos = poFileOffset;
+        entry.bIsDir = byIsDir;
+        entry.nModifiedTime = static_cast<GIntBig>(nModifiedTime);
+        content->nEntries++;
+    }
+    if (nPos != nDataSize)
+        return nullptr;
+
+    return content.release();
+}
+
+/************************************************************************/
+/*                          LoadArchiveIndex()                          */
+/************************************************************************/
+
+/** Load the listing of archiveFilename from its persistent index, in the
+ * cache directory or in its sidecar file, if there is an up-to-date one.
+ */
+VSIArchiveContent *
+VSIArchiveFilesystemHandler::LoadArchiveIndex(const char *archiveFilename,
+                                              const VSIStatBufL &sStat)
+{
+    const std::string osCacheFilename = GetArchiveIndexCacheFilename(
+        GetArchiveIndexCacheDir(), archiveFilename, nullptr);
+    const bool bUseSidecar = UseArchiveIndexSidecar();
+    if (osCacheFilename.empty() && !bUseSidecar)
+        return nullptr;
+
+    const auto deserializeFileOffset = [this](const std::string &osData)
+    { return DeserializeFileOffset(osData); };
+
+    const auto Load = [archiveFilename, &sStat,
+                       &deserializeFileOffset](const std::string &osFilename,
+                                               bool bCheckArchiveFilename)
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        GByte *pabyData = nullptr;
+        vsi_l_offset nDataSize = 0;
+        if (!VSIIngestFile(nullptr, osFilename.c_str(), &pabyData, &nDataSize,
+                           INT_MAX))
+        {
+            return static_cast<VSIArchiveContent *>(nullptr);
+        }
+        VSIArchiveContent *content = ParseArchiveIndex(
+            pabyData, static_cast<size_t>(nDataSize),
+            bCheckArchiveFilename ? archiveFilename : nullptr, sStat,
+            deserializeFileOffset);
+        VSIFree(pabyData);
+        if (content)
+        {
+            CPLDebug("VSIArchive", "Using %s with %d entries",
+                     osFilename.c_str(), content->nEntries);
+        }
+        return content;
+    };
+
+    if (!osCacheFilename.empty())
+    {
+        if (VSIArchiveContent *content = Load(osCacheFilename, true))
+        {
+            VSIStatBufL sCacheStat;
+            if (VSIStatL(osCacheFilename.c_str(), &sCacheStat) == 0)
+                GetArchiveIndexDiskCache().Touch(osCacheFilename, sCacheStat);
+            return content;
+        }
+    }
+
+    if (bUseSidecar)
+    {
+        VSIArchiveContent *content =
+            Load(GetArchiveIndexSidecarFilename(archiveFilename), false);
+        if (content)
+        {
+            if (!osCacheFilename.empty())
+                SaveArchiveIndex(archiveFilename, content, false);
+            return content;
+        }
+    }
+
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          SaveArchiveIndex()                          */
+/************************************************************************/
+
+/** Persist the listing of archiveFilename into the cache directory, and
+ * into its sidecar file if bSidecar. Errors are silently ignored.
+ */
+void VSIArchiveFilesystemHandler::SaveArchiveIndex(
+    const char *archiveFilename, const VSIArchiveContent *content,
+    bool bSidecar)
+{
+    const std::string osCacheDir = GetArchiveIndexCacheDir();
+    std::string osSubDir;
+    const std::string osCacheFilename =
+        GetArchiveIndexCacheFilename(osCacheDir, archiveFilename, &osSubDir);
+    const std::string osSidecarFilename =
+        GetArchiveIndexSidecarFilename(archiveFilename);
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    // Same restrictions as for the .gz.gzidx file
+    const bool bWriteSidecar = bSidecar &&
+                               !STARTS_WITH(archiveFilename, "/vsicurl/") &&
+                               !STARTS_WITH(archiveFilename, "/vsitar/") &&
+                               !STARTS_WITH(archiveFilename, "/vsizip/");
+    if (osCacheFilename.empty() && !bWriteSidecar)
+        return;
+
+    std::string osData;
+    const auto WriteUInt32 = [&osData](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        osData.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    const auto WriteUInt64 = [&osData](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        osData.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    const auto WriteString = [&osData, &WriteUInt32](const std::string &osStr)
+    {
+        WriteUInt32(static_cast<uint32_t>(osStr.size()));
+        osData.append(osStr);
+    };
+
+    try
+    {
+        osData.append(ARCHIVE_INDEX_SIGNATURE, ARCHIVE_INDEX_SIGNATURE_SIZE);
+        WriteUInt64(static_cast<uint64_t>(content->nFileSize));
+        WriteUInt64(static_cast<uint64_t>(content->mTime));
+        WriteString(archiveFilename);
+        WriteUInt64(static_cast<uint64_t>(content->nEntries));
+        std::string osFileOffset;
+        for (int i = 0; i < content->nEntries; ++i)
+        {
+            const VSIArchiveEntry &entry = content->entries[i];
+            osFileOffset.clear();
+            if (entry.file_pos && (!entry.file_pos->Serialize(osFileOffset) ||
+                                   osFileOffset.empty()))
+            {
+                return;
+            }
+            WriteString(entry.fileName);
+            WriteUInt64(static_cast<uint64_t>(entry.uncompressed_size));
+            WriteUInt64(static_cast<uint64_t>(entry.nModifiedTime));
+            osData.push_back(entry.bIsDir ? 1 : 0);
+            WriteString(osFileOffset);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        return;
+    }
+
+    const auto Write = [&osData](const std::string &osFilename)
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "wb"));
+        if (!fp)
+            return false;
+        bool bOK = fp->Write(osData.data(), 1, osData.size()) == osData.size();
+        bOK = fp->Close() == 0 && bOK;
+        if (!bOK)
+            VSIUnlink(osFilename.c_str());
+        return bOK;
+    };
+
+    if (!osCacheFilename.empty())
+    {
+        CPLDiskCache &oDiskCache = GetArchiveIndexDiskCache();
+        CPLDiskCache::CreateSubDir(osCacheDir, osSubDir);
+        const std::string osTmpFilename =
+            oDiskCache.GetTmpFilename(osCacheFilename);
+        if (Write(osTmpFilename) &&
+            CPLDiskCache::InstallTmpFile(osTmpFilename, osCacheFilename,
+                                         /* bOverwrite = */ true))
+        {
+            oDiskCache.NotifyBytesWritten(osCacheDir, osData.size(),
+                                          GetArchiveIndexCacheMaxSize());
+        }
+    }
+
+    if (bWriteSidecar && Write(osSidecarFilename))
+    {
+        CPLDebug("VSIArchive", "%s written", osSidecarFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /*                       GetContentOfArchive()                          */
 /************************************************************************/
@@ -162,6 +543,12 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
         }
     }
 
+    if (VSIArchiveContent *content = LoadArchiveIndex(archiveFilename, sStat))
+    {
+        oFileList[archiveFilename] = content;
+        return content;
+    }
+
     bool bMustClose = poReader == nullptr;
     if (poReader == nullptr)
     {
@@ -269,6 +656,8 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
     if (bMustClose)
         delete (poReader);
 
+    SaveArchiveIndex(archiveFilename, content, UseArchiveIndexSidecar());
+
     return content;
 }
 
@@ -21,9 +21,14 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "cpl_conv.h"
@@ -47,15 +52,16 @@ class VSICachedFile final : public VSIVirtualHandle
 
   public:
     VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                  size_t nCacheSize);
+                  size_t nCacheSize, bool bPrefetch);
 
     ~VSICachedFile() override
     {
         VSICachedFile::Close();
     }
 
+    // Must be called with m_oBaseMutex held
     bool LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount, void *pBuffer,
-                    size_t nBufferSize);
+                    size_t nBufferSize, bool bFromPrefetch = false);
 
     VSIVirtualHandleUniquePtr m_poBase{};
 
@@ -67,7 +73,45 @@ class VSICachedFile final : public VSIVirtualHandle
         m_oCache;  // can only been initialized in constructor
 
     bool m_bEOF = false;
-    bool m_bError = false;
+    std::atomic<bool> m_bError{false};
+
+    // m_oBaseMutex protects the use of m_poBase, and m_oCacheMutex the
+    // access to m_oCache. When both are needed, m_oBaseMutex must be taken
+    // first. They are only contended when prefetching is enabled.
+    mutable std::mutex m_oBaseMutex{};
+    std::mutex m_oCacheMutex{};
+
+    // Prefetching, enabled by VSI_CACHE_PREFETCH or the prefetch=yes option
+    // of /vsicached?. Ranges of blocks are loaded by a background thread,
+    // either when a sequential pattern is detected, or from AdviseRead().
+    const bool m_bPrefetch;
+    size_t m_nMaxPrefetchBlocks = 1;
+    size_t m_nPrefetchBlocks = 1;  // Current read-ahead window, in blocks
+    vsi_l_offset m_nNextPrefetchBlock = 0;
+    vsi_l_offset m_nLastReadEnd = 0;
+    int m_nSequentialReads = 0;
+
+    std::mutex m_oPrefetchMutex{};
+    std::condition_variable m_oPrefetchCV{};
+    // Pairs of (start block, block count)
+    std::deque<std::pair<vsi_l_offset, size_t>> m_aoPrefetchQueue{};
+    bool m_bStopPrefetch = false;
+    std::thread m_oPrefetchThread{};
+
+    bool IsCached(vsi_l_offset nBlock)
+    {
+        std::lock_guard oLock(m_oCacheMutex);
+        return m_oCache.contains(nBlock);
+    }
+
+    void LoadMissingBlocks(vsi_l_offset nStartBlock, vsi_l_offset nEndBlock,
+                           void *pBuffer, size_t nBufferSize);
+    void QueuePrefetch(std::deque<std::pair<vsi_l_offset, size_t>> &&aoRanges,
+                       bool bReplace);
+    void SchedulePrefetchAfterRead(vsi_l_offset nOffset, size_t nSize,
+                                   vsi_l_offset nEndBlock);
+    void PrefetchThread();
+    void StopPrefetch();
 
     int Seek(vsi_l_offset nOffset, int nWhence) override;
     vsi_l_offset Tell() override;
@@ -77,10 +121,8 @@ class VSICachedFile final : public VSIVirtualHandle
                        const size_t *panSizes) override;
 
     void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
-                    const size_t *panSizes) override
-    {
-        m_poBase->AdviseRead(nRanges, panOffsets, panSizes);
-    }
+                    const size_t *panSizes) override;
+    size_t GetAdviseReadTotalBytesLimit() const override;
 
     size_t Write(const void *pBuffer, size_t nSize, size_t nMemb) override;
     void ClearErr() override;
@@ -152,13 +194,17 @@ template <class T> inline T DIV_ROUND_UP(T a, T b)
 /************************************************************************/
 
 VSICachedFile::VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                             size_t nCacheSize)
+                             size_t nCacheSize, bool bPrefetch)
     : m_poBase(poBaseHandle),
       m_nChunkSize(nChunkSize ? nChunkSize : VSI_CACHED_DEFAULT_CHUNK_SIZE),
-      m_oCache{DIV_ROUND_UP(GetCacheMax(nCacheSize), m_nChunkSize), 0}
+      m_oCache{DIV_ROUND_UP(GetCacheMax(nCacheSize), m_nChunkSize), 0},
+      m_bPrefetch(bPrefetch)
 {
     m_poBase->Seek(0, SEEK_END);
     m_nFileSize = m_poBase->Tell();
+
+    // Do not let prefetched blocks evict more than a quarter of the cache
+    m_nMaxPrefetchBlocks = std::max<size_t>(1, m_oCache.getMaxSize() / 4);
 }
 
 /************************************************************************/
@@ -168,6 +214,8 @@ VSICachedFile::VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
 int VSICachedFile::Close()
 
 {
+    StopPrefetch();
+
     m_oCache.clear();
     m_poBase.reset();
 
@@ -219,7 +267,8 @@ vsi_l_offset VSICachedFile::Tell()
 /************************************************************************/
 
 bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
-                               void *pBuffer, size_t nBufferSize)
+                               void *pBuffer, size_t nBufferSize,
+                               bool bFromPrefetch)
 
 {
     if (nBlockCount == 0)
@@ -246,9 +295,16 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
             if (nDataRead == 0)
                 return false;
             if (nDataRead < m_nChunkSize && m_poBase->Error())
-                m_bError = true;
+            {
+                // Errors of prefetching are not those of the caller
+                if (bFromPrefetch)
+                    m_poBase->ClearErr();
+                else
+                    m_bError = true;
+            }
             oData.resize(nDataRead);
 
+            std::lock_guard oLock(m_oCacheMutex);
             m_oCache.insert(nStartBlock, std::move(oData));
         }
         catch (const std::exception &)
@@ -270,11 +326,11 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
     if (nBufferSize > m_nChunkSize * 20 &&
         nBufferSize < nBlockCount * m_nChunkSize)
     {
-        if (!LoadBlocks(nStartBlock, 2, pBuffer, nBufferSize))
+        if (!LoadBlocks(nStartBlock, 2, pBuffer, nBufferSize, bFromPrefetch))
             return false;
 
         return LoadBlocks(nStartBlock + 2, nBlockCount - 2, pBuffer,
-                          nBufferSize);
+                          nBufferSize, bFromPrefetch);
     }
 
     if (m_poBase->Seek(static_cast<vsi_l_offset>(nStartBlock) * m_nChunkSize,
@@ -301,7 +357,13 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
     const size_t nToRead = nBlockCount * m_nChunkSize;
     const size_t nDataRead = m_poBase->Read(pabyWorkBuffer, 1, nToRead);
     if (nDataRead < nToRead && m_poBase->Error())
-        m_bError = true;
+    {
+        // Errors of prefetching are not those of the caller
+        if (bFromPrefetch)
+            m_poBase->ClearErr();
+        else
+            m_bError = true;
+    }
 
     bool ret = true;
     if (nToRead > nDataRead + m_nChunkSize - 1)
@@ -328,6 +390,7 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
             memcpy(oData.data(), pabyWorkBuffer + i * m_nChunkSize,
                    nDataFilled);
 
+            std::lock_guard oLock(m_oCacheMutex);
             m_oCache.insert(iBlock, std::move(oData));
         }
         catch (const std::exception &)
@@ -378,27 +441,15 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
         nEndBlock = nLastBlock;
     }
 
-    for (vsi_l_offset iBlock = nStartBlock; iBlock <= nEndBlock; iBlock++)
-    {
-        if (!m_oCache.contains(iBlock))
-        {
-            size_t nBlocksToLoad = 1;
-            while (iBlock + nBlocksToLoad <= nEndBlock &&
-                   !m_oCache.contains(iBlock + nBlocksToLoad))
-            {
-                nBlocksToLoad++;
-            }
-
-            if (!LoadBlocks(iBlock, nBlocksToLoad, pBuffer, nRequestedBytes))
-                break;
-        }
-    }
+    LoadMissingBlocks(nStartBlock, nEndBlock, pBuffer, nRequestedBytes);
 
     /* ==================================================================== */
     /*      Copy data into the target buffer to the extent possible.        */
     /* ==================================================================== */
     size_t nAmountCopied = 0;
+    const vsi_l_offset nOffsetBeforeRead = m_nOffset;
 
+    std::unique_lock oCacheLock(m_oCacheMutex);
     while (nAmountCopied < nRequestedBytes)
     {
         const vsi_l_offset iBlock = (m_nOffset + nAmountCopied) / m_nChunkSize;
@@ -407,8 +458,15 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
         {
             // We can reach that point when the amount to read exceeds
             // the cache size.
-            LoadBlocks(iBlock, 1, static_cast<GByte *>(pBuffer) + nAmountCopied,
-                       std::min(nRequestedBytes - nAmountCopied, m_nChunkSize));
+            oCacheLock.unlock();
+            {
+                std::lock_guard oBaseLock(m_oBaseMutex);
+                LoadBlocks(iBlock, 1,
+                           static_cast<GByte *>(pBuffer) + nAmountCopied,
+                           std::min(nRequestedBytes - nAmountCopied,
+                                    m_nChunkSize));
+            }
+            oCacheLock.lock();
             poData = m_oCache.getPtr(iBlock);
             if (poData == nullptr)
             {
@@ -433,15 +491,269 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
 
         nAmountCopied += nThisCopy;
     }
+    oCacheLock.unlock();
 
     m_nOffset += nAmountCopied;
 
+    if (m_bPrefetch)
+        SchedulePrefetchAfterRead(nOffsetBeforeRead, nAmountCopied, nEndBlock);
+
     const size_t nRet = nAmountCopied / nSize;
     if (nRet != nCount && !m_bError)
         m_bEOF = true;
     return nRet;
 }
 
+/************************************************************************/
+/*                         LoadMissingBlocks()                          */
+/************************************************************************/
+
+void VSICachedFile::LoadMissingBlocks(vsi_l_offset nStartBlock,
+                                      vsi_l_offset nEndBlock, void *pBuffer,
+                                      size_t nBufferSize)
+{
+    // Fast path, not requiring m_oBaseMutex, which may be held by the
+    // prefetching thread.
+    {
+        std::lock_guard oLock(m_oCacheMutex);
+        vsi_l_offset iBlock = nStartBlock;
+        while (iBlock <= nEndBlock && m_oCache.contains(iBlock))
+            ++iBlock;
+        if (iBlock > nEndBlock)
+            return;
+    }
+
+    // Blocks being prefetched will be available once we get the lock
+    std::lock_guard oBaseLock(m_oBaseMutex);
+    for (vsi_l_offset iBlock = nStartBlock; iBlock <= nEndBlock; iBlock++)
+    {
+        if (!IsCached(iBlock))
+        {
+            size_t nBlocksToLoad = 1;
+            while (iBlock + nBlocksToLoad <= nEndBlock &&
+                   !IsCached(iBlock + nBlocksToLoad))
+            {
+                nBlocksToLoad++;
+            }
+
+            if (!LoadBlocks(iBlock, nBlocksToLoad, pBuffer, nBufferSize))
+                break;
+        }
+    }
+}
+
+/************************************************************************/
+/*                     SchedulePrefetchAfterRead()                      */
+/************************************************************************/
+
+void VSICachedFile::SchedulePrefetchAfterRead(vsi_l_offset nOffset,
+                                              size_t nSize,
+                                              vsi_l_offset nEndBlock)
+{
+    // Adapt the read-ahead window to the access pattern: it doubles at
+    // each sequential read, and is reset by random accesses.
+    if (nOffset == m_nLastReadEnd)
+    {
+        ++m_nSequentialReads;
+    }
+    else
+    {
+        m_nSequentialReads = 0;
+        m_nPrefetchBlocks = 1;
+        m_nNextPrefetchBlock = 0;
+    }
+    m_nLastReadEnd = nOffset + nSize;
+    if (m_nSequentialReads < 2 || m_nFileSize == 0)
+        return;
+
+    const vsi_l_offset nLastBlock = (m_nFileSize - 1) / m_nChunkSize;
+    const vsi_l_offset nFirstBlock =
+        std::max(nEndBlock + 1, m_nNextPrefetchBlock);
+    const vsi_l_offset nTargetBlock =
+        std::min(nEndBlock + m_nPrefetchBlocks, nLastBlock);
+    if (nFirstBlock > nTargetBlock)
+        return;
+
+    m_nNextPrefetchBlock = nTargetBlock + 1;
+    m_nPrefetchBlocks = std::min(m_nPrefetchBlocks * 2, m_nMaxPrefetchBlocks);
+
+    std::deque<std::pair<vsi_l_offset, size_t>> aoRanges;
+    aoRanges.emplace_back(nFirstBlock,
+                          static_cast<size_t>(nTargetBlock - nFirstBlock + 1));
+    QueuePrefetch(std::move(aoRanges), false);
+}
+
+/************************************************************************/
+/*                           QueuePrefetch()                            */
+/************************************************************************/
+
+void VSICachedFile::QueuePrefetch(
+    std::deque<std::pair<vsi_l_offset, size_t>> &&aoRanges, bool bReplace)
+{
+    std::lock_guard oLock(m_oPrefetchMutex);
+    if (bReplace)
+        m_aoPrefetchQueue = std::move(aoRanges);
+    else
+    {
+        for (const auto &oRange : aoRanges)
+            m_aoPrefetchQueue.push_back(oRange);
+    }
+    if (m_aoPrefetchQueue.empty() || m_bStopPrefetch)
+        return;
+    if (!m_oPrefetchThread.joinable())
+    {
+        m_oPrefetchThread = std::thread([this]() { PrefetchThread(); });
+    }
+    m_oPrefetchCV.notify_one();
+}
+
+/************************************************************************/
+/*                           PrefetchThread()                           */
+/************************************************************************/
+
+void VSICachedFile::PrefetchThread()
+{
+    // Maximum number of blocks loaded while holding m_oBaseMutex, so that
+    // the reader thread is not blocked too long for unrelated reads.
+    const size_t nMaxBlocksPerLoad =
+        std::max<size_t>(1, 1024 * 1024 / m_nChunkSize);
+
+    while (true)
+    {
+        std::pair<vsi_l_offset, size_t> oRange;
+        {
+            std::unique_lock oLock(m_oPrefetchMutex);
+            m_oPrefetchCV.wait(
+                oLock,
+                [this]()
+                { return m_bStopPrefetch || !m_aoPrefetchQueue.empty(); });
+            if (m_bStopPrefetch)
+                return;
+            oRange = m_aoPrefetchQueue.front();
+            m_aoPrefetchQueue.pop_front();
+        }
+
+        const vsi_l_offset nEndBlock = oRange.first + oRange.second;
+        for (vsi_l_offset iBlock = oRange.first; iBlock < nEndBlock;)
+        {
+            {
+                std::lock_guard oLock(m_oPrefetchMutex);
+                if (m_bStopPrefetch)
+                    return;
+            }
+
+            std::lock_guard oBaseLock(m_oBaseMutex);
+            if (IsCached(iBlock))
+            {
+                ++iBlock;
+                continue;
+            }
+            size_t nBlocksToLoad = 1;
+            while (nBlocksToLoad < nMaxBlocksPerLoad &&
+                   iBlock + nBlocksToLoad < nEndBlock &&
+                   !IsCached(iBlock + nBlocksToLoad))
+            {
+                nBlocksToLoad++;
+            }
+            if (!LoadBlocks(iBlock, nBlocksToLoad, nullptr, 0,
+                            /* bFromPrefetch = */ true))
+            {
+                break;
+            }
+            iBlock += nBlocksToLoad;
+        }
+    }
+}
+
+/************************************************************************/
+/*                            StopPrefetch()                            */
+/************************************************************************/
+
+void VSICachedFile::StopPrefetch()
+{
+    {
+        std::lock_guard oLock(m_oPrefetchMutex);
+        m_bStopPrefetch = true;
+        m_aoPrefetchQueue.clear();
+    }
+    m_oPrefetchCV.notify_one();
+    if (m_oPrefetchThread.joinable())
+        m_oPrefetchThread.join();
+}
+
+/************************************************************************/
+/*                             AdviseRead()                             */
+/************************************************************************/
+
+void VSICachedFile::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                               const size_t *panSizes)
+{
+    // Base handles with their own AdviseRead() implementation, such as
+    // /vsicurl/, do it better than us.
+    {
+        std::lock_guard oBaseLock(m_oBaseMutex);
+        if (!m_bPrefetch || m_poBase->GetAdviseReadTotalBytesLimit() > 0)
+        {
+            m_poBase->AdviseRead(nRanges, panOffsets, panSizes);
+            return;
+        }
+    }
+
+    // Warm the cache with the advised ranges, up to half of its size, and
+    // replacing the ranges of a previous call not processed yet.
+    std::deque<std::pair<vsi_l_offset, size_t>> aoRanges;
+    const size_t nMaxBlocks = std::max<size_t>(1, m_oCache.getMaxSize() / 2);
+    size_t nTotalBlocks = 0;
+    for (int i = 0; i < nRanges && nTotalBlocks < nMaxBlocks; ++i)
+    {
+        if (panSizes[i] == 0)
+            continue;
+        const vsi_l_offset nStartBlock = panOffsets[i] / m_nChunkSize;
+        const vsi_l_offset nEndBlock =
+            (panOffsets[i] + panSizes[i] - 1) / m_nChunkSize;
+        const size_t nBlocks = static_cast<size_t>(
+            std::min<vsi_l_offset>(nEndBlock - nStartBlock + 1,
+                                   nMaxBlocks - nTotalBlocks));
+        const vsi_l_offset nPrevEnd =
+            aoRanges.empty() ? 0
+                             : aoRanges.back().first + aoRanges.back().second;
+        if (!aoRanges.empty() && nStartBlock >= aoRanges.back().first &&
+            nStartBlock < nPrevEnd)
+        {
+            // Overlapping with the previous range: only keep the new blocks
+            if (nStartBlock + nBlocks > nPrevEnd)
+            {
+                const size_t nExtra =
+                    static_cast<size_t>(nStartBlock + nBlocks - nPrevEnd);
+                aoRanges.back().second += nExtra;
+                nTotalBlocks += nExtra;
+            }
+            continue;
+        }
+        aoRanges.emplace_back(nStartBlock, nBlocks);
+        nTotalBlocks += nBlocks;
+    }
+    QueuePrefetch(std::move(aoRanges), true);
+}
+
+/************************************************************************/
+/*                    GetAdviseReadTotalBytesLimit()                    */
+/************************************************************************/
+
+size_t VSICachedFile::GetAdviseReadTotalBytesLimit() const
+{
+    if (!m_bPrefetch)
+        return 0;
+    size_t nBaseLimit;
+    {
+        std::lock_guard oBaseLock(m_oBaseMutex);
+        nBaseLimit = m_poBase->GetAdviseReadTotalBytesLimit();
+    }
+    if (nBaseLimit > 0)
+        return nBaseLimit;
+    return std::max<size_t>(1, m_oCache.getMaxSize() / 2) * m_nChunkSize;
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -451,6 +763,7 @@ int VSICachedFile::ReadMultiRange(int const nRanges, void **const ppData,
                                   const size_t *const panSizes)
 {
     // If the base is /vsicurl/
+    std::lock_guard oBaseLock(m_oBaseMutex);
     return m_poBase->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
 }
 
@@ -471,7 +784,10 @@ size_t VSICachedFile::Write(const void * /* pBuffer */, size_t /*nSize */,
 void VSICachedFile::ClearErr()
 
 {
-    m_poBase->ClearErr();
+    {
+        std::lock_guard oBaseLock(m_oBaseMutex);
+        m_poBase->ClearErr();
+    }
     m_bEOF = false;
     m_bError = false;
 }
@@ -514,7 +830,8 @@ class VSICachedFilesystemHandler final : public VSIFilesystemHandler
 {
     static bool AnalyzeFilename(const char *pszFilename,
                                 std::string &osUnderlyingFilename,
-                                size_t &nChunkSize, size_t &nCacheSize);
+                                size_t &nChunkSize, size_t &nCacheSize,
+                                bool &bPrefetch);
 
   public:
     VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
@@ -584,7 +901,7 @@ static bool ParseSize(const char *pszKey, const char *pszValue, size_t nMaxVal,
 
 bool VSICachedFilesystemHandler::AnalyzeFilename(
     const char *pszFilename, std::string &osUnderlyingFilename,
-    size_t &nChunkSize, size_t &nCacheSize)
+    size_t &nChunkSize, size_t &nCacheSize, bool &bPrefetch)
 {
 
     if (!STARTS_WITH(pszFilename, "/vsicached?"))
@@ -596,6 +913,7 @@ bool VSICachedFilesystemHandler::AnalyzeFilename(
     osUnderlyingFilename.clear();
     nChunkSize = 0;
     nCacheSize = 0;
+    bPrefetch = CPLTestBool(CPLGetConfigOption("VSI_CACHE_PREFETCH", "NO"));
 
     for (int i = 0; i < aosTokens.size(); ++i)
     {
@@ -629,6 +947,10 @@ bool VSICachedFilesystemHandler::AnalyzeFilename(
                     return false;
                 }
             }
+            else if (strcmp(pszKey, "prefetch") == 0)
+            {
+                bPrefetch = CPLTestBool(pszValue);
+            }
             else
             {
                 CPLError(CE_Warning, CPLE_NotSupported,
@@ -658,8 +980,9 @@ VSIVirtualHandle *VSICachedFilesystemHandler::Open(const char *pszFilename,
     std::string osUnderlyingFilename;
     size_t nChunkSize = 0;
     size_t nCacheSize = 0;
+    bool bPrefetch = false;
     if (!AnalyzeFilename(pszFilename, osUnderlyingFilename, nChunkSize,
-                         nCacheSize))
+                         nCacheSize, bPrefetch))
         return nullptr;
     if (strcmp(pszAccess, "r") != 0 && strcmp(pszAccess, "rb") != 0)
     {
@@ -675,7 +998,7 @@ VSIVirtualHandle *VSICachedFilesystemHandler::Open(const char *pszFilename,
                            papszOptions);
     if (!fp)
         return nullptr;
-    return VSICreateCachedFile(fp, nChunkSize, nCacheSize);
+    return new VSICachedFile(fp, nChunkSize, nCacheSize, bPrefetch);
 }
 
 /************************************************************************/
@@ -688,8 +1011,9 @@ int VSICachedFilesystemHandler::Stat(const char *pszFilename,
     std::string osUnderlyingFilename;
     size_t nChunkSize = 0;
     size_t nCacheSize = 0;
+    bool bPrefetch = false;
     if (!AnalyzeFilename(pszFilename, osUnderlyingFilename, nChunkSize,
-                         nCacheSize))
+                         nCacheSize, bPrefetch))
         return -1;
     return VSIStatExL(osUnderlyingFilename.c_str(), pStatBuf, nFlags);
 }
@@ -704,8 +1028,9 @@ char **VSICachedFilesystemHandler::ReadDirEx(const char *pszDirname,
     std::string osUnderlyingFilename;
     size_t nChunkSize = 0;
     size_t nCacheSize = 0;
+    bool bPrefetch = false;
     if (!AnalyzeFilename(pszDirname, osUnderlyingFilename, nChunkSize,
-                         nCacheSize))
+                         nCacheSize, bPrefetch))
         return nullptr;
     return VSIReadDirEx(osUnderlyingFilename.c_str(), nMaxFiles);
 }
@@ -723,6 +1048,11 @@ char **VSICachedFilesystemHandler::ReadDirEx(const char *pszDirname,
  * the content of the cache is discarded when the file handle is closed.
  * The cache is a least-recently used lists of blocks of 32KB each.
  *
+ * If the VSI_CACHE_PREFETCH configuration option is set to YES (GDAL >= 3.12),
+ * blocks following sequential reads, with a read-ahead window growing with
+ * the length of the sequence, and ranges passed to AdviseRead() are loaded
+ * by a background thread.
+ *
  * @param poBaseHandle base handle
  * @param nChunkSize chunk size, in bytes. If 0, defaults to 32 KB
  * @param nCacheSize total size of the cache for the file, in bytes.
@@ -734,7 +1064,9 @@ VSIVirtualHandle *VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
                                       size_t nChunkSize, size_t nCacheSize)
 
 {
-    return new VSICachedFile(poBaseHandle, nChunkSize, nCacheSize);
+    return new VSICachedFile(
+        poBaseHandle, nChunkSize, nCacheSize,
+        CPLTestBool(CPLGetConfigOption("VSI_CACHE_PREFETCH", "NO")));
 }
 
 /************************************************************************/
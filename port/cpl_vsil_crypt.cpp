@@ -15,9 +15,16 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 
 CPL_C_START
 void CPL_DLL VSIInstallCryptFileHandler();
@@ -726,6 +733,34 @@ int VSICryptFileHeader::WriteToFile(VSIVirtualHandle *fp,
     return bRet;
 }
 
+/************************************************************************/
+/*                   VSICryptFilesystemHandler                          */
+/************************************************************************/
+
+class VSICryptFilesystemHandler final : public VSIFilesystemHandler
+{
+  public:
+    VSICryptFilesystemHandler();
+    ~VSICryptFilesystemHandler() override;
+
+    VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
+                           bool bSetError,
+                           CSLConstList /* papszOptions */) override;
+    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
+             int nFlags) override;
+    int Unlink(const char *pszFilename) override;
+    int Rename(const char *oldpath, const char *newpath, GDALProgressFunc,
+               void *) override;
+    char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
+    int HasOptimizedReadMultiRange(const char *pszPath) override;
+
+    CPLWorkerThreadPool *GetThreadPool(int nThreads);
+
+  private:
+    std::mutex m_oMutexPool{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+};
+
 /************************************************************************/
 /*                          VSICryptFileHandle                          */
 /************************************************************************/
@@ -755,8 +790,24 @@ class VSICryptFileHandle final : public VSIVirtualHandle
 
     bool bLastSectorWasModified = false;
 
+    int nThreads = 1;
+    std::unique_ptr<CPLJobQueue> poJobQueue{};
+
+    //! Run of consecutive sectors to decrypt in place.
+    struct SectorRun
+    {
+        GByte *pabyData;
+        vsi_l_offset nOffset;
+        size_t nSectors;
+    };
+
     void EncryptBlock(GByte *pabyData, vsi_l_offset nOffset);
     bool DecryptBlock(GByte *pabyData, vsi_l_offset nOffset);
+    bool DecryptSectors(GByte *pabyData, vsi_l_offset nOffset, size_t nSectors,
+                        CryptoPP::BlockCipher &oEncCipher,
+                        CryptoPP::BlockCipher &oDecCipher,
+                        std::string &osErrorMsg) const;
+    bool DecryptSectorRuns(const std::vector<SectorRun> &aoRuns);
     bool FlushDirty();
 
   public:
@@ -770,6 +821,9 @@ class VSICryptFileHandle final : public VSIVirtualHandle
     int Seek(vsi_l_offset nOffset, int nWhence) override;
     vsi_l_offset Tell() override;
     size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
     size_t Write(const void *pBuffer, size_t nSize, size_t nMemb) override;
     int Eof() override;
     int Error() override;
@@ -883,61 +937,185 @@ int VSICryptFileHandle::Init(const CPLString &osKey, bool bWriteHeader)
         return FALSE;
     }
 
+    // Reads spanning several sectors may be decrypted in parallel.
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszThreads && (nPerms & VSICRYPT_READ))
+    {
+        nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+        nThreads = std::max(1, std::min(128, nThreads));
+    }
+
     return TRUE;
 }
 
+/************************************************************************/
+/*                         VSICryptCreateMode()                         */
+/************************************************************************/
+
+// May throw a CryptoPP exception.
+static CryptoPP::SymmetricCipher *
+VSICryptCreateMode(VSICryptMode eMode, bool bEncrypt,
+                   CryptoPP::BlockCipher &oEncCipher,
+                   CryptoPP::BlockCipher &oDecCipher, const std::string &osIV)
+{
+    const cryptopp_byte *pabyIV =
+        reinterpret_cast<const cryptopp_byte *>(osIV.c_str());
+    if (bEncrypt)
+    {
+        if (eMode == MODE_CBC)
+            return new CryptoPP::CBC_Mode_ExternalCipher::Encryption(oEncCipher,
+                                                                     pabyIV);
+        else if (eMode == MODE_CFB)
+            return new CryptoPP::CFB_Mode_ExternalCipher::Encryption(oEncCipher,
+                                                                     pabyIV);
+        else if (eMode == MODE_OFB)
+            return new CryptoPP::OFB_Mode_ExternalCipher::Encryption(oEncCipher,
+                                                                     pabyIV);
+        else if (eMode == MODE_CTR)
+            return new CryptoPP::CTR_Mode_ExternalCipher::Encryption(oEncCipher,
+                                                                     pabyIV);
+        else
+            return new CryptoPP::CBC_CTS_Mode_ExternalCipher::Encryption(
+                oEncCipher, pabyIV);
+    }
+
+    // Yes, some modes need the encryption cipher.
+    if (eMode == MODE_CBC)
+        return new CryptoPP::CBC_Mode_ExternalCipher::Decryption(oDecCipher,
+                                                                 pabyIV);
+    else if (eMode == MODE_CFB)
+        return new CryptoPP::CFB_Mode_ExternalCipher::Decryption(oEncCipher,
+                                                                 pabyIV);
+    else if (eMode == MODE_OFB)
+        return new CryptoPP::OFB_Mode_ExternalCipher::Decryption(oEncCipher,
+                                                                 pabyIV);
+    else if (eMode == MODE_CTR)
+        return new CryptoPP::CTR_Mode_ExternalCipher::Decryption(oEncCipher,
+                                                                 pabyIV);
+    else
+        return new CryptoPP::CBC_CTS_Mode_ExternalCipher::Decryption(oDecCipher,
+                                                                     pabyIV);
+}
+
+/************************************************************************/
+/*                        VSICryptProcessSector()                       */
+/************************************************************************/
+
+// May throw a CryptoPP exception.
+static void VSICryptProcessSector(CryptoPP::SymmetricCipher &oMode,
+                                  VSICryptMode eMode, GByte *pabyData,
+                                  int nSectorSize)
+{
+    if (eMode == MODE_CBC_CTS)
+    {
+        // Ciphertext stealing handles the last two blocks specially, which
+        // the filter takes care of.
+        std::string osRes;
+        CryptoPP::StreamTransformationFilter oFilter(
+            oMode, new CryptoPP::StringSink(osRes),
+            CryptoPP::StreamTransformationFilter::NO_PADDING);
+        oFilter.Put(reinterpret_cast<const cryptopp_byte *>(pabyData),
+                    nSectorSize);
+        oFilter.MessageEnd();
+        CPLAssert(static_cast<int>(osRes.length()) == nSectorSize);
+        memcpy(pabyData, osRes.c_str(), osRes.length());
+    }
+    else
+    {
+        // The sector size is a multiple of the block size, so the other
+        // modes can work in place, without any intermediate copy. This
+        // also lets Crypto++ use its pipelined (AES-NI, ...) code paths on
+        // the whole sector.
+        oMode.ProcessData(reinterpret_cast<cryptopp_byte *>(pabyData),
+                          reinterpret_cast<const cryptopp_byte *>(pabyData),
+                          nSectorSize);
+    }
+}
+
+/************************************************************************/
+/*                        VSICryptCloneCipher()                         */
+/************************************************************************/
+
+// May throw a CryptoPP exception if the cipher is not clonable.
+static std::unique_ptr<CryptoPP::BlockCipher>
+VSICryptCloneCipher(const CryptoPP::BlockCipher &oCipher)
+{
+    std::unique_ptr<CryptoPP::Clonable> poClone(oCipher.Clone());
+    auto poCipher = dynamic_cast<CryptoPP::BlockCipher *>(poClone.get());
+    if (poCipher == nullptr)
+        return nullptr;
+    poClone.release();
+    return std::unique_ptr<CryptoPP::BlockCipher>(poCipher);
+}
+
 /************************************************************************/
 /*                          EncryptBlock()                              */
 /************************************************************************/
 
 void VSICryptFileHandle::EncryptBlock(GByte *pabyData, vsi_l_offset nOffset)
 {
-    std::string osRes;
     std::string osIV(VSICryptGenerateSectorIV(poHeader->osIV, nOffset));
     CPLAssert(static_cast<int>(osIV.size()) == nBlockSize);
 
-    CryptoPP::StreamTransformation *poMode;
     try
     {
-        if (poHeader->eMode == MODE_CBC)
-            poMode = new CryptoPP::CBC_Mode_ExternalCipher::Encryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else if (poHeader->eMode == MODE_CFB)
-            poMode = new CryptoPP::CFB_Mode_ExternalCipher::Encryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else if (poHeader->eMode == MODE_OFB)
-            poMode = new CryptoPP::OFB_Mode_ExternalCipher::Encryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else if (poHeader->eMode == MODE_CTR)
-            poMode = new CryptoPP::CTR_Mode_ExternalCipher::Encryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else
-            poMode = new CryptoPP::CBC_CTS_Mode_ExternalCipher::Encryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
+        std::unique_ptr<CryptoPP::SymmetricCipher> poMode(VSICryptCreateMode(
+            poHeader->eMode, true, *poEncCipher, *poDecCipher, osIV));
+        VSICryptProcessSector(*poMode, poHeader->eMode, pabyData,
+                              poHeader->nSectorSize);
     }
     catch (const std::exception &e)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "cryptopp exception: %s",
                  e.what());
-        return;
     }
-    CryptoPP::StringSink *poSink = new CryptoPP::StringSink(osRes);
-    CryptoPP::StreamTransformationFilter *poEnc =
-        new CryptoPP::StreamTransformationFilter(
-            *poMode, poSink, CryptoPP::StreamTransformationFilter::NO_PADDING);
-    poEnc->Put(pabyData, poHeader->nSectorSize);
-    poEnc->MessageEnd();
-    delete poEnc;
+}
 
-    delete poMode;
+/************************************************************************/
+/*                          DecryptSectors()                            */
+/************************************************************************/
 
-    CPLAssert(static_cast<int>(osRes.length()) == poHeader->nSectorSize);
-    memcpy(pabyData, osRes.c_str(), osRes.length());
+/** Decrypt in place nSectors consecutive sectors, the first one being at
+ * nOffset in the payload.
+ *
+ * Only reads immutable state of the handle, so it may be called from several
+ * threads at once, provided each one uses its own cipher objects.
+ */
+bool VSICryptFileHandle::DecryptSectors(GByte *pabyData, vsi_l_offset nOffset,
+                                        size_t nSectors,
+                                        CryptoPP::BlockCipher &oEncCipher,
+                                        CryptoPP::BlockCipher &oDecCipher,
+                                        std::string &osErrorMsg) const
+{
+    const int nSectorSize = poHeader->nSectorSize;
+    try
+    {
+        std::unique_ptr<CryptoPP::SymmetricCipher> poMode;
+        for (size_t i = 0; i < nSectors; ++i)
+        {
+            const std::string osIV(VSICryptGenerateSectorIV(
+                poHeader->osIV,
+                nOffset + static_cast<vsi_l_offset>(i) * nSectorSize));
+            CPLAssert(static_cast<int>(osIV.size()) == nBlockSize);
+            // Re-use the mode object from one sector to the next.
+            if (!poMode)
+                poMode.reset(VSICryptCreateMode(poHeader->eMode, false,
+                                                oEncCipher, oDecCipher, osIV));
+            else
+                poMode->Resynchronize(
+                    reinterpret_cast<const cryptopp_byte *>(osIV.c_str()),
+                    static_cast<int>(osIV.size()));
+            VSICryptProcessSector(*poMode, poHeader->eMode,
+                                  pabyData + i * nSectorSize, nSectorSize);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        osErrorMsg = e.what();
+        return false;
+    }
+    return true;
 }
 
 /************************************************************************/
@@ -946,57 +1124,160 @@ void VSICryptFileHandle::EncryptBlock(GByte *pabyData, vsi_l_offset nOffset)
 
 bool VSICryptFileHandle::DecryptBlock(GByte *pabyData, vsi_l_offset nOffset)
 {
-    std::string osRes;
-    std::string osIV(VSICryptGenerateSectorIV(poHeader->osIV, nOffset));
-    CPLAssert(static_cast<int>(osIV.size()) == nBlockSize);
-    CryptoPP::StringSink *poSink = new CryptoPP::StringSink(osRes);
-    CryptoPP::StreamTransformation *poMode = nullptr;
-    CryptoPP::StreamTransformationFilter *poDec = nullptr;
+    std::string osErrorMsg;
+    if (!DecryptSectors(pabyData, nOffset, 1, *poEncCipher, *poDecCipher,
+                        osErrorMsg))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "CryptoPP exception: %s",
+                 osErrorMsg.c_str());
+        return false;
+    }
+    return true;
+}
 
-    try
+/************************************************************************/
+/*                         DecryptSectorRuns()                          */
+/************************************************************************/
+
+/** Decrypt in place several runs of sectors, using the thread pool when
+ * GDAL_NUM_THREADS is set and there is enough data to make it worthwhile.
+ */
+bool VSICryptFileHandle::DecryptSectorRuns(const std::vector<SectorRun> &aoRuns)
+{
+    const size_t nSectorSize = static_cast<size_t>(poHeader->nSectorSize);
+    size_t nTotalSectors = 0;
+    for (const auto &oRun : aoRuns)
+        nTotalSectors += oRun.nSectors;
+
+    // Dispatching jobs has a cost, so give each at least 64 KB to decrypt.
+    constexpr size_t MIN_BYTES_PER_JOB = 64 * 1024;
+    const size_t nMinSectorsPerJob =
+        std::max<size_t>(1, MIN_BYTES_PER_JOB / nSectorSize);
+    const size_t nMaxJobs = std::min(static_cast<size_t>(nThreads),
+                                     nTotalSectors / nMinSectorsPerJob);
+
+    // Split the runs into batches of roughly the same number of sectors.
+    std::vector<std::vector<SectorRun>> aaoJobRuns;
+    if (nMaxJobs > 1)
     {
-        // Yes, some modes need the encryption cipher.
-        if (poHeader->eMode == MODE_CBC)
-            poMode = new CryptoPP::CBC_Mode_ExternalCipher::Decryption(
-                *poDecCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else if (poHeader->eMode == MODE_CFB)
-            poMode = new CryptoPP::CFB_Mode_ExternalCipher::Decryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else if (poHeader->eMode == MODE_OFB)
-            poMode = new CryptoPP::OFB_Mode_ExternalCipher::Decryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else if (poHeader->eMode == MODE_CTR)
-            poMode = new CryptoPP::CTR_Mode_ExternalCipher::Decryption(
-                *poEncCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        else
-            poMode = new CryptoPP::CBC_CTS_Mode_ExternalCipher::Decryption(
-                *poDecCipher,
-                reinterpret_cast<const cryptopp_byte *>(osIV.c_str()));
-        poDec = new CryptoPP::StreamTransformationFilter(
-            *poMode, poSink, CryptoPP::StreamTransformationFilter::NO_PADDING);
-        poDec->Put(reinterpret_cast<const cryptopp_byte *>(pabyData),
-                   poHeader->nSectorSize);
-        poDec->MessageEnd();
-        delete poDec;
-        delete poMode;
+        const size_t nSectorsPerJob = (nTotalSectors + nMaxJobs - 1) / nMaxJobs;
+        size_t nSectorsInJob = nSectorsPerJob;
+        for (const auto &oRun : aoRuns)
+        {
+            size_t iSector = 0;
+            while (iSector < oRun.nSectors)
+            {
+                if (nSectorsInJob == nSectorsPerJob)
+                {
+                    aaoJobRuns.emplace_back();
+                    nSectorsInJob = 0;
+                }
+                const size_t nCount = std::min(oRun.nSectors - iSector,
+                                               nSectorsPerJob - nSectorsInJob);
+                aaoJobRuns.back().push_back(
+                    SectorRun{oRun.pabyData + iSector * nSectorSize,
+                              oRun.nOffset +
+                                  static_cast<vsi_l_offset>(iSector) *
+                                      nSectorSize,
+                              nCount});
+                iSector += nCount;
+                nSectorsInJob += nCount;
+            }
+        }
     }
-    catch (const std::exception &e)
+
+    // Crypto++ cipher objects are not thread-safe, so each job works with
+    // its own copy of the key schedules.
+    std::vector<std::unique_ptr<CryptoPP::BlockCipher>> apoEncCiphers;
+    std::vector<std::unique_ptr<CryptoPP::BlockCipher>> apoDecCiphers;
+    if (aaoJobRuns.size() > 1)
+    {
+        try
+        {
+            for (size_t i = 0; i < aaoJobRuns.size(); ++i)
+            {
+                apoEncCiphers.push_back(VSICryptCloneCipher(*poEncCipher));
+                apoDecCiphers.push_back(VSICryptCloneCipher(*poDecCipher));
+                if (!apoEncCiphers.back() || !apoDecCiphers.back())
+                {
+                    aaoJobRuns.clear();
+                    break;
+                }
+            }
+        }
+        catch (const std::exception &e)
+        {
+            CPLDebug("VSICRYPT", "Cannot clone cipher: %s", e.what());
+            aaoJobRuns.clear();
+        }
+    }
+
+    if (aaoJobRuns.size() > 1 && !poJobQueue)
     {
-        delete poDec;
-        delete poMode;
+        CPLWorkerThreadPool *poPool =
+            cpl::down_cast<VSICryptFilesystemHandler *>(
+                VSIFileManager::GetHandler("/vsicrypt/"))
+                ->GetThreadPool(nThreads);
+        if (poPool)
+            poJobQueue = poPool->CreateJobQueue();
+        else
+            nThreads = 1;
+    }
 
-        CPLError(CE_Failure, CPLE_AppDefined, "CryptoPP exception: %s",
-                 e.what());
-        return false;
+    if (aaoJobRuns.size() <= 1 || !poJobQueue)
+    {
+        std::string osErrorMsg;
+        for (const auto &oRun : aoRuns)
+        {
+            if (!DecryptSectors(oRun.pabyData, oRun.nOffset, oRun.nSectors,
+                                *poEncCipher, *poDecCipher, osErrorMsg))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "CryptoPP exception: %s", osErrorMsg.c_str());
+                return false;
+            }
+        }
+        return true;
     }
 
-    CPLAssert(static_cast<int>(osRes.length()) == poHeader->nSectorSize);
-    memcpy(pabyData, osRes.c_str(), osRes.length());
+    std::atomic<bool> bOK{true};
+    std::vector<std::string> aosErrorMsg(aaoJobRuns.size());
+    for (size_t iJob = 0; iJob < aaoJobRuns.size(); ++iJob)
+    {
+        const auto job = [this, &aaoJobRuns, &apoEncCiphers, &apoDecCiphers,
+                          &aosErrorMsg, &bOK, iJob]()
+        {
+            for (const auto &oRun : aaoJobRuns[iJob])
+            {
+                if (!bOK)
+                    return;
+                if (!DecryptSectors(oRun.pabyData, oRun.nOffset,
+                                    oRun.nSectors, *apoEncCiphers[iJob],
+                                    *apoDecCiphers[iJob], aosErrorMsg[iJob]))
+                {
+                    bOK = false;
+                    return;
+                }
+            }
+        };
+        if (!poJobQueue->SubmitJob(job))
+            job();
+    }
+    poJobQueue->WaitCompletion();
 
+    if (!bOK)
+    {
+        for (const auto &osErrorMsg : aosErrorMsg)
+        {
+            if (!osErrorMsg.empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "CryptoPP exception: %s", osErrorMsg.c_str());
+                break;
+            }
+        }
+        return false;
+    }
     return true;
 }
 
@@ -1108,6 +1389,39 @@ size_t VSICryptFileHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
             CPLAssert((nCurPos % poHeader->nSectorSize) == 0);
         }
 
+        // When the request covers several whole sectors, read them with a
+        // single request to the underlying file, and decrypt them directly
+        // into the user buffer, possibly in parallel.
+        const size_t nSectorSize = static_cast<size_t>(poHeader->nSectorSize);
+        if ((nCurPos % nSectorSize) == 0 && nToRead >= 2 * nSectorSize &&
+            nCurPos < poHeader->nPayloadFileSize)
+        {
+            const size_t nSectors = static_cast<size_t>(
+                std::min(static_cast<vsi_l_offset>(nToRead / nSectorSize),
+                         (poHeader->nPayloadFileSize - nCurPos) / nSectorSize));
+            if (nSectors >= 2)
+            {
+                poBaseHandle->Seek(poHeader->nHeaderSize + nCurPos, SEEK_SET);
+                // On a short read, fall back to reading sector by sector
+                // below, so that the sectors that could be read are returned.
+                if (poBaseHandle->Read(pabyBuffer, nSectorSize, nSectors) ==
+                    nSectors)
+                {
+                    const std::vector<SectorRun> aoRuns{
+                        SectorRun{pabyBuffer, nCurPos, nSectors}};
+                    if (!DecryptSectorRuns(aoRuns))
+                    {
+                        bError = true;
+                        break;
+                    }
+                    pabyBuffer += nSectors * nSectorSize;
+                    nToRead -= nSectors * nSectorSize;
+                    nCurPos += nSectors * nSectorSize;
+                    continue;
+                }
+            }
+        }
+
         vsi_l_offset nSectorOffset =
             (nCurPos / poHeader->nSectorSize) * poHeader->nSectorSize;
         poBaseHandle->Seek(poHeader->nHeaderSize + nSectorOffset, SEEK_SET);
@@ -1144,6 +1458,94 @@ size_t VSICryptFileHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
     return nRet;
 }
 
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSICryptFileHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    if ((nPerms & VSICRYPT_READ) == 0)
+    {
+        bError = true;
+        return -1;
+    }
+
+    if (!FlushDirty())
+        return -1;
+
+    // Extend each range to the sectors that contain it, so that they can all
+    // be fetched with a single call to the underlying file (which for network
+    // file systems means parallel requests).
+    const vsi_l_offset nSectorSize = poHeader->nSectorSize;
+    std::vector<vsi_l_offset> anBaseOffsets(nRanges);
+    std::vector<size_t> anBaseSizes(nRanges);
+    size_t nTotalSize = 0;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] > poHeader->nPayloadFileSize ||
+            panOffsets[i] > poHeader->nPayloadFileSize - panSizes[i])
+        {
+            // Let the generic implementation deal with the end of file.
+            return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                    panSizes);
+        }
+        const vsi_l_offset nStart = (panOffsets[i] / nSectorSize) * nSectorSize;
+        const vsi_l_offset nEnd =
+            (panOffsets[i] + panSizes[i] + nSectorSize - 1) / nSectorSize *
+            nSectorSize;
+        if (nEnd - nStart > std::numeric_limits<size_t>::max() - nTotalSize)
+        {
+            return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                    panSizes);
+        }
+        anBaseOffsets[i] = poHeader->nHeaderSize + nStart;
+        anBaseSizes[i] = static_cast<size_t>(nEnd - nStart);
+        nTotalSize += anBaseSizes[i];
+    }
+
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyBaseData(static_cast<GByte *>(
+        VSI_MALLOC_VERBOSE(std::max<size_t>(1, nTotalSize))));
+    if (!pabyBaseData)
+        return -1;
+
+    std::vector<void *> apBaseData(nRanges);
+    std::vector<SectorRun> aoRuns;
+    GByte *pabyIter = pabyBaseData.get();
+    for (int i = 0; i < nRanges; ++i)
+    {
+        apBaseData[i] = pabyIter;
+        if (anBaseSizes[i] > 0)
+        {
+            aoRuns.push_back(SectorRun{
+                pabyIter, anBaseOffsets[i] - poHeader->nHeaderSize,
+                anBaseSizes[i] / static_cast<size_t>(nSectorSize)});
+        }
+        pabyIter += anBaseSizes[i];
+    }
+
+    if (poBaseHandle->ReadMultiRange(nRanges, apBaseData.data(),
+                                     anBaseOffsets.data(),
+                                     anBaseSizes.data()) != 0 ||
+        !DecryptSectorRuns(aoRuns))
+    {
+        return -1;
+    }
+
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] == 0)
+            continue;
+        const vsi_l_offset nStart = anBaseOffsets[i] - poHeader->nHeaderSize;
+        memcpy(ppData[i],
+               static_cast<GByte *>(apBaseData[i]) + (panOffsets[i] - nStart),
+               panSizes[i]);
+    }
+
+    return 0;
+}
+
 /************************************************************************/
 /*                                Write()                               */
 /************************************************************************/
@@ -1456,40 +1858,35 @@ int VSICryptFileHandle::Close()
 }
 
 /************************************************************************/
-/*                   VSICryptFilesystemHandler                          */
+/*                   VSICryptFilesystemHandler()                        */
 /************************************************************************/
 
-class VSICryptFilesystemHandler final : public VSIFilesystemHandler
+VSICryptFilesystemHandler::VSICryptFilesystemHandler()
 {
-  public:
-    VSICryptFilesystemHandler();
-    ~VSICryptFilesystemHandler() override;
-
-    VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
-                           bool bSetError,
-                           CSLConstList /* papszOptions */) override;
-    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
-             int nFlags) override;
-    int Unlink(const char *pszFilename) override;
-    int Rename(const char *oldpath, const char *newpath, GDALProgressFunc,
-               void *) override;
-    char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
-};
+}
 
 /************************************************************************/
-/*                   VSICryptFilesystemHandler()                        */
+/*                    ~VSICryptFilesystemHandler()                      */
 /************************************************************************/
 
-VSICryptFilesystemHandler::VSICryptFilesystemHandler()
+VSICryptFilesystemHandler::~VSICryptFilesystemHandler()
 {
 }
 
 /************************************************************************/
-/*                    ~VSICryptFilesystemHandler()                      */
+/*                           GetThreadPool()                            */
 /************************************************************************/
 
-VSICryptFilesystemHandler::~VSICryptFilesystemHandler()
+/** Return the worker thread pool shared by all /vsicrypt/ handles, making
+ * sure it has at least nThreads threads. */
+CPLWorkerThreadPool *VSICryptFilesystemHandler::GetThreadPool(int nThreads)
 {
+    std::lock_guard<std::mutex> oLock(m_oMutexPool);
+    if (!m_poPool)
+        m_poPool = std::make_unique<CPLWorkerThreadPool>();
+    if (!m_poPool->Setup(nThreads, nullptr, nullptr, false))
+        return nullptr;
+    return m_poPool.get();
 }
 
 /************************************************************************/
@@ -1873,6 +2270,15 @@ char **VSICryptFilesystemHandler::ReadDirEx(const char *pszDirname,
     return VSIReadDirEx(GetFilename(pszDirname), nMaxFiles);
 }
 
+/************************************************************************/
+/*                     HasOptimizedReadMultiRange()                     */
+/************************************************************************/
+
+int VSICryptFilesystemHandler::HasOptimizedReadMultiRange(const char *pszPath)
+{
+    return VSIHasOptimizedReadMultiRange(GetFilename(pszPath));
+}
+
 #ifdef VSICRYPT_DRIVER
 
 #include "gdal_priv.h"
@@ -2005,6 +2411,12 @@ static GDALDataset *VSICryptOpen(GDALOpenInfo *poOpenInfo)
  * handlers, such as /vsizip. For example,
  * /vsicrypt//vsicurl/path/to/remote/encrypted/file.tif
  *
+ * Starting with GDAL 3.12, reads covering several sectors are issued as a
+ * single request to the underlying file, and the sectors are decrypted in
+ * parallel when the GDAL_NUM_THREADS configuration option is set to a value
+ * greater than 1 (or ALL_CPUS). VSIFReadMultiRangeL() is also forwarded to the
+ * underlying file, which lets network file systems fetch all ranges at once.
+ *
  * Implementation details:
  *
  * The structure of encrypted files is the following: a header, immediately
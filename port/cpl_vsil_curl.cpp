@@ -99,6 +99,15 @@ int VSICurlUninstallReadCbk(VSILFILE * /* fp */)
     return FALSE;
 }
 
+/************************************************************************/
+/*                        VSICurlGetCachedETag()                        */
+/************************************************************************/
+
+std::string VSICurlGetCachedETag(const char * /* pszFilename */)
+{
+    return std::string();
+}
+
 #else
 
 //! @cond Doxygen_Suppress
@@ -518,6 +527,11 @@ VSICurlHandle::~VSICurlHandle()
     {
         curl_multi_cleanup(m_hCurlMultiHandleForAdviseRead);
     }
+    StopReadAhead();
+    if (m_hCurlMultiHandleForReadAhead)
+    {
+        curl_multi_cleanup(m_hCurlMultiHandleForReadAhead);
+    }
 
     if (!m_bCached)
     {
@@ -2352,9 +2366,11 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
         {
             osRegion = *psRegion;
         }
-        else
+        else if (!GetRegionFromReadAhead(nOffsetToDownload, osRegion))
         {
-            if (nOffsetToDownload == lastDownloadedOffset)
+            const bool bSequentialRead =
+                nOffsetToDownload == lastDownloadedOffset;
+            if (bSequentialRead)
             {
                 // In case of consecutive reads (of small size), we use a
                 // heuristic that we will read the file sequentially, so
@@ -2403,12 +2419,22 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             if (nBlocksToDownload > knMAX_REGIONS)
                 nBlocksToDownload = knMAX_REGIONS;
 
-            osRegion = DownloadRegion(nOffsetToDownload, nBlocksToDownload);
-            if (osRegion.empty())
+            // After a few consecutive sequential reads, try to switch to
+            // read-ahead mode with concurrent range requests.
+            constexpr int READ_AHEAD_MIN_BLOCKS = 4;
+            if (!(bSequentialRead &&
+                  nBlocksToDownload >= READ_AHEAD_MIN_BLOCKS &&
+                  StartReadAhead(nOffsetToDownload) &&
+                  GetRegionFromReadAhead(nOffsetToDownload, osRegion)))
             {
-                if (!bInterrupted)
-                    bError = true;
-                return 0;
+                osRegion =
+                    DownloadRegion(nOffsetToDownload, nBlocksToDownload);
+                if (osRegion.empty())
+                {
+                    if (!bInterrupted)
+                        bError = true;
+                    return 0;
+                }
             }
         }
 
@@ -3636,6 +3662,409 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
     m_oThreadAdviseRead = std::thread(task, l_osURL);
 }
 
+/************************************************************************/
+/*                          StartReadAhead()                            */
+/************************************************************************/
+
+bool VSICurlHandle::StartReadAhead(vsi_l_offset nStartOffset)
+{
+    if (m_bReadAheadDisabled || pfnReadCbk != nullptr)
+        return false;
+
+    const int nStreams =
+        atoi(CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD_STREAMS", "0"));
+    if (nStreams <= 0)
+        return false;
+
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (!oFileProp.bHasComputedFileSize || nStartOffset >= oFileProp.fileSize)
+        return false;
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    GIntBig nChunkSize = 4 * 1024 * 1024;
+    if (CPLParseMemorySize(
+            CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE", "4MB"),
+            &nChunkSize, nullptr) != CE_None ||
+        nChunkSize <= 0 || nChunkSize > INT_MAX)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value for CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE. "
+                 "Read-ahead disabled");
+        m_bReadAheadDisabled = true;
+        return false;
+    }
+    // Make the chunk size a multiple of the download chunk size, so that
+    // regions never straddle two read-ahead chunks.
+    nChunkSize = std::max<GIntBig>(1, nChunkSize / knDOWNLOAD_CHUNK_SIZE) *
+                 knDOWNLOAD_CHUNK_SIZE;
+
+    UpdateQueryString();
+
+    bool bHasExpired = false;
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    const std::string osURL(GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    if (bHasExpired)
+        return false;
+
+    if (!m_hCurlMultiHandleForReadAhead)
+        m_hCurlMultiHandleForReadAhead = VSICURLMultiInit();
+
+    CPLDebug(poFS->GetDebugKey(),
+             "Starting read-ahead at offset " CPL_FRMT_GUIB
+             " with %d streams of " CPL_FRMT_GIB " bytes",
+             nStartOffset, nStreams, nChunkSize);
+
+    CPLAssert(m_aoReadAheadChunks.empty());
+    m_bStopReadAhead = false;
+    m_nReadAheadNextOffset = nStartOffset;
+    m_nReadAheadEndOffset = oFileProp.fileSize;
+    m_nReadAheadChunkSize = static_cast<size_t>(nChunkSize);
+    m_nReadAheadStreams = static_cast<size_t>(nStreams);
+    QueueReadAheadChunks();
+    m_oThreadReadAhead = std::thread(&VSICurlHandle::ReadAheadThread, this,
+                                     osURL, aosHTTPOptions);
+    return true;
+}
+
+/************************************************************************/
+/*                        QueueReadAheadChunks()                        */
+/************************************************************************/
+
+// Must be called with m_oMutexReadAhead held, or before the read-ahead
+// thread is started.
+// The first chunk of m_aoReadAheadChunks is the one currently read, so up
+// to m_nReadAheadStreams chunks are downloaded in advance of it.
+
+void VSICurlHandle::QueueReadAheadChunks()
+{
+    while (m_aoReadAheadChunks.size() <= m_nReadAheadStreams &&
+           m_nReadAheadNextOffset < m_nReadAheadEndOffset)
+    {
+        auto poChunk = std::make_shared<ReadAheadChunk>();
+        poChunk->nStartOffset = m_nReadAheadNextOffset;
+        poChunk->nSize = static_cast<size_t>(
+            std::min(static_cast<vsi_l_offset>(m_nReadAheadChunkSize),
+                     m_nReadAheadEndOffset - m_nReadAheadNextOffset));
+        m_nReadAheadNextOffset += poChunk->nSize;
+        m_aoReadAheadChunks.push_back(poChunk);
+        m_apoReadAheadPending.push_back(std::move(poChunk));
+    }
+}
+
+/************************************************************************/
+/*                           StopReadAhead()                            */
+/************************************************************************/
+
+void VSICurlHandle::StopReadAhead()
+{
+    if (!m_oThreadReadAhead.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+        m_bStopReadAhead = true;
+        m_oCVReadAhead.notify_all();
+    }
+    curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+    m_oThreadReadAhead.join();
+    m_aoReadAheadChunks.clear();
+    m_apoReadAheadPending.clear();
+}
+
+/************************************************************************/
+/*                          ReadAheadThread()                           */
+/************************************************************************/
+
+// Issues the range requests of the chunks queued by QueueReadAheadChunks()
+// on a dedicated curl multi handle. Chunks are delivered in order through
+// m_aoReadAheadChunks, which the reader trims as it progresses, so
+// at most (m_nReadAheadStreams + 1) chunks are held in memory.
+
+void VSICurlHandle::ReadAheadThread(const std::string &osURL,
+                                    const CPLStringList &aosHTTPOptions)
+{
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsAction oContextAction("Read");
+
+    CURLM *hMultiHandle = m_hCurlMultiHandleForReadAhead;
+
+#ifdef CURLPIPE_MULTIPLEX
+    // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
+    // used)
+    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+    {
+        curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
+                          CURLPIPE_MULTIPLEX);
+    }
+#endif
+
+    struct Request
+    {
+        std::shared_ptr<ReadAheadChunk> poChunk{};
+        WriteFuncStruct sWriteFuncData{};
+        WriteFuncStruct sWriteFuncHeaderData{};
+        struct curl_slist *psHeaders = nullptr;
+        std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf{};
+    };
+
+    std::map<CURL *, std::unique_ptr<Request>> oMapRequests;
+    size_t nTotalDownloaded = 0;
+
+    const auto FinishRequest =
+        [this, hMultiHandle, &nTotalDownloaded](CURL *hCurlHandle,
+                                                Request &oRequest, bool bOK)
+    {
+        auto &poChunk = oRequest.poChunk;
+        if (bOK)
+        {
+            long response_code = 0;
+            curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+            bOK = (response_code == 206 || response_code == 225 ||
+                   (!oRequest.sWriteFuncHeaderData.bIsHTTP &&
+                    response_code == 0)) &&
+                  oRequest.sWriteFuncData.nSize == poChunk->nSize;
+            if (!bOK)
+            {
+                CPLDebug(poFS->GetDebugKey(),
+                         "Read-ahead of " CPL_FRMT_GUIB "-" CPL_FRMT_GUIB
+                         " failed with response_code=%ld, msg=%s",
+                         oRequest.sWriteFuncHeaderData.nStartOffset,
+                         oRequest.sWriteFuncHeaderData.nEndOffset,
+                         response_code, oRequest.szCurlErrBuf.data());
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+            if (bOK)
+            {
+                poChunk->osData.assign(oRequest.sWriteFuncData.pBuffer,
+                                       oRequest.sWriteFuncData.nSize);
+                nTotalDownloaded += oRequest.sWriteFuncData.nSize;
+            }
+            poChunk->bOK = bOK;
+            poChunk->bDone = true;
+            m_oCVReadAhead.notify_all();
+        }
+
+        curl_multi_remove_handle(hMultiHandle, hCurlHandle);
+        VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
+        curl_easy_cleanup(hCurlHandle);
+        CPLFree(oRequest.sWriteFuncData.pBuffer);
+        CPLFree(oRequest.sWriteFuncHeaderData.pBuffer);
+        curl_slist_free_all(oRequest.psHeaders);
+    };
+
+    void *old_handler = CPLHTTPIgnoreSigPipe();
+    while (true)
+    {
+        std::vector<std::shared_ptr<ReadAheadChunk>> apoNewChunks;
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutexReadAhead);
+            if (oMapRequests.empty())
+            {
+                m_oCVReadAhead.wait(
+                    oLock,
+                    [this]()
+                    {
+                        return m_bStopReadAhead ||
+                               !m_apoReadAheadPending.empty();
+                    });
+            }
+            if (m_bStopReadAhead)
+                break;
+            std::swap(apoNewChunks, m_apoReadAheadPending);
+        }
+
+        for (auto &poChunk : apoNewChunks)
+        {
+            CURL *hCurlHandle = curl_easy_init();
+            auto poRequest = std::make_unique<Request>();
+            poRequest->poChunk = poChunk;
+
+            struct curl_slist *headers = VSICurlSetOptions(
+                hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
+
+            VSICURLInitWriteFuncStruct(&poRequest->sWriteFuncData, nullptr,
+                                       nullptr, nullptr);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                                       &poRequest->sWriteFuncData);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                                       VSICurlHandleWriteFunc);
+
+            auto &sHeaderData = poRequest->sWriteFuncHeaderData;
+            VSICURLInitWriteFuncStruct(&sHeaderData, nullptr, nullptr,
+                                       nullptr);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                                       &sHeaderData);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                                       VSICurlHandleWriteFunc);
+            sHeaderData.bIsHTTP = STARTS_WITH(osURL.c_str(), "http");
+            sHeaderData.nStartOffset = poChunk->nStartOffset;
+            sHeaderData.nEndOffset =
+                poChunk->nStartOffset + poChunk->nSize - 1;
+
+            char rangeStr[512] = {};
+            snprintf(rangeStr, sizeof(rangeStr),
+                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB, sHeaderData.nStartOffset,
+                     sHeaderData.nEndOffset);
+
+            if (ENABLE_DEBUG)
+                CPLDebug(poFS->GetDebugKey(), "Read-ahead of %s (%s)...",
+                         rangeStr, osURL.c_str());
+
+            if (sHeaderData.bIsHTTP)
+            {
+                // So it gets included in Azure signature
+                headers = curl_slist_append(
+                    headers, CPLSPrintf("Range: bytes=%s", rangeStr));
+                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
+            }
+            else
+            {
+                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE,
+                                           rangeStr);
+            }
+
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
+                                       poRequest->szCurlErrBuf.data());
+
+            headers =
+                VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER,
+                                       headers);
+            poRequest->psHeaders = headers;
+
+            curl_multi_add_handle(hMultiHandle, hCurlHandle);
+            oMapRequests[hCurlHandle] = std::move(poRequest);
+        }
+
+        int still_running = 0;
+        while (curl_multi_perform(hMultiHandle, &still_running) ==
+               CURLM_CALL_MULTI_PERFORM)
+        {
+            // loop
+        }
+
+        CURLMsg *msg;
+        do
+        {
+            int msgq = 0;
+            msg = curl_multi_info_read(hMultiHandle, &msgq);
+            if (msg && (msg->msg == CURLMSG_DONE))
+            {
+                CURL *hCurlHandle = msg->easy_handle;
+                auto oIter = oMapRequests.find(hCurlHandle);
+                if (oIter != oMapRequests.end())
+                {
+                    FinishRequest(hCurlHandle, *(oIter->second), true);
+                    oMapRequests.erase(oIter);
+                }
+            }
+        } while (msg);
+
+        if (!oMapRequests.empty())
+        {
+            // Interrupted by curl_multi_wakeup() when the reader has
+            // consumed a chunk
+            int repeats = 0;
+            CPLMultiPerformWait(hMultiHandle, repeats);
+        }
+    }
+    CPLHTTPRestoreSigPipeHandler(old_handler);
+
+    // Cancel requests still in progress
+    for (auto &oIter : oMapRequests)
+    {
+        FinishRequest(oIter.first, *(oIter.second), false);
+    }
+
+    NetworkStatisticsLogger::LogGET(nTotalDownloaded);
+}
+
+/************************************************************************/
+/*                       GetRegionFromReadAhead()                       */
+/************************************************************************/
+
+bool VSICurlHandle::GetRegionFromReadAhead(vsi_l_offset nOffset,
+                                           std::string &osRegion)
+{
+    if (!m_oThreadReadAhead.joinable())
+        return false;
+
+    std::shared_ptr<ReadAheadChunk> poChunk;
+    bool bOK = false;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutexReadAhead);
+
+        // Forget chunks located before the requested offset, which lets
+        // the read-ahead thread issue new requests.
+        bool bHasRemovedChunks = false;
+        while (!m_aoReadAheadChunks.empty() &&
+               m_aoReadAheadChunks.front()->nStartOffset +
+                       m_aoReadAheadChunks.front()->nSize <=
+                   nOffset)
+        {
+            m_aoReadAheadChunks.pop_front();
+            bHasRemovedChunks = true;
+        }
+        if (m_aoReadAheadChunks.empty() &&
+            nOffset >= m_nReadAheadNextOffset &&
+            nOffset < m_nReadAheadEndOffset)
+        {
+            // Forward seek beyond the read-ahead window: forget the requests
+            // not issued yet, and restart the window at the requested offset.
+            m_apoReadAheadPending.clear();
+            m_nReadAheadNextOffset = nOffset;
+            bHasRemovedChunks = true;
+        }
+        if (bHasRemovedChunks)
+        {
+            QueueReadAheadChunks();
+            m_oCVReadAhead.notify_all();
+            curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+        }
+
+        if (!m_aoReadAheadChunks.empty() &&
+            nOffset >= m_aoReadAheadChunks.front()->nStartOffset &&
+            nOffset < m_aoReadAheadChunks.front()->nStartOffset +
+                          m_aoReadAheadChunks.front()->nSize)
+        {
+            poChunk = m_aoReadAheadChunks.front();
+            m_oCVReadAhead.wait(oLock, [&poChunk]() { return poChunk->bDone; });
+            bOK = poChunk->bOK;
+        }
+    }
+
+    if (!bOK)
+    {
+        if (poChunk)
+        {
+            // Let regular downloads deal with errors and retries
+            CPLDebug(poFS->GetDebugKey(),
+                     "Read-ahead failed. Disabling it for %s",
+                     m_osFilename.c_str());
+            m_bReadAheadDisabled = true;
+        }
+        else
+        {
+            CPLDebug(poFS->GetDebugKey(),
+                     "Stopping read-ahead due to non-sequential read");
+        }
+        StopReadAhead();
+        return false;
+    }
+
+    const size_t nDownloadChunkSize =
+        static_cast<size_t>(VSICURLGetDownloadChunkSize());
+    const size_t nPos = static_cast<size_t>(nOffset - poChunk->nStartOffset);
+    osRegion.assign(poChunk->osData, nPos,
+                    std::min(nDownloadChunkSize, poChunk->nSize - nPos));
+    poFS->AddRegion(m_pszURL, nOffset, osRegion.size(), osRegion.data());
+    lastDownloadedOffset = nOffset + nDownloadChunkSize;
+    return true;
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -3857,17 +4286,37 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
     std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out))
+        {
+            return out;
+        }
+    }
+
+    std::string osKey;
+    vsi_l_offset nFileSize = 0;
+    if (GetDiskCacheKey(pszURL, osKey, nFileSize))
+    {
+        auto value = std::make_shared<std::string>();
+        if (VSICurlDiskCacheRead(osKey, nFileSize, knDOWNLOAD_CHUNK_SIZE,
+                                 nFileOffsetStart, *value))
+        {
+            NetworkStatisticsLogger::LogDiskCacheHit(value->size());
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                value);
+            return value;
+        }
+        NetworkStatisticsLogger::LogDiskCacheMiss();
     }
 
     return nullptr;
@@ -3881,12 +4330,56 @@ void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
                                              size_t nSize, const char *pData)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> value(new std::string());
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    }
 
-    std::shared_ptr<std::string> value(new std::string());
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    std::string osKey;
+    vsi_l_offset nFileSize = 0;
+    if (GetDiskCacheKey(pszURL, osKey, nFileSize))
+    {
+        VSICurlDiskCacheWrite(osKey, nFileSize, VSICURLGetDownloadChunkSize(),
+                              nFileOffsetStart, pData, nSize);
+    }
+}
+
+/************************************************************************/
+/*                          GetDiskCacheKey()                           */
+/************************************************************************/
+
+// Return the key of the file in the persistent disk cache of byte ranges,
+// if it is enabled, and if the file has a known size and a validator
+// (ETag or modification time), so that a changed remote file does not
+// match stale cached ranges.
+
+bool VSICurlFilesystemHandlerBase::GetDiskCacheKey(const char *pszURL,
+                                                   std::string &osKey,
+                                                   vsi_l_offset &nFileSize)
+{
+    if (!VSICurlDiskCacheIsEnabled())
+        return false;
+    FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize ||
+        oFileProp.fileSize == 0 ||
+        (oFileProp.ETag.empty() && oFileProp.mTime == 0))
+    {
+        return false;
+    }
+    nFileSize = oFileProp.fileSize;
+    osKey = pszURL;
+    osKey += '\n';
+    osKey += oFileProp.ETag;
+    osKey += '\n';
+    osKey += CPLSPrintf(CPL_FRMT_GUIB "\n" CPL_FRMT_GIB,
+                        static_cast<GUIntBig>(oFileProp.fileSize),
+                        static_cast<GIntBig>(oFileProp.mTime));
+    return true;
 }
 
 /************************************************************************/
@@ -4181,6 +4674,17 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT' "            \
     "type='integer' description='Maximum number of bytes AdviseRead() is "     \
     "allowed to fetch at once' default='104857600'/>"                          \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD_STREAMS' type='integer' "        \
+    "description='Number of chunks downloaded concurrently in advance "        \
+    "during sequential reads. 0 to disable' default='0'/>"                     \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE' type='integer' "     \
+    "description='Size in bytes of each read-ahead chunk' "                    \
+    "default='4194304'/>"                                                      \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_DIR' type='string' "             \
+    "description='Directory of the persistent disk cache of byte ranges'/>"    \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_MAX_SIZE' type='integer' "       \
+    "description='Maximum size in bytes of the persistent disk cache' "        \
+    "default='1073741824'/>"                                                   \
     "  <Option name='GDAL_HTTP_MAX_CACHED_CONNECTIONS' type='integer' "        \
     "description='Maximum amount of connections that libcurl may keep alive "  \
     "in its connection cache after use'/>"                                     \
@@ -5927,6 +6431,29 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogDiskCacheHit(size_t nBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nDiskCacheHits++;
+        counters->nDiskCacheHitBytes += nBytes;
+    }
+}
+
+void NetworkStatisticsLogger::LogDiskCacheMiss()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nDiskCacheMisses++;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5956,6 +6483,14 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.nDiskCacheHits || counters.nDiskCacheMisses)
+    {
+        CPLJSONObject oDiskCache;
+        oDiskCache.Add("hits/count", counters.nDiskCacheHits);
+        oDiskCache.Add("hits/bytes", counters.nDiskCacheHitBytes);
+        oDiskCache.Add("misses/count", counters.nDiskCacheMisses);
+        oJSON.Add("disk_cache", oDiskCache);
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
@@ -6361,6 +6896,34 @@ void VSICurlPartialClearCache(const char *pszFilenamePrefix)
         poFSHandler->PartialClearCache(pszFilenamePrefix);
 }
 
+/************************************************************************/
+/*                        VSICurlGetCachedETag()                        */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Return the ETag of a file of /vsicurl/ or of a related file system, as
+ * received by a previous VSIStatL() or opening of the file, or an empty
+ * string if it is not known. No network request is issued.
+ */
+std::string VSICurlGetCachedETag(const char *pszFilename)
+{
+    auto poFSHandler = dynamic_cast<cpl::VSICurlFilesystemHandlerBase *>(
+        VSIFileManager::GetHandler(pszFilename));
+    if (poFSHandler == nullptr)
+        return std::string();
+    const std::string osURL = poFSHandler->GetURLFromFilename(pszFilename);
+    cpl::FileProp oFileProp;
+    if (osURL.empty() ||
+        !poFSHandler->GetCachedFileProp(osURL.c_str(), oFileProp) ||
+        oFileProp.eExists != cpl::EXIST_YES)
+    {
+        return std::string();
+    }
+    return oFileProp.ETag;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                        VSINetworkStatsReset()                        */
 /************************************************************************/
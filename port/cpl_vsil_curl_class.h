@@ -22,12 +22,14 @@
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_mem_cache.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <set>
 #include <map>
 #include <memory>
@@ -293,6 +295,9 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     std::shared_ptr<std::string> GetRegion(const char *pszURL,
                                            vsi_l_offset nFileOffsetStart);
 
+    static bool GetDiskCacheKey(const char *pszURL, std::string &osKey,
+                                vsi_l_offset &nFileSize);
+
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
                    size_t nSize, const char *pData);
 
@@ -428,6 +433,39 @@ class VSICurlHandle : public VSIVirtualHandle
     std::thread m_oThreadAdviseRead{};
     CURLM *m_hCurlMultiHandleForAdviseRead = nullptr;
 
+    // Used by sequential read-ahead (CPL_VSIL_CURL_READ_AHEAD_STREAMS)
+    struct ReadAheadChunk
+    {
+        vsi_l_offset nStartOffset = 0;
+        size_t nSize = 0;
+        bool bDone = false;
+        bool bOK = false;
+        std::string osData{};
+    };
+
+    std::mutex m_oMutexReadAhead{};
+    std::condition_variable m_oCVReadAhead{};
+    // Chunks in increasing offset order, the first one being the one
+    // currently read. Bounded to the number of read-ahead streams.
+    std::deque<std::shared_ptr<ReadAheadChunk>> m_aoReadAheadChunks{};
+    // Chunks queued, but not yet requested by the read-ahead thread
+    std::vector<std::shared_ptr<ReadAheadChunk>> m_apoReadAheadPending{};
+    vsi_l_offset m_nReadAheadNextOffset = 0;
+    vsi_l_offset m_nReadAheadEndOffset = 0;
+    size_t m_nReadAheadChunkSize = 0;
+    size_t m_nReadAheadStreams = 0;
+    bool m_bStopReadAhead = false;
+    bool m_bReadAheadDisabled = false;
+    std::thread m_oThreadReadAhead{};
+    CURLM *m_hCurlMultiHandleForReadAhead = nullptr;
+
+    bool StartReadAhead(vsi_l_offset nStartOffset);
+    void StopReadAhead();
+    void QueueReadAheadChunks();
+    void ReadAheadThread(const std::string &osURL,
+                         const CPLStringList &aosHTTPOptions);
+    bool GetRegionFromReadAhead(vsi_l_offset nOffset, std::string &osRegion);
+
   protected:
     virtual struct curl_slist *
     GetCurlHeaders(const std::string & /*osVerb*/,
@@ -584,6 +622,8 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandler)
 
+    friend class VSIMultipartWriteHandle;
+
     virtual int MkdirInternal(const char *pszDirname, long nMode,
                               bool bDoStatCheck);
 
@@ -827,7 +867,18 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
 
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Asynchronous upload of parts, when more than one part may be in flight
+    int m_nMaxInFlightParts = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+    std::mutex m_oMutexAsync{};
+    std::atomic<bool> m_bAsyncError{false};
+    std::vector<GByte *> m_apabyFreeBuffers{};
+    std::vector<std::unique_ptr<IVSIS3LikeHandleHelper>>
+        m_apoFreeHandleHelpers{};
+
     bool UploadPart();
+    bool UploadPartAsync();
+    bool WaitForPendingParts();
     bool DoSinglePartPUT();
 
     void InvalidateParentDirectory();
@@ -1094,6 +1145,9 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nDiskCacheHits = 0;
+        GIntBig nDiskCacheHitBytes = 0;
+        GIntBig nDiskCacheMisses = 0;
     };
 
     enum class ContextPathType
@@ -1173,6 +1227,10 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogDiskCacheHit(size_t nBytes);
+
+    static void LogDiskCacheMiss();
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
@@ -1217,6 +1275,15 @@ struct NetworkStatisticsAction
     }
 };
 
+// Persistent disk cache of byte ranges (cpl_vsil_curl_disk_cache.cpp)
+bool VSICurlDiskCacheIsEnabled();
+bool VSICurlDiskCacheRead(const std::string &osKey, vsi_l_offset nFileSize,
+                          int nChunkSize, vsi_l_offset nOffset,
+                          std::string &osData);
+void VSICurlDiskCacheWrite(const std::string &osKey, vsi_l_offset nFileSize,
+                           int nChunkSize, vsi_l_offset nOffset,
+                           const char *pData, size_t nSize);
+
 }  // namespace cpl
 
 int VSICURLGetDownloadChunkSize();
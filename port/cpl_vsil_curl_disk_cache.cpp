@@ -0,0 +1,372 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of byte ranges of /vsicurl/ files
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+// Each remote file (identified by its URL, ETag, size and modification
+// time) is cached in a single local sparse file, named from the MD5 of that
+// key, in <cache_dir>/<2 first hex digits of MD5>/<MD5>.cache.
+// The layout of such a file is:
+// - 8 bytes: "GDALVCC1" signature
+// - uint32 (LSB): chunk size
+// - uint64 (LSB): size of the remote file
+// - uint32 (LSB): size of the key
+// - the key itself, to detect (unlikely) MD5 collisions
+// - one byte per chunk of the remote file, set to 1 once the chunk is
+//   available
+// - padding up to a multiple of DATA_ALIGNMENT
+// - the chunks, at their offset in the remote file. Chunks not yet fetched
+//   are holes of the sparse file.
+//
+// The file is created with its presence array zeroed in a temporary file
+// which is renamed on completion. A chunk is written before its presence
+// byte, so that readers from other processes never see partially written
+// chunks. Writers concurrently fetching the same chunk write the same
+// bytes.
+// Files are managed by a CPLDiskCache, with least recently used eviction at
+// the granularity of a remote file.
+
+#include "cpl_port.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_vsil_curl_class.h"
+
+#include "cpl_conv.h"
+#include "cpl_disk_cache.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+constexpr int SIGNATURE_SIZE = CPLDiskCache::SIGNATURE_SIZE;
+constexpr int DATA_ALIGNMENT = 4096;
+
+/************************************************************************/
+/*                        GetDiskCacheDir()                             */
+/************************************************************************/
+
+static std::string GetDiskCacheDir()
+{
+    return CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                        GetDiskCacheMaxSize()                         */
+/************************************************************************/
+
+static GIntBig GetDiskCacheMaxSize()
+{
+    return CPLDiskCache::ParseMaxSize(
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_MAX_SIZE", "1GB"),
+        "CPL_VSIL_CURL_DISK_CACHE_MAX_SIZE");
+}
+
+/************************************************************************/
+/*                           GetCachedBytes()                           */
+/************************************************************************/
+
+static GIntBig GetCachedBytes(const std::string &osFilename,
+                              const VSIStatBufL &)
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+    if (!fp)
+        return 0;
+    GByte abyHeader[SIGNATURE_SIZE + sizeof(uint32_t) + sizeof(uint64_t) +
+                    sizeof(uint32_t)];
+    if (fp->Read(abyHeader, 1, sizeof(abyHeader)) != sizeof(abyHeader))
+        return 0;
+    uint32_t nChunkSize = 0;
+    memcpy(&nChunkSize, abyHeader + SIGNATURE_SIZE, sizeof(nChunkSize));
+    CPL_LSBPTR32(&nChunkSize);
+    uint64_t nFileSize = 0;
+    memcpy(&nFileSize, abyHeader + SIGNATURE_SIZE + sizeof(uint32_t),
+           sizeof(nFileSize));
+    CPL_LSBPTR64(&nFileSize);
+    uint32_t nKeySize = 0;
+    memcpy(&nKeySize,
+           abyHeader + SIGNATURE_SIZE + sizeof(uint32_t) + sizeof(uint64_t),
+           sizeof(nKeySize));
+    CPL_LSBPTR32(&nKeySize);
+    if (nChunkSize == 0)
+        return 0;
+
+    const uint64_t nChunkCount = (nFileSize + nChunkSize - 1) / nChunkSize;
+    GIntBig nSize = static_cast<GIntBig>(sizeof(abyHeader)) + nKeySize;
+    std::vector<GByte> abyPresence;
+    constexpr size_t BUFFER_SIZE = 65536;
+    if (fp->Seek(sizeof(abyHeader) + nKeySize, SEEK_SET) != 0)
+        return nSize;
+    for (uint64_t i = 0; i < nChunkCount; i += BUFFER_SIZE)
+    {
+        const size_t nToRead = static_cast<size_t>(
+            std::min<uint64_t>(BUFFER_SIZE, nChunkCount - i));
+        abyPresence.resize(nToRead);
+        if (fp->Read(abyPresence.data(), 1, nToRead) != nToRead)
+            break;
+        nSize += static_cast<GIntBig>(nToRead) +
+                 static_cast<GIntBig>(
+                     std::count(abyPresence.begin(), abyPresence.end(), 1)) *
+                     nChunkSize;
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                            GetDiskCache()                            */
+/************************************************************************/
+
+static CPLDiskCache &GetDiskCache()
+{
+    // st_size is the apparent size of the sparse file, which over-estimates
+    // its footprint when only a few chunks are cached, hence count the
+    // chunks actually present.
+    static CPLDiskCache goDiskCache("GDALVCC1", "cache", "VSICURL",
+                                    GetCachedBytes);
+    return goDiskCache;
+}
+
+/************************************************************************/
+/*                            CacheLayout                               */
+/************************************************************************/
+
+namespace
+{
+struct CacheLayout
+{
+    vsi_l_offset nPresenceOffset = 0;
+    vsi_l_offset nDataOffset = 0;
+    vsi_l_offset nChunkCount = 0;
+
+    CacheLayout(const std::string &osKey, vsi_l_offset nFileSize,
+                int nChunkSize)
+    {
+        nPresenceOffset = SIGNATURE_SIZE + sizeof(uint32_t) + sizeof(uint64_t) +
+                          sizeof(uint32_t) + osKey.size();
+        nChunkCount = (nFileSize + nChunkSize - 1) / nChunkSize;
+        nDataOffset = (nPresenceOffset + nChunkCount + DATA_ALIGNMENT - 1) /
+                      DATA_ALIGNMENT * DATA_ALIGNMENT;
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                            CheckHeader()                             */
+/************************************************************************/
+
+static bool CheckHeader(VSIVirtualHandle *fp, const std::string &osKey,
+                        vsi_l_offset nFileSize, int nChunkSize)
+{
+    uint32_t nStoredChunkSize = 0;
+    uint64_t nStoredFileSize = 0;
+    uint32_t nKeySize = 0;
+    if (!GetDiskCache().CheckSignature(fp) ||
+        fp->Read(&nStoredChunkSize, sizeof(nStoredChunkSize), 1) != 1 ||
+        fp->Read(&nStoredFileSize, sizeof(nStoredFileSize), 1) != 1 ||
+        fp->Read(&nKeySize, sizeof(nKeySize), 1) != 1)
+    {
+        return false;
+    }
+    CPL_LSBPTR32(&nStoredChunkSize);
+    CPL_LSBPTR64(&nStoredFileSize);
+    CPL_LSBPTR32(&nKeySize);
+    if (nStoredChunkSize != static_cast<uint32_t>(nChunkSize) ||
+        nStoredFileSize != nFileSize || nKeySize != osKey.size())
+    {
+        return false;
+    }
+    std::string osStoredKey;
+    osStoredKey.resize(nKeySize);
+    return fp->Read(osStoredKey.data(), 1, nKeySize) == nKeySize &&
+           osStoredKey == osKey;
+}
+
+/************************************************************************/
+/*                       VSICurlDiskCacheIsEnabled()                    */
+/************************************************************************/
+
+/** Return whether CPL_VSIL_CURL_DISK_CACHE_DIR is set. */
+bool VSICurlDiskCacheIsEnabled()
+{
+    const char *pszCacheDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    return pszCacheDir != nullptr && pszCacheDir[0] != 0;
+}
+
+/************************************************************************/
+/*                         VSICurlDiskCacheRead()                       */
+/************************************************************************/
+
+/** Fetch the chunk starting at nOffset (a multiple of nChunkSize) of the
+ * remote file identified by osKey, of size nFileSize, from the disk cache.
+ *
+ * @return true if the chunk was found in the cache.
+ */
+bool VSICurlDiskCacheRead(const std::string &osKey, vsi_l_offset nFileSize,
+                          int nChunkSize, vsi_l_offset nOffset,
+                          std::string &osData)
+{
+    const std::string osCacheDir = GetDiskCacheDir();
+    if (osCacheDir.empty() || nOffset >= nFileSize)
+        return false;
+    const std::string osFilename =
+        GetDiskCache().GetFilename(osCacheDir, osKey);
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return false;
+
+    const CacheLayout oLayout(osKey, nFileSize, nChunkSize);
+    const vsi_l_offset nChunkIdx = nOffset / nChunkSize;
+    const size_t nSize = static_cast<size_t>(
+        std::min<vsi_l_offset>(nChunkSize, nFileSize - nOffset));
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+        if (!fp || !CheckHeader(fp.get(), osKey, nFileSize, nChunkSize))
+            return false;
+
+        GByte chPresent = 0;
+        if (fp->Seek(oLayout.nPresenceOffset + nChunkIdx, SEEK_SET) != 0 ||
+            fp->Read(&chPresent, 1, 1) != 1 || chPresent != 1)
+        {
+            return false;
+        }
+
+        osData.resize(nSize);
+        if (fp->Seek(oLayout.nDataOffset + nChunkIdx * nChunkSize,
+                     SEEK_SET) != 0 ||
+            fp->Read(osData.data(), 1, nSize) != nSize)
+        {
+            osData.clear();
+            return false;
+        }
+    }
+
+    GetDiskCache().Touch(osFilename, sStat);
+
+    return true;
+}
+
+/************************************************************************/
+/*                          CreateCacheFile()                           */
+/************************************************************************/
+
+static bool CreateCacheFile(const std::string &osFilename,
+                            const std::string &osKey, vsi_l_offset nFileSize,
+                            int nChunkSize)
+{
+    CPLDiskCache &oDiskCache = GetDiskCache();
+    const std::string osTmpFilename = oDiskCache.GetTmpFilename(osFilename);
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+    if (!fp)
+        return false;
+
+    const CacheLayout oLayout(osKey, nFileSize, nChunkSize);
+    uint32_t nChunkSizeLSB = static_cast<uint32_t>(nChunkSize);
+    CPL_LSBPTR32(&nChunkSizeLSB);
+    uint64_t nFileSizeLSB = static_cast<uint64_t>(nFileSize);
+    CPL_LSBPTR64(&nFileSizeLSB);
+    uint32_t nKeySize = static_cast<uint32_t>(osKey.size());
+    CPL_LSBPTR32(&nKeySize);
+    const std::vector<GByte> abyPresence(
+        static_cast<size_t>(oLayout.nDataOffset - oLayout.nPresenceOffset));
+    bool bOK =
+        oDiskCache.WriteSignature(fp.get()) &&
+        fp->Write(&nChunkSizeLSB, sizeof(nChunkSizeLSB), 1) == 1 &&
+        fp->Write(&nFileSizeLSB, sizeof(nFileSizeLSB), 1) == 1 &&
+        fp->Write(&nKeySize, sizeof(nKeySize), 1) == 1 &&
+        fp->Write(osKey.data(), 1, osKey.size()) == osKey.size() &&
+        fp->Write(abyPresence.data(), 1, abyPresence.size()) ==
+            abyPresence.size();
+    bOK = fp->Close() == 0 && bOK;
+    if (!bOK)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return false;
+    }
+    // Do not override a file that would have been created in the meantime
+    // by another process.
+    return CPLDiskCache::InstallTmpFile(osTmpFilename, osFilename,
+                                        /* bOverwrite = */ false);
+}
+
+/************************************************************************/
+/*                         VSICurlDiskCacheWrite()                      */
+/************************************************************************/
+
+/** Store the chunk starting at nOffset (a multiple of nChunkSize) of the
+ * remote file identified by osKey, of size nFileSize, into the disk cache,
+ * and evict least recently used files if the cache exceeds
+ * CPL_VSIL_CURL_DISK_CACHE_MAX_SIZE.
+ *
+ * nSize must be nChunkSize, except for the last chunk of the file.
+ * Errors are silently ignored, the cache being only an optimization.
+ */
+void VSICurlDiskCacheWrite(const std::string &osKey, vsi_l_offset nFileSize,
+                           int nChunkSize, vsi_l_offset nOffset,
+                           const char *pData, size_t nSize)
+{
+    const std::string osCacheDir = GetDiskCacheDir();
+    if (osCacheDir.empty() || (nOffset % nChunkSize) != 0 ||
+        nOffset >= nFileSize ||
+        nSize != std::min<vsi_l_offset>(nChunkSize, nFileSize - nOffset))
+    {
+        return;
+    }
+    std::string osSubDir;
+    const std::string osFilename =
+        GetDiskCache().GetFilename(osCacheDir, osKey, &osSubDir);
+
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+    {
+        CPLDiskCache::CreateSubDir(osCacheDir, osSubDir);
+        if (!CreateCacheFile(osFilename, osKey, nFileSize, nChunkSize))
+            return;
+    }
+
+    const CacheLayout oLayout(osKey, nFileSize, nChunkSize);
+    const vsi_l_offset nChunkIdx = nOffset / nChunkSize;
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "r+b"));
+        if (!fp || !CheckHeader(fp.get(), osKey, nFileSize, nChunkSize))
+            return;
+
+        // Write the data before flagging it as present
+        const GByte chPresent = 1;
+        if (fp->Seek(oLayout.nDataOffset + nChunkIdx * nChunkSize,
+                     SEEK_SET) != 0 ||
+            fp->Write(pData, 1, nSize) != nSize || fp->Flush() != 0 ||
+            fp->Seek(oLayout.nPresenceOffset + nChunkIdx, SEEK_SET) != 0 ||
+            fp->Write(&chPresent, 1, 1) != 1 || fp->Close() != 0)
+        {
+            return;
+        }
+    }
+
+    GetDiskCache().NotifyBytesWritten(osCacheDir, nSize,
+                                      GetDiskCacheMaxSize());
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
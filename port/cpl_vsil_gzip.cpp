@@ -53,6 +53,16 @@
    in a .gz.properties file, so that we don't need to seek at the end of the
    file each time a Stat() is done.
 
+   When CPL_VSIL_GZIP_INDEX=YES, a persistent .gz.gzidx index is also
+   created after a full decompression of a .gz file. It contains "access
+   points" (as in the zran.c example of zlib) at regular intervals of the
+   uncompressed stream, made of the position in the compressed stream, and of
+   the (compressed) 32 KB window of uncompressed data preceding it. It is
+   reused by later openings for fast random access, and enables multi-threaded
+   decompression of the ranges between access points. BGZF files, made of
+   independent gzip members whose size is in their header, can also be
+   decompressed in a multi-threaded way without index.
+
    For .zip and .gz, both reading and writing are supported, but just one mode
    at a time (read-only or write-only).
 */
@@ -82,6 +92,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -146,6 +157,52 @@ typedef struct
     vsi_l_offset out;
 } GZipSnapshot;
 
+/** Point of the uncompressed stream from which decompression can restart */
+struct VSIGZipAccessPoint
+{
+    // Position in the base handle of the first byte not entirely consumed
+    vsi_l_offset posInBaseHandle = 0;
+    // Position in the uncompressed stream
+    vsi_l_offset out = 0;
+    // CRC32 of the uncompressed data of the current gzip member before out
+    uLong crc = 0;
+    // Number of bits of the byte before posInBaseHandle that are not
+    // consumed yet, and their value.
+    int bits = 0;
+    int value = 0;
+    // Deflate compressed version of the (up to) 32 KB of uncompressed data
+    // preceding out. Empty at the start of a gzip member.
+    std::vector<Byte> compressedWindow{};
+};
+
+/** Persistent index of a .gz file */
+struct VSIGZipIndex
+{
+    vsi_l_offset uncompressed_size = 0;
+    std::vector<VSIGZipAccessPoint> points{};
+};
+
+/** Range of the compressed stream that can be decompressed independently */
+struct VSIGZipChunk
+{
+    vsi_l_offset nPosInBaseHandle = 0;
+    size_t nCompressedSize = 0;
+    vsi_l_offset nOut = 0;
+    size_t nOutSize = 0;
+    // Index of the access point from which to start, or -1 for a BGZF
+    // member (full gzip member, header and trailer included).
+    int nAccessPoint = -1;
+};
+
+/** Decompression of a VSIGZipChunk by a worker thread */
+struct VSIGZipDecodeJob
+{
+    std::vector<Byte> abyIn{};
+    std::vector<Byte> abyOut{};
+    bool bOK = false;
+    std::atomic<bool> bDone{false};
+};
+
 class VSIGZipHandle final : public VSIVirtualHandle
 {
     VSIVirtualHandle *m_poBaseHandle = nullptr;
@@ -180,12 +237,52 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    // Persistent index (CPL_VSIL_GZIP_INDEX=YES)
+    std::shared_ptr<const VSIGZipIndex> m_poIndex{};
+    std::unique_ptr<VSIGZipIndex> m_poIndexInProgress{};
+    vsi_l_offset m_nIndexSpan = 0;
+
+    // Multi-threaded decompression
+    int m_nThreads = 0;
+    bool m_bBGZF = false;
+    bool m_bBGZFDiscoveryComplete = false;
+    vsi_l_offset m_nNextBGZFMemberPos = 0;
+    vsi_l_offset m_nNextBGZFMemberOut = 0;
+    // Set when the decompression state of the serial path doesn't match
+    // the current position any longer.
+    bool m_bSerialStateDirty = false;
+    std::vector<VSIGZipChunk> m_aoChunks{};
+    std::map<size_t, std::shared_ptr<VSIGZipDecodeJob>> m_oMapJobs{};
+    // Queue of jobs of this handle, in the thread pool shared by all
+    // /vsigzip/ handles.
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
     int gzrewind();
     uLong getLong();
 
+    std::string GetIndexFilename() const;
+    bool LoadIndex();
+    void SaveIndex();
+    void AddAccessPoint(bool bMemberStart);
+    void CompleteIndex();
+    bool RestoreAccessPoint(const VSIGZipAccessPoint &point);
+    void BuildChunksFromIndex();
+
+    bool CanUseMultiThreadedRead() const
+    {
+        return m_nThreads > 1 && !m_transparent &&
+               (m_poIndex != nullptr || m_bBGZF);
+    }
+
+    bool DiscoverNextBGZFMember(std::vector<Byte> &abyData);
+    bool GetChunkIndex(vsi_l_offset nOffset, size_t &nChunkIdx);
+    void SubmitDecodeJobs(size_t nFirstChunkIdx);
+    size_t ReadMultiThreaded(Byte *pabyBuffer, size_t nToRead,
+                             bool &bFallbackToSerial);
+
     CPL_DISALLOW_COPY_ASSIGN(VSIGZipHandle)
 
   public:
@@ -239,6 +336,9 @@ class VSIGZipHandle final : public VSIVirtualHandle
     {
         m_bCanSaveInfo = false;
     }
+
+    void InitIndex();
+    void InitMultiThreading();
 };
 
 #ifdef ENABLE_DEFLATE64
@@ -348,6 +448,9 @@ class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
     VSIGZipHandle *poHandleLastGZipFile = nullptr;
     bool m_bInSaveInfo = false;
 
+    std::mutex m_oMutexPool{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
   public:
     VSIGZipFilesystemHandler() = default;
     ~VSIGZipFilesystemHandler() override;
@@ -374,6 +477,8 @@ class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
 
     void SaveInfo(VSIGZipHandle *poHandle);
     void SaveInfo_unlocked(VSIGZipHandle *poHandle);
+
+    CPLWorkerThreadPool *GetThreadPool(int nThreads);
 };
 
 /************************************************************************/
@@ -422,6 +527,13 @@ VSIGZipHandle *VSIGZipHandle::Duplicate()
         poHandle->snapshots[i].out = snapshots[i].out;
     }
 
+    if (m_poIndex)
+    {
+        poHandle->m_poIndex = m_poIndex;
+        poHandle->m_aoChunks = m_aoChunks;
+    }
+    poHandle->InitMultiThreading();
+
     return poHandle;
 }
 
@@ -546,6 +658,9 @@ VSIGZipHandle::~VSIGZipHandle()
         cpl::down_cast<VSIGZipFilesystemHandler *>(poFSHandler)->SaveInfo(this);
     }
 
+    // Wait for pending decompression jobs
+    m_poJobQueue.reset();
+
     if (stream.state != nullptr)
     {
         inflateEnd(&(stream));
@@ -733,6 +848,38 @@ int VSIGZipHandle::Seek(vsi_l_offset nOffset, int nWhence)
 {
     m_bEOF = false;
 
+    if (CanUseMultiThreadedRead())
+    {
+        // Decompression will restart from the chunk containing the new
+        // position at the next Read()
+        if (nWhence == SEEK_SET || nWhence == SEEK_CUR ||
+            (nWhence == SEEK_END && nOffset == 0 && m_uncompressed_size != 0))
+        {
+            if (nWhence == SEEK_SET)
+                out = nOffset;
+            else if (nWhence == SEEK_CUR)
+                out += nOffset;
+            else
+                out = m_uncompressed_size;
+            m_bSerialStateDirty = true;
+            if (z_err == Z_STREAM_END)
+                z_err = Z_OK;
+            return 0;
+        }
+    }
+
+    if (m_bSerialStateDirty)
+    {
+        if (nWhence == SEEK_CUR)
+        {
+            nOffset += out;
+            nWhence = SEEK_SET;
+        }
+        m_bSerialStateDirty = false;
+        if (gzrewind() < 0)
+            return -1;
+    }
+
     return gzseek(nOffset, nWhence) ? 0 : -1;
 }
 
@@ -892,6 +1039,31 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         }
     }
 
+    // Use the closest access point of the persistent index, if it is closer
+    // than the current position.
+    if (m_poIndex && original_nWhence != SEEK_END)
+    {
+        const vsi_l_offset nTarget = out + offset;
+        const auto &points = m_poIndex->points;
+        auto oIter = std::upper_bound(points.begin(), points.end(), nTarget,
+                                      [](vsi_l_offset nVal,
+                                         const VSIGZipAccessPoint &point)
+                                      { return nVal < point.out; });
+        if (oIter != points.begin())
+        {
+            --oIter;
+            if (oIter->out > out)
+            {
+                if (!RestoreAccessPoint(*oIter))
+                {
+                    CPL_VSIL_GZ_RETURN(FALSE);
+                    return false;
+                }
+                offset = nTarget - out;
+            }
+        }
+    }
+
     // Offset is now the number of bytes to skip.
 
     if (offset != 0 && outbuf == nullptr)
@@ -1016,6 +1188,32 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
 
     const unsigned len =
         static_cast<unsigned int>(nSize) * static_cast<unsigned int>(nMemb);
+
+    if (CanUseMultiThreadedRead())
+    {
+        bool bFallbackToSerial = false;
+        const size_t nRead = ReadMultiThreaded(static_cast<Byte *>(buf), len,
+                                               bFallbackToSerial);
+        if (bFallbackToSerial && nRead < len)
+        {
+            // Continue with the serial decompression
+            return (nRead + Read(static_cast<Byte *>(buf) + nRead, 1,
+                                 len - nRead)) /
+                   nSize;
+        }
+        if (nRead < len && z_err == Z_OK)
+            m_bEOF = true;
+        return nRead / nSize;
+    }
+
+    if (m_bSerialStateDirty)
+    {
+        const vsi_l_offset nCurOffset = out;
+        m_bSerialStateDirty = false;
+        if (gzrewind() < 0 || !gzseek(nCurOffset, SEEK_SET))
+            return 0;
+    }
+
     Bytef *pStart =
         static_cast<Bytef *>(buf);  // Start off point for crc computation.
     // == stream.next_out but not forced far (for MSDOS).
@@ -1145,10 +1343,22 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
         }
         in += stream.avail_in;
         out += stream.avail_out;
-        z_err = inflate(&(stream), Z_NO_FLUSH);
+        // When building the index, stop at the end of each deflate block to
+        // be able to create access points.
+        z_err = inflate(&(stream), m_poIndexInProgress ? Z_BLOCK : Z_NO_FLUSH);
         in -= stream.avail_in;
         out -= stream.avail_out;
 
+        if (m_poIndexInProgress && z_err == Z_OK &&
+            (stream.data_type & 128) != 0 && (stream.data_type & 64) == 0 &&
+            out >= m_poIndexInProgress->points.back().out + m_nIndexSpan)
+        {
+            crc =
+                crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
+            pStart = stream.next_out;
+            AddAccessPoint(/* bMemberStart = */ false);
+        }
+
         if (z_err == Z_STREAM_END && m_compressed_size != 2)
         {
             // Check CRC and original size.
@@ -1193,6 +1403,12 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
                     {
                         inflateReset(&(stream));
                         crc = 0;
+                        if (m_poIndexInProgress)
+                            AddAccessPoint(/* bMemberStart = */ true);
+                    }
+                    else if (m_poIndexInProgress && z_err == Z_STREAM_END)
+                    {
+                        CompleteIndex();
                     }
                 }
             }
@@ -1205,6 +1421,7 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
     size_t ret = (len - stream.avail_out) / nSize;
     if (z_err != Z_OK && z_err != Z_STREAM_END)
     {
+        m_poIndexInProgress.reset();
         CPLError(CE_Failure, CPLE_AppDefined,
                  "In file %s, at line %d, decompression failed with "
                  "z_err = %d, return = %d",
@@ -1243,6 +1460,830 @@ uLong VSIGZipHandle::getLong()
     return x;
 }
 
+/************************************************************************/
+/*                          GetGZipHeaderSize()                         */
+/************************************************************************/
+
+/** Return the size of the gzip header at the start of pabyData, or 0 if it
+ * is invalid or truncated.
+ */
+static size_t GetGZipHeaderSize(const Byte *pabyData, size_t nSize)
+{
+    if (nSize < 10 || pabyData[0] != gz_magic[0] ||
+        pabyData[1] != gz_magic[1] || pabyData[2] != Z_DEFLATED ||
+        (pabyData[3] & RESERVED) != 0)
+    {
+        return 0;
+    }
+    const int flags = pabyData[3];
+    size_t nPos = 10;
+    if ((flags & EXTRA_FIELD) != 0)
+    {
+        if (nSize < nPos + 2)
+            return 0;
+        nPos += 2 + (pabyData[nPos] | (pabyData[nPos + 1] << 8));
+    }
+    for (const int nFlag : {ORIG_NAME, COMMENT})
+    {
+        if ((flags & nFlag) != 0)
+        {
+            while (nPos < nSize && pabyData[nPos] != 0)
+                ++nPos;
+            ++nPos;
+        }
+    }
+    if ((flags & HEAD_CRC) != 0)
+        nPos += 2;
+    return nPos <= nSize ? nPos : 0;
+}
+
+/************************************************************************/
+/*                          GetBGZFBlockSize()                          */
+/************************************************************************/
+
+/** Return the total size of a BGZF member, from the first 18 bytes of its
+ * header, which contains a "BC" extra subfield with the size.
+ */
+static bool GetBGZFBlockSize(const Byte *pabyHeader, size_t nSize,
+                             size_t &nBlockSize)
+{
+    if (nSize < 18 || pabyHeader[0] != gz_magic[0] ||
+        pabyHeader[1] != gz_magic[1] || pabyHeader[2] != Z_DEFLATED ||
+        (pabyHeader[3] & EXTRA_FIELD) == 0)
+    {
+        return false;
+    }
+    const size_t nExtraSize = pabyHeader[10] | (pabyHeader[11] << 8);
+    if (nExtraSize < 6 || pabyHeader[12] != 'B' || pabyHeader[13] != 'C' ||
+        pabyHeader[14] != 2 || pabyHeader[15] != 0)
+    {
+        return false;
+    }
+    nBlockSize =
+        static_cast<size_t>(pabyHeader[16] | (pabyHeader[17] << 8)) + 1;
+    // Header, and CRC32 and ISIZE trailer
+    return nBlockSize >= 12 + nExtraSize + 8;
+}
+
+/************************************************************************/
+/*                           GetIndexFilename()                         */
+/************************************************************************/
+
+std::string VSIGZipHandle::GetIndexFilename() const
+{
+    return std::string(m_pszBaseFileName).append(".gzidx");
+}
+
+/************************************************************************/
+/*                              InitIndex()                             */
+/************************************************************************/
+
+/** Load the persistent index if CPL_VSIL_GZIP_INDEX=YES, or prepare for
+ * building it during decompression if it doesn't exist yet.
+ */
+void VSIGZipHandle::InitIndex()
+{
+    if (!m_pszBaseFileName || m_transparent ||
+        !CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "NO")))
+    {
+        return;
+    }
+
+    GIntBig nSpan = 0;
+    if (CPLParseMemorySize(
+            CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_SPAN", "1MB"), &nSpan,
+            nullptr) != CE_None ||
+        nSpan < Z_BUFSIZE)
+    {
+        nSpan = Z_BUFSIZE;
+    }
+    m_nIndexSpan = static_cast<vsi_l_offset>(nSpan);
+
+    if (LoadIndex())
+        return;
+
+    if (in == 0 && out == 0)
+    {
+        m_poIndexInProgress = std::make_unique<VSIGZipIndex>();
+        VSIGZipAccessPoint point;
+        point.posInBaseHandle = startOff;
+        m_poIndexInProgress->points.push_back(std::move(point));
+    }
+}
+
+/************************************************************************/
+/*                              LoadIndex()                             */
+/************************************************************************/
+
+constexpr const char GZIP_INDEX_SIGNATURE[] = "GDALGZI1";
+constexpr size_t GZIP_INDEX_SIGNATURE_SIZE = 8;
+constexpr uInt GZIP_WINDOW_SIZE = 32768;
+
+bool VSIGZipHandle::LoadIndex()
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(m_pszBaseFileName, &sStat) != 0)
+        return false;
+
+    const std::string osIndexFilename = GetIndexFilename();
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osIndexFilename.c_str(), "rb"));
+    if (!fp)
+        return false;
+
+    const auto ReadUInt64 = [&fp](uint64_t &nVal)
+    {
+        if (fp->Read(&nVal, sizeof(nVal), 1) != 1)
+            return false;
+        CPL_LSBPTR64(&nVal);
+        return true;
+    };
+    const auto ReadUInt32 = [&fp](uint32_t &nVal)
+    {
+        if (fp->Read(&nVal, sizeof(nVal), 1) != 1)
+            return false;
+        CPL_LSBPTR32(&nVal);
+        return true;
+    };
+
+    char achSignature[GZIP_INDEX_SIGNATURE_SIZE];
+    uint64_t nCompressedSize = 0;
+    uint64_t nMTime = 0;
+    uint64_t nUncompressedSize = 0;
+    uint64_t nPoints = 0;
+    if (fp->Read(achSignature, 1, GZIP_INDEX_SIGNATURE_SIZE) !=
+            GZIP_INDEX_SIGNATURE_SIZE ||
+        memcmp(achSignature, GZIP_INDEX_SIGNATURE,
+               GZIP_INDEX_SIGNATURE_SIZE) != 0 ||
+        !ReadUInt64(nCompressedSize) || !ReadUInt64(nMTime) ||
+        !ReadUInt64(nUncompressedSize) || !ReadUInt64(nPoints))
+    {
+        return false;
+    }
+    if (nCompressedSize != m_compressed_size ||
+        nMTime != static_cast<uint64_t>(sStat.st_mtime))
+    {
+        CPLDebug("GZIP", "%s is out of date", osIndexFilename.c_str());
+        return false;
+    }
+    // Each point takes at least 24 bytes
+    if (nPoints == 0 || nPoints > m_compressed_size / 24 + 1)
+        return false;
+
+    auto poIndex = std::make_shared<VSIGZipIndex>();
+    poIndex->uncompressed_size = nUncompressedSize;
+    try
+    {
+        poIndex->points.resize(static_cast<size_t>(nPoints));
+        for (auto &point : poIndex->points)
+        {
+            uint64_t nPos = 0;
+            uint64_t nOut = 0;
+            uint32_t nCRC = 0;
+            GByte abyBitsValue[2] = {0, 0};
+            uint32_t nCompressedWindowSize = 0;
+            if (!ReadUInt64(nPos) || !ReadUInt64(nOut) || !ReadUInt32(nCRC) ||
+                fp->Read(abyBitsValue, 1, 2) != 2 ||
+                !ReadUInt32(nCompressedWindowSize) ||
+                nPos < startOff || nPos > offsetEndCompressedData ||
+                nOut > nUncompressedSize || abyBitsValue[0] > 7 ||
+                nCompressedWindowSize > 2 * GZIP_WINDOW_SIZE ||
+                (&point != &poIndex->points.front() &&
+                 nOut <= (&point - 1)->out))
+            {
+                return false;
+            }
+            point.posInBaseHandle = nPos;
+            point.out = nOut;
+            point.crc = nCRC;
+            point.bits = abyBitsValue[0];
+            point.value = abyBitsValue[1];
+            point.compressedWindow.resize(nCompressedWindowSize);
+            if (fp->Read(point.compressedWindow.data(), 1,
+                         nCompressedWindowSize) != nCompressedWindowSize)
+            {
+                return false;
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        return false;
+    }
+
+    CPLDebug("GZIP", "Using %s with %d access points", osIndexFilename.c_str(),
+             static_cast<int>(nPoints));
+    m_poIndex = std::move(poIndex);
+    m_uncompressed_size = nUncompressedSize;
+    BuildChunksFromIndex();
+    return true;
+}
+
+/************************************************************************/
+/*                              SaveIndex()                             */
+/************************************************************************/
+
+void VSIGZipHandle::SaveIndex()
+{
+    // Same restrictions as for the .properties file
+    if (STARTS_WITH(m_pszBaseFileName, "/vsicurl/") ||
+        STARTS_WITH(m_pszBaseFileName, "/vsitar/") ||
+        STARTS_WITH(m_pszBaseFileName, "/vsizip/"))
+    {
+        return;
+    }
+
+    VSIStatBufL sStat;
+    if (VSIStatL(m_pszBaseFileName, &sStat) != 0)
+        return;
+
+    const std::string osIndexFilename = GetIndexFilename();
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osIndexFilename.c_str(), "wb"));
+    if (!fp)
+        return;
+
+    bool bOK = true;
+    const auto WriteUInt64 = [&fp, &bOK](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        bOK = bOK && fp->Write(&nVal, sizeof(nVal), 1) == 1;
+    };
+    const auto WriteUInt32 = [&fp, &bOK](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        bOK = bOK && fp->Write(&nVal, sizeof(nVal), 1) == 1;
+    };
+
+    bOK = fp->Write(GZIP_INDEX_SIGNATURE, 1, GZIP_INDEX_SIGNATURE_SIZE) ==
+          GZIP_INDEX_SIGNATURE_SIZE;
+    WriteUInt64(m_compressed_size);
+    WriteUInt64(static_cast<uint64_t>(sStat.st_mtime));
+    WriteUInt64(m_poIndex->uncompressed_size);
+    WriteUInt64(m_poIndex->points.size());
+    for (const auto &point : m_poIndex->points)
+    {
+        WriteUInt64(point.posInBaseHandle);
+        WriteUInt64(point.out);
+        WriteUInt32(static_cast<uint32_t>(point.crc));
+        const GByte abyBitsValue[2] = {static_cast<GByte>(point.bits),
+                                       static_cast<GByte>(point.value)};
+        bOK = bOK && fp->Write(abyBitsValue, 1, 2) == 2;
+        WriteUInt32(static_cast<uint32_t>(point.compressedWindow.size()));
+        bOK = bOK && fp->Write(point.compressedWindow.data(), 1,
+                               point.compressedWindow.size()) ==
+                         point.compressedWindow.size();
+    }
+    bOK = fp->Close() == 0 && bOK;
+    fp.reset();
+    if (!bOK)
+        VSIUnlink(osIndexFilename.c_str());
+}
+
+/************************************************************************/
+/*                            AddAccessPoint()                          */
+/************************************************************************/
+
+/** Record an access point for the current decompression state, which must
+ * be at the end of a deflate block, or at the start of a gzip member.
+ */
+void VSIGZipHandle::AddAccessPoint(bool bMemberStart)
+{
+    VSIGZipAccessPoint point;
+    point.posInBaseHandle = m_poBaseHandle->Tell() - stream.avail_in;
+    point.out = out;
+    point.crc = crc;
+    if (!bMemberStart)
+    {
+        point.bits = stream.data_type & 7;
+        if (point.bits)
+        {
+            // The partially consumed byte must still be in the input buffer
+            if (stream.next_in == inbuf)
+                return;
+            point.value = stream.next_in[-1] >> (8 - point.bits);
+        }
+
+        std::vector<Byte> abyWindow(GZIP_WINDOW_SIZE);
+        uInt nWindowSize = 0;
+        if (inflateGetDictionary(&stream, abyWindow.data(), &nWindowSize) !=
+            Z_OK)
+        {
+            return;
+        }
+        if (nWindowSize)
+        {
+            size_t nCompressedSize = 0;
+            void *pCompressed =
+                CPLZLibDeflate(abyWindow.data(), nWindowSize, -1, nullptr, 0,
+                               &nCompressedSize);
+            if (!pCompressed)
+                return;
+            const Byte *pabyCompressed = static_cast<Byte *>(pCompressed);
+            point.compressedWindow.assign(pabyCompressed,
+                                          pabyCompressed + nCompressedSize);
+            VSIFree(pCompressed);
+        }
+    }
+
+    auto &points = m_poIndexInProgress->points;
+    if (points.back().out >= point.out)
+    {
+        // A member start may be at the same position as an access point at
+        // the end of an empty final block of the previous member, in which
+        // case it supersedes it.
+        if (bMemberStart && points.back().out == point.out)
+            points.back() = std::move(point);
+    }
+    else
+    {
+        points.push_back(std::move(point));
+    }
+}
+
+/************************************************************************/
+/*                            CompleteIndex()                           */
+/************************************************************************/
+
+/** Called when the end of the compressed stream has been reached while
+ * building the index.
+ */
+void VSIGZipHandle::CompleteIndex()
+{
+    m_poIndexInProgress->uncompressed_size = out;
+    m_uncompressed_size = out;
+    m_poIndex = std::move(m_poIndexInProgress);
+    CPLDebug("GZIP", "Index of %s built with %d access points",
+             m_pszBaseFileName, static_cast<int>(m_poIndex->points.size()));
+    SaveIndex();
+    BuildChunksFromIndex();
+}
+
+/************************************************************************/
+/*                         RestoreAccessPoint()                         */
+/************************************************************************/
+
+bool VSIGZipHandle::RestoreAccessPoint(const VSIGZipAccessPoint &point)
+{
+    if (m_poBaseHandle->Seek(point.posInBaseHandle, SEEK_SET) != 0 ||
+        inflateReset(&stream) != Z_OK ||
+        (point.bits && inflatePrime(&stream, point.bits, point.value) != Z_OK))
+    {
+        return false;
+    }
+    if (!point.compressedWindow.empty())
+    {
+        std::vector<Byte> abyWindow(GZIP_WINDOW_SIZE);
+        size_t nWindowSize = 0;
+        if (!CPLZLibInflate(point.compressedWindow.data(),
+                            point.compressedWindow.size(), abyWindow.data(),
+                            abyWindow.size(), &nWindowSize) ||
+            inflateSetDictionary(&stream, abyWindow.data(),
+                                 static_cast<uInt>(nWindowSize)) != Z_OK)
+        {
+            return false;
+        }
+    }
+    stream.avail_in = 0;
+    stream.next_in = inbuf;
+    z_eof = 0;
+    z_err = Z_OK;
+    m_transparent = 0;
+    crc = point.crc;
+    in = point.posInBaseHandle - startOff;
+    out = point.out;
+    return true;
+}
+
+/************************************************************************/
+/*                         BuildChunksFromIndex()                       */
+/************************************************************************/
+
+/** Each range between two consecutive access points can be decompressed
+ * independently of the others.
+ */
+void VSIGZipHandle::BuildChunksFromIndex()
+{
+    m_aoChunks.clear();
+    const auto &points = m_poIndex->points;
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        const vsi_l_offset nEndPos = i + 1 < points.size()
+                                         ? points[i + 1].posInBaseHandle
+                                         : offsetEndCompressedData;
+        const vsi_l_offset nEndOut = i + 1 < points.size()
+                                         ? points[i + 1].out
+                                         : m_poIndex->uncompressed_size;
+        if (nEndPos < points[i].posInBaseHandle ||
+            nEndPos - points[i].posInBaseHandle > UINT_MAX ||
+            nEndOut - points[i].out > UINT_MAX)
+        {
+            // Should not happen with realistic deflate streams
+            m_aoChunks.clear();
+            return;
+        }
+        VSIGZipChunk chunk;
+        chunk.nPosInBaseHandle = points[i].posInBaseHandle;
+        chunk.nCompressedSize =
+            static_cast<size_t>(nEndPos - points[i].posInBaseHandle);
+        chunk.nOut = points[i].out;
+        chunk.nOutSize = static_cast<size_t>(nEndOut - points[i].out);
+        chunk.nAccessPoint = static_cast<int>(i);
+        if (chunk.nOutSize > 0)
+            m_aoChunks.push_back(chunk);
+    }
+}
+
+/************************************************************************/
+/*                         InitMultiThreading()                         */
+/************************************************************************/
+
+/** Enable multi-threaded decompression if GDAL_NUM_THREADS is set, and the
+ * file has an index or is a BGZF file.
+ */
+void VSIGZipHandle::InitMultiThreading()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszThreads || m_transparent || m_poBaseHandle == nullptr)
+        return;
+    int nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+    nThreads = std::max(1, std::min(128, nThreads));
+    if (nThreads <= 1)
+        return;
+
+    if (!m_poIndex)
+    {
+        Byte abyHeader[18];
+        size_t nBlockSize = 0;
+        const vsi_l_offset nCurPos = m_poBaseHandle->Tell();
+        if (m_poBaseHandle->Seek(0, SEEK_SET) != 0 ||
+            m_poBaseHandle->Read(abyHeader, 1, sizeof(abyHeader)) !=
+                sizeof(abyHeader) ||
+            !GetBGZFBlockSize(abyHeader, sizeof(abyHeader), nBlockSize))
+        {
+            m_poBaseHandle->Seek(nCurPos, SEEK_SET);
+            return;
+        }
+        m_poBaseHandle->Seek(nCurPos, SEEK_SET);
+        m_bBGZF = true;
+    }
+    else if (m_aoChunks.empty())
+    {
+        return;
+    }
+    m_nThreads = nThreads;
+}
+
+/************************************************************************/
+/*                        DiscoverNextBGZFMember()                      */
+/************************************************************************/
+
+/** Read the next member of a BGZF file, and append it to m_aoChunks if it is
+ * not empty.
+ *
+ * @return false if there is no more member, or if it is not a BGZF member.
+ */
+bool VSIGZipHandle::DiscoverNextBGZFMember(std::vector<Byte> &abyData)
+{
+    if (m_bBGZFDiscoveryComplete || !m_bBGZF)
+        return false;
+    if (m_nNextBGZFMemberPos >= offsetEndCompressedData)
+    {
+        m_bBGZFDiscoveryComplete = true;
+        if (m_uncompressed_size == 0)
+            m_uncompressed_size = m_nNextBGZFMemberOut;
+        return false;
+    }
+
+    Byte abyHeader[18];
+    size_t nBlockSize = 0;
+    if (m_poBaseHandle->Seek(m_nNextBGZFMemberPos, SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(abyHeader, 1, sizeof(abyHeader)) !=
+            sizeof(abyHeader) ||
+        !GetBGZFBlockSize(abyHeader, sizeof(abyHeader), nBlockSize) ||
+        nBlockSize > offsetEndCompressedData - m_nNextBGZFMemberPos)
+    {
+        CPLDebug("GZIP",
+                 "Not a BGZF member at offset " CPL_FRMT_GUIB
+                 ". Falling back to serial decompression",
+                 static_cast<GUIntBig>(m_nNextBGZFMemberPos));
+        m_bBGZF = false;
+        return false;
+    }
+
+    abyData.resize(nBlockSize);
+    memcpy(abyData.data(), abyHeader, sizeof(abyHeader));
+    if (m_poBaseHandle->Read(abyData.data() + sizeof(abyHeader), 1,
+                             nBlockSize - sizeof(abyHeader)) !=
+        nBlockSize - sizeof(abyHeader))
+    {
+        m_bBGZF = false;
+        return false;
+    }
+    uint32_t nUncompressedSize = 0;
+    memcpy(&nUncompressedSize, abyData.data() + nBlockSize - 4,
+           sizeof(nUncompressedSize));
+    CPL_LSBPTR32(&nUncompressedSize);
+
+    if (nUncompressedSize > 0)
+    {
+        VSIGZipChunk chunk;
+        chunk.nPosInBaseHandle = m_nNextBGZFMemberPos;
+        chunk.nCompressedSize = nBlockSize;
+        chunk.nOut = m_nNextBGZFMemberOut;
+        chunk.nOutSize = nUncompressedSize;
+        m_aoChunks.push_back(chunk);
+    }
+    m_nNextBGZFMemberPos += nBlockSize;
+    m_nNextBGZFMemberOut += nUncompressedSize;
+    return true;
+}
+
+/************************************************************************/
+/*                            GetChunkIndex()                           */
+/************************************************************************/
+
+/** Return the index in m_aoChunks of the chunk containing nOffset */
+bool VSIGZipHandle::GetChunkIndex(vsi_l_offset nOffset, size_t &nChunkIdx)
+{
+    while (m_aoChunks.empty() ||
+           nOffset >= m_aoChunks.back().nOut + m_aoChunks.back().nOutSize)
+    {
+        std::vector<Byte> abyIgnored;
+        if (m_poIndex || !DiscoverNextBGZFMember(abyIgnored))
+            return false;
+    }
+    auto oIter = std::upper_bound(m_aoChunks.begin(), m_aoChunks.end(),
+                                  nOffset,
+                                  [](vsi_l_offset nVal, const VSIGZipChunk &c)
+                                  { return nVal < c.nOut; });
+    if (oIter == m_aoChunks.begin())
+        return false;
+    nChunkIdx = static_cast<size_t>(oIter - m_aoChunks.begin()) - 1;
+    return nOffset < m_aoChunks[nChunkIdx].nOut +
+                         m_aoChunks[nChunkIdx].nOutSize;
+}
+
+/************************************************************************/
+/*                             DecodeChunk()                            */
+/************************************************************************/
+
+static bool DecodeChunk(const VSIGZipChunk &chunk, const VSIGZipIndex *poIndex,
+                        VSIGZipDecodeJob &job)
+{
+    const Byte *pabyIn = job.abyIn.data();
+    size_t nInSize = job.abyIn.size();
+    bool bCheckCRC = false;
+    uint32_t nExpectedCRC = 0;
+    uLong nInitialCRC = 0;
+    if (chunk.nAccessPoint < 0)
+    {
+        // BGZF member: skip the gzip header, and check the trailer
+        const size_t nHeaderSize = GetGZipHeaderSize(pabyIn, nInSize);
+        if (nHeaderSize == 0 || nInSize < nHeaderSize + 8)
+            return false;
+        memcpy(&nExpectedCRC, pabyIn + nInSize - 8, sizeof(nExpectedCRC));
+        CPL_LSBPTR32(&nExpectedCRC);
+        bCheckCRC = true;
+        pabyIn += nHeaderSize;
+        nInSize -= nHeaderSize + 8;
+    }
+
+    try
+    {
+        job.abyOut.resize(chunk.nOutSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return false;
+    }
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return false;
+
+    bool bOK = true;
+    if (chunk.nAccessPoint >= 0)
+    {
+        const auto &point = poIndex->points[chunk.nAccessPoint];
+        if (point.bits)
+            bOK = inflatePrime(&sStream, point.bits, point.value) == Z_OK;
+        if (bOK && !point.compressedWindow.empty())
+        {
+            std::vector<Byte> abyWindow(GZIP_WINDOW_SIZE);
+            size_t nWindowSize = 0;
+            bOK = CPLZLibInflate(point.compressedWindow.data(),
+                                 point.compressedWindow.size(),
+                                 abyWindow.data(), abyWindow.size(),
+                                 &nWindowSize) != nullptr &&
+                  inflateSetDictionary(&sStream, abyWindow.data(),
+                                       static_cast<uInt>(nWindowSize)) == Z_OK;
+        }
+    }
+
+    if (bOK)
+    {
+        sStream.next_in = const_cast<Byte *>(pabyIn);
+        sStream.avail_in = static_cast<uInt>(nInSize);
+        sStream.next_out = job.abyOut.data();
+        sStream.avail_out = static_cast<uInt>(chunk.nOutSize);
+        int nRet;
+        do
+        {
+            nRet = inflate(&sStream, Z_NO_FLUSH);
+        } while (nRet == Z_OK && sStream.avail_out > 0 && sStream.avail_in > 0);
+        bOK = sStream.avail_out == 0 && (nRet == Z_OK || nRet == Z_STREAM_END);
+
+        if (bOK && chunk.nAccessPoint >= 0)
+        {
+            // The CRC32 of the data of the member up to the end of the chunk
+            // is either in the trailer of the member, if the chunk ends
+            // with it, or recorded in the next access point.
+            const auto &points = poIndex->points;
+            const size_t iNext = static_cast<size_t>(chunk.nAccessPoint) + 1;
+            nInitialCRC = points[chunk.nAccessPoint].crc;
+            if (nRet == Z_STREAM_END)
+            {
+                if (sStream.avail_in >= 4)
+                {
+                    memcpy(&nExpectedCRC, sStream.next_in,
+                           sizeof(nExpectedCRC));
+                    CPL_LSBPTR32(&nExpectedCRC);
+                    bCheckCRC = true;
+                }
+            }
+            // Access points at the start of a member have an empty window
+            // and a zero CRC. Skip the check if we cannot know.
+            else if (iNext < points.size() &&
+                     !(points[iNext].compressedWindow.empty() &&
+                       points[iNext].bits == 0 && points[iNext].crc == 0))
+            {
+                nExpectedCRC = static_cast<uint32_t>(points[iNext].crc);
+                bCheckCRC = true;
+            }
+        }
+    }
+    inflateEnd(&sStream);
+
+    if (bOK && bCheckCRC)
+    {
+        bOK = crc32(nInitialCRC, job.abyOut.data(),
+                    static_cast<uInt>(chunk.nOutSize)) == nExpectedCRC;
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                          SubmitDecodeJobs()                          */
+/************************************************************************/
+
+/** Make sure that decompression jobs are submitted for the chunks following
+ * (and including) nFirstChunkIdx, within the read-ahead window.
+ */
+void VSIGZipHandle::SubmitDecodeJobs(size_t nFirstChunkIdx)
+{
+    const size_t nReadAhead = static_cast<size_t>(2 * m_nThreads);
+
+    // Forget about jobs outside of the window
+    for (auto oIter = m_oMapJobs.begin(); oIter != m_oMapJobs.end();)
+    {
+        if (oIter->first < nFirstChunkIdx ||
+            oIter->first >= nFirstChunkIdx + nReadAhead)
+            oIter = m_oMapJobs.erase(oIter);
+        else
+            ++oIter;
+    }
+
+    for (size_t i = nFirstChunkIdx; i < nFirstChunkIdx + nReadAhead; ++i)
+    {
+        std::vector<Byte> abyIn;
+        while (i >= m_aoChunks.size())
+        {
+            if (m_poIndex || !DiscoverNextBGZFMember(abyIn))
+                return;
+        }
+        if (m_oMapJobs.find(i) != m_oMapJobs.end())
+            continue;
+
+        const VSIGZipChunk &chunk = m_aoChunks[i];
+        if (abyIn.empty())
+        {
+            try
+            {
+                abyIn.resize(chunk.nCompressedSize);
+            }
+            catch (const std::bad_alloc &)
+            {
+                return;
+            }
+            if (m_poBaseHandle->Seek(chunk.nPosInBaseHandle, SEEK_SET) != 0 ||
+                m_poBaseHandle->Read(abyIn.data(), 1, abyIn.size()) !=
+                    abyIn.size())
+            {
+                return;
+            }
+        }
+
+        auto poJob = std::make_shared<VSIGZipDecodeJob>();
+        poJob->abyIn = std::move(abyIn);
+        m_oMapJobs[i] = poJob;
+        auto poIndex = m_poIndex;
+        m_poJobQueue->SubmitJob(
+            [poJob, chunk, poIndex]()
+            {
+                poJob->bOK = DecodeChunk(chunk, poIndex.get(), *poJob);
+                poJob->abyIn.clear();
+                poJob->bDone = true;
+            });
+    }
+}
+
+/************************************************************************/
+/*                          ReadMultiThreaded()                         */
+/************************************************************************/
+
+/** Read nToRead bytes at the current position, from chunks decompressed by
+ * worker threads.
+ *
+ * bFallbackToSerial is set if the remaining of the file can't be
+ * decompressed by chunks (i.e. a BGZF file with non-BGZF members).
+ */
+size_t VSIGZipHandle::ReadMultiThreaded(Byte *pabyBuffer, size_t nToRead,
+                                        bool &bFallbackToSerial)
+{
+    if (!m_poJobQueue)
+    {
+        VSIFilesystemHandler *poFSHandler =
+            VSIFileManager::GetHandler("/vsigzip/");
+        CPLWorkerThreadPool *poPool =
+            cpl::down_cast<VSIGZipFilesystemHandler *>(poFSHandler)
+                ->GetThreadPool(m_nThreads);
+        if (!poPool)
+        {
+            m_nThreads = 0;
+            m_bSerialStateDirty = true;
+            bFallbackToSerial = true;
+            return 0;
+        }
+        m_poJobQueue = poPool->CreateJobQueue();
+    }
+
+    m_bSerialStateDirty = true;
+    size_t nRead = 0;
+    while (nRead < nToRead)
+    {
+        size_t nChunkIdx = 0;
+        if (!GetChunkIndex(out, nChunkIdx))
+        {
+            if (!m_poIndex && !m_bBGZF)
+            {
+                // Not a BGZF member: disable multi-threading
+                m_poJobQueue.reset();
+                m_oMapJobs.clear();
+                m_nThreads = 0;
+                bFallbackToSerial = true;
+            }
+            break;
+        }
+
+        SubmitDecodeJobs(nChunkIdx);
+        auto oIter = m_oMapJobs.find(nChunkIdx);
+        if (oIter == m_oMapJobs.end())
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read compressed data");
+            z_err = Z_ERRNO;
+            break;
+        }
+        const auto poJob = oIter->second;
+        while (!poJob->bDone)
+            m_poJobQueue->WaitEvent();
+        if (!poJob->bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "In %s, decompression of chunk at offset " CPL_FRMT_GUIB
+                     " failed",
+                     m_pszBaseFileName,
+                     static_cast<GUIntBig>(
+                         m_aoChunks[nChunkIdx].nPosInBaseHandle));
+            z_err = Z_DATA_ERROR;
+            m_oMapJobs.erase(oIter);
+            break;
+        }
+
+        const VSIGZipChunk &chunk = m_aoChunks[nChunkIdx];
+        const size_t nOffsetInChunk = static_cast<size_t>(out - chunk.nOut);
+        const size_t nToCopy =
+            std::min(nToRead - nRead, chunk.nOutSize - nOffsetInChunk);
+        memcpy(pabyBuffer + nRead, poJob->abyOut.data() + nOffsetInChunk,
+               nToCopy);
+        nRead += nToCopy;
+        out += nToCopy;
+    }
+    return nRead;
+}
+
 /************************************************************************/
 /*                              Write()                                 */
 /************************************************************************/
@@ -2982,6 +4023,24 @@ VSIGZipFilesystemHandler::~VSIGZipFilesystemHandler()
     hMutex = nullptr;
 }
 
+/************************************************************************/
+/*                           GetThreadPool()                            */
+/************************************************************************/
+
+/** Return the thread pool shared by all handles for multi-threaded
+ * decompression, with at least nThreads threads.
+ */
+CPLWorkerThreadPool *VSIGZipFilesystemHandler::GetThreadPool(int nThreads)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexPool);
+    if (!m_poPool)
+        m_poPool = std::make_unique<CPLWorkerThreadPool>();
+    // Threads are only started when needed
+    if (!m_poPool->Setup(nThreads, nullptr, nullptr, false))
+        return nullptr;
+    return m_poPool.get();
+}
+
 /************************************************************************/
 /*                            SaveInfo()                                */
 /************************************************************************/
@@ -3151,6 +4210,8 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
         delete poHandle;
         return nullptr;
     }
+    poHandle->InitIndex();
+    poHandle->InitMultiThreading();
     return poHandle;
 }
 
@@ -3276,11 +4337,18 @@ const char *VSIGZipFilesystemHandler::GetOptions()
 {
     return "<Options>"
            "  <Option name='GDAL_NUM_THREADS' type='string' "
-           "description='Number of threads for compression. Either a integer "
+           "description='Number of threads for compression, and for "
+           "decompression of BGZF or indexed files. Either a integer "
            "or ALL_CPUS'/>"
            "  <Option name='CPL_VSIL_DEFLATE_CHUNK_SIZE' type='string' "
            "description='Chunk of uncompressed data for parallelization. "
            "Use K(ilobytes) or M(egabytes) suffix' default='1M'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX' type='boolean' "
+           "description='Whether to use, and build if missing, a .gz.gzidx "
+           "random access index' default='NO'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX_SPAN' type='string' "
+           "description='Spacing of access points in the uncompressed "
+           "stream. Use K(ilobytes) or M(egabytes) suffix' default='1M'/>"
            "</Options>";
 }
 
@@ -3328,6 +4396,17 @@ class VSIZipEntryFileOffset final : public VSIArchiveEntryFileOffset
         m_file_pos.pos_in_zip_directory = file_pos.pos_in_zip_directory;
         m_file_pos.num_of_file = file_pos.num_of_file;
     }
+
+    bool Serialize(std::string &osData) const override
+    {
+        uint64_t anVals[2] = {
+            static_cast<uint64_t>(m_file_pos.pos_in_zip_directory),
+            static_cast<uint64_t>(m_file_pos.num_of_file)};
+        CPL_LSBPTR64(&anVals[0]);
+        CPL_LSBPTR64(&anVals[1]);
+        osData.assign(reinterpret_cast<const char *>(anVals), sizeof(anVals));
+        return true;
+    }
 };
 
 /************************************************************************/
@@ -3540,6 +4619,8 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
 
     std::vector<CPLString> GetExtensions() override;
     VSIArchiveReader *CreateReader(const char *pszZipFileName) override;
+    VSIArchiveEntryFileOffset *
+    DeserializeFileOffset(const std::string &osData) override;
 
     VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
                            bool bSetError,
@@ -3702,6 +4783,25 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
     return poReader;
 }
 
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+VSIArchiveEntryFileOffset *
+VSIZipFilesystemHandler::DeserializeFileOffset(const std::string &osData)
+{
+    uint64_t anVals[2] = {0, 0};
+    if (osData.size() != sizeof(anVals))
+        return nullptr;
+    memcpy(anVals, osData.data(), sizeof(anVals));
+    CPL_LSBPTR64(&anVals[0]);
+    CPL_LSBPTR64(&anVals[1]);
+    unz_file_pos file_pos;
+    file_pos.pos_in_zip_directory = static_cast<uLong64>(anVals[0]);
+    file_pos.num_of_file = static_cast<uLong64>(anVals[1]);
+    return new VSIZipEntryFileOffset(file_pos);
+}
+
 /************************************************************************/
 /*                         VSISOZipHandle                               */
 /************************************************************************/
@@ -765,6 +765,42 @@ VSIMultipartWriteHandle::VSIMultipartWriteHandle(
                  "Cannot allocate working buffer for %s",
                  m_poFS->GetFSPrefix().c_str());
     }
+
+#ifndef CPL_MULTIPROC_STUB
+    // Number of parts that may be uploaded concurrently, while the next
+    // one is being filled.
+    const char *pszNumThreads = m_aosOptions.FetchNameValue("NUM_THREADS");
+    if (!pszNumThreads)
+        pszNumThreads = VSIGetPathSpecificOption(
+            pszFilename, "CPL_VSIL_CURL_UPLOAD_NUM_THREADS", "1");
+    m_nMaxInFlightParts = EQUAL(pszNumThreads, "ALL_CPUS")
+                              ? CPLGetNumCPUs()
+                              : atoi(pszNumThreads);
+    const char *pszMaxMemory = VSIGetPathSpecificOption(
+        pszFilename, "CPL_VSIL_CURL_UPLOAD_MAX_MEMORY", nullptr);
+    if (m_nMaxInFlightParts > 1 && pszMaxMemory && m_nBufferSize > 0)
+    {
+        GIntBig nMaxMemory = 0;
+        if (CPLParseMemorySize(pszMaxMemory, &nMaxMemory, nullptr) ==
+                CE_None &&
+            nMaxMemory > 0)
+        {
+            // One buffer is being filled while the other ones are uploaded
+            const GIntBig nMaxBuffers =
+                nMaxMemory / static_cast<GIntBig>(m_nBufferSize);
+            m_nMaxInFlightParts = static_cast<int>(
+                std::min<GIntBig>(m_nMaxInFlightParts,
+                                  std::max<GIntBig>(1, nMaxBuffers - 1)));
+        }
+        else
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value for CPL_VSIL_CURL_UPLOAD_MAX_MEMORY: %s",
+                     pszMaxMemory);
+        }
+    }
+    m_nMaxInFlightParts = std::max(1, m_nMaxInFlightParts);
+#endif
 }
 
 /************************************************************************/
@@ -838,8 +874,11 @@ size_t IVSIS3LikeFSHandlerWithMultipartUpload::GetUploadChunkSizeInBytes(
 VSIMultipartWriteHandle::~VSIMultipartWriteHandle()
 {
     VSIMultipartWriteHandle::Close();
+    m_poThreadPool.reset();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     CPLFree(m_sWriteFuncHeaderData.pBuffer);
 }
 
@@ -1009,6 +1048,8 @@ bool VSIMultipartWriteHandle::UploadPart()
                  m_poFS->GetDebugKey());
         return false;
     }
+    if (m_nMaxInFlightParts > 1)
+        return UploadPartAsync();
     const std::string osEtag = m_poFS->UploadPart(
         m_osFilename, m_nPartNumber, m_osUploadID,
         static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
@@ -1022,6 +1063,132 @@ bool VSIMultipartWriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                         UploadPartAsync()                            */
+/************************************************************************/
+
+// Hands over the current buffer to a worker thread, and continues with a
+// new (or recycled) buffer, after waiting for the number of parts in
+// flight to be below m_nMaxInFlightParts, which bounds memory usage.
+// Each job uses its own handle helper, as UploadPart() modifies its query
+// parameters. ETags are stored by part number, so that they are sent in
+// order by CompleteMultipart() whatever the completion order of parts.
+
+bool VSIMultipartWriteHandle::UploadPartAsync()
+{
+    if (!m_poThreadPool)
+    {
+        m_poThreadPool =
+            std::make_unique<CPLWorkerThreadPool>(m_nMaxInFlightParts);
+    }
+    m_poThreadPool->WaitCompletion(m_nMaxInFlightParts - 1);
+    if (m_bAsyncError)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Upload of a previous part of %s failed",
+                 m_osFilename.c_str());
+        return false;
+    }
+
+    GByte *pabyNewBuffer = nullptr;
+    std::unique_ptr<IVSIS3LikeHandleHelper> poHandleHelper;
+    {
+        std::lock_guard oLock(m_oMutexAsync);
+        if (!m_apabyFreeBuffers.empty())
+        {
+            pabyNewBuffer = m_apabyFreeBuffers.back();
+            m_apabyFreeBuffers.pop_back();
+        }
+        if (!m_apoFreeHandleHelpers.empty())
+        {
+            poHandleHelper = std::move(m_apoFreeHandleHelpers.back());
+            m_apoFreeHandleHelpers.pop_back();
+        }
+    }
+    if (!poHandleHelper)
+    {
+        poHandleHelper.reset(m_poFS->CreateHandleHelper(
+            m_osFilename.c_str() + m_poFS->GetFSPrefix().size(), false));
+    }
+    if (!pabyNewBuffer)
+    {
+        pabyNewBuffer = static_cast<GByte *>(VSIMalloc(m_nBufferSize));
+        if (!pabyNewBuffer)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate working buffer for %s",
+                     m_poFS->GetFSPrefix().c_str());
+        }
+    }
+    if (!pabyNewBuffer || !poHandleHelper)
+    {
+        CPLFree(pabyNewBuffer);
+        return false;
+    }
+
+    GByte *pabyPart = m_pabyBuffer;
+    const size_t nPartSize = m_nBufferOff;
+    const int nPartNumber = m_nPartNumber;
+    m_pabyBuffer = pabyNewBuffer;
+    m_nBufferOff = 0;
+
+    IVSIS3LikeHandleHelper *poHandleHelperJob = poHandleHelper.release();
+    const auto job =
+        [this, pabyPart, nPartSize, nPartNumber, poHandleHelperJob]()
+    {
+        std::unique_ptr<IVSIS3LikeHandleHelper> poJobHelper(poHandleHelperJob);
+        const std::string osEtag = m_poFS->UploadPart(
+            m_osFilename, nPartNumber, m_osUploadID,
+            static_cast<vsi_l_offset>(m_nBufferSize) * (nPartNumber - 1),
+            pabyPart, nPartSize, poJobHelper.get(), m_oRetryParameters,
+            nullptr);
+
+        std::lock_guard oLock(m_oMutexAsync);
+        if (osEtag.empty())
+        {
+            m_bAsyncError = true;
+        }
+        else
+        {
+            if (m_aosEtags.size() < static_cast<size_t>(nPartNumber))
+                m_aosEtags.resize(nPartNumber);
+            m_aosEtags[nPartNumber - 1] = osEtag;
+        }
+        m_apabyFreeBuffers.push_back(pabyPart);
+        m_apoFreeHandleHelpers.push_back(std::move(poJobHelper));
+    };
+    if (!m_poThreadPool->SubmitJob(job))
+    {
+        delete poHandleHelperJob;
+        CPLFree(pabyPart);
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        WaitForPendingParts()                         */
+/************************************************************************/
+
+bool VSIMultipartWriteHandle::WaitForPendingParts()
+{
+    if (!m_poThreadPool)
+        return true;
+    m_poThreadPool->WaitCompletion();
+    if (m_bAsyncError)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Upload of at least one part of %s failed",
+                 m_osFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           UploadPart()                               */
+/************************************************************************/
+
 std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
     const std::string &osFilename, int nPartNumber,
     const std::string &osUploadID, vsi_l_offset /* nPosition */,
@@ -1727,13 +1894,30 @@ int VSIMultipartWriteHandle::Close()
         {
             if (m_bError)
             {
+                if (m_poThreadPool)
+                    m_poThreadPool->WaitCompletion();
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
                                             m_poS3HandleHelper,
                                             m_oRetryParameters))
                     nRet = -1;
             }
             else if (m_nBufferOff > 0 && !UploadPart())
+            {
+                if (m_poThreadPool)
+                {
+                    m_poThreadPool->WaitCompletion();
+                    m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
+                                           m_poS3HandleHelper,
+                                           m_oRetryParameters);
+                }
                 nRet = -1;
+            }
+            else if (!WaitForPendingParts())
+            {
+                m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
+                                       m_poS3HandleHelper, m_oRetryParameters);
+                nRet = -1;
+            }
             else if (m_poFS->CompleteMultipart(
                          m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
                          m_poS3HandleHelper, m_oRetryParameters))
@@ -69,8 +69,26 @@ class VSITarEntryFileOffset final : public VSIArchiveEntryFileOffset
     {
     }
 #endif
+
+    bool Serialize(std::string &osData) const override;
 };
 
+/************************************************************************/
+/*                             Serialize()                              */
+/************************************************************************/
+
+bool VSITarEntryFileOffset::Serialize(std::string &osData) const
+{
+#ifdef HAVE_FUZZER_FRIENDLY_ARCHIVE
+    if (!m_osFileName.empty())
+        return false;
+#endif
+    uint64_t nOffset = m_nOffset;
+    CPL_LSBPTR64(&nOffset);
+    osData.assign(reinterpret_cast<const char *>(&nOffset), sizeof(nOffset));
+    return true;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                             VSITarReader                             */
@@ -492,6 +510,8 @@ class VSITarFilesystemHandler final : public VSIArchiveFilesystemHandler
 
     std::vector<CPLString> GetExtensions() override;
     VSIArchiveReader *CreateReader(const char *pszTarFileName) override;
+    VSIArchiveEntryFileOffset *
+    DeserializeFileOffset(const std::string &osData) override;
 
     VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
                            bool bSetError,
@@ -545,6 +565,24 @@ VSITarFilesystemHandler::CreateReader(const char *pszTarFileName)
     return poReader;
 }
 
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+VSIArchiveEntryFileOffset *
+VSITarFilesystemHandler::DeserializeFileOffset(const std::string &osData)
+{
+    uint64_t nOffset = 0;
+    if (osData.size() != sizeof(nOffset))
+        return nullptr;
+    memcpy(&nOffset, osData.data(), sizeof(nOffset));
+    CPL_LSBPTR64(&nOffset);
+    // The offset is the one of the data of the file, after its header
+    if (nOffset < 512)
+        return nullptr;
+    return new VSITarEntryFileOffset(static_cast<GUIntBig>(nOffset));
+}
+
 /************************************************************************/
 /*                                 Open()                               */
 /************************************************************************/
@@ -0,0 +1,703 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Implement /vsitrace/ file system, recording I/O operations
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+// /vsitrace/{path} forwards all operations to {path}, and records the
+// opening, seeking and reading of files, as well as VSIStatL() and
+// VSIReadDir() calls, into the file pointed by CPL_VSIL_TRACE_FILE, or as
+// debug messages if that option is not set. That option is checked at each
+// Open(), Stat() and ReadDir() call, so that it can be changed at runtime.
+// The trace file is made of a 8-byte "GDALVTR1" signature, followed by
+// records, whose integers are stored as LSB:
+// - uint8: record type (see TraceRecordType)
+// - uint32: thread number (sequential, in the order of their first record)
+// - uint32: handle number (sequential, 0 for Stat and ReadDir)
+// - uint64: start time in nanoseconds, since the handler installation
+// - uint64: duration in nanoseconds
+// - then depending on the record type:
+//   - OPEN: uint8 success flag, uint32 filename size, filename (of the
+//     underlying file), uint32 access size, access
+//   - CLOSE: nothing
+//   - SEEK: uint64 offset after the seek
+//   - READ: uint64 offset, uint64 requested size, uint64 read size
+//   - READ_MULTI_RANGE: int32 return code, uint32 number of ranges, then
+//     uint64 offset and uint64 size for each range
+//   - STAT, READDIR: int32 return code (number of entries for READDIR),
+//     uint32 filename size, filename
+// perftests/vsitrace_replay.cpp summarizes and replays such files.
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+constexpr const char TRACE_SIGNATURE[] = "GDALVTR1";
+constexpr size_t TRACE_SIGNATURE_SIZE = 8;
+constexpr const char TRACE_PREFIX[] = "/vsitrace/";
+
+enum class TraceRecordType : GByte
+{
+    OPEN = 1,
+    CLOSE = 2,
+    SEEK = 3,
+    READ = 4,
+    READ_MULTI_RANGE = 5,
+    STAT = 6,
+    READDIR = 7,
+};
+
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSITraceWriter                            */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSITraceWriter
+{
+    std::mutex m_oMutex{};
+    VSILFILE *m_fp = nullptr;
+    std::string m_osTraceFilename{};
+    std::string m_osBuffer{};
+    bool m_bInitDone = false;
+    const std::chrono::steady_clock::time_point m_oStart =
+        std::chrono::steady_clock::now();
+    std::atomic<uint32_t> m_nHandleCounter{0};
+
+    CPL_DISALLOW_COPY_ASSIGN(VSITraceWriter)
+
+    void AppendRecordUnlocked(TraceRecordType eType, uint32_t nThread,
+                              uint32_t nHandle, uint64_t nStart,
+                              uint64_t nDuration, const std::string &osPayload);
+    void FlushUnlocked();
+
+  public:
+    VSITraceWriter() = default;
+    ~VSITraceWriter();
+
+    static uint32_t GetThreadNumber();
+
+    uint32_t GetNewHandleNumber()
+    {
+        return ++m_nHandleCounter;
+    }
+
+    uint64_t GetTimeInNS() const
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_oStart)
+                .count());
+    }
+
+    void UpdateFromConfig();
+    void Flush();
+
+    // DescriptionFunc returns a std::string only used when tracing as debug
+    // messages, so that formatting is not paid when writing a trace file.
+    template <class DescriptionFunc>
+    void AddRecord(TraceRecordType eType, uint32_t nHandle, uint64_t nStart,
+                   const std::string &osPayload,
+                   const DescriptionFunc &describe)
+    {
+        const uint64_t nDuration = GetTimeInNS() - nStart;
+        const uint32_t nThread = GetThreadNumber();
+
+        std::lock_guard oLock(m_oMutex);
+        if (m_fp)
+        {
+            AppendRecordUnlocked(eType, nThread, nHandle, nStart, nDuration,
+                                 osPayload);
+        }
+        else if (m_osTraceFilename.empty())
+        {
+            CPLDebug("VSITRACE", "thread=%u handle=%u t=%.6f dt=%.6f %s",
+                     nThread, nHandle, static_cast<double>(nStart) * 1e-9,
+                     static_cast<double>(nDuration) * 1e-9,
+                     describe().c_str());
+        }
+    }
+};
+
+/************************************************************************/
+/*                          ~VSITraceWriter()                           */
+/************************************************************************/
+
+VSITraceWriter::~VSITraceWriter()
+{
+    if (m_fp)
+    {
+        FlushUnlocked();
+        VSIFCloseL(m_fp);
+    }
+}
+
+/************************************************************************/
+/*                          GetThreadNumber()                           */
+/************************************************************************/
+
+uint32_t VSITraceWriter::GetThreadNumber()
+{
+    static std::atomic<uint32_t> gnThreadCounter{0};
+    thread_local uint32_t nThreadNumber = ++gnThreadCounter;
+    return nThreadNumber;
+}
+
+/************************************************************************/
+/*                          UpdateFromConfig()                          */
+/************************************************************************/
+
+void VSITraceWriter::UpdateFromConfig()
+{
+    const std::string osTraceFile(
+        CPLGetConfigOption("CPL_VSIL_TRACE_FILE", ""));
+
+    std::lock_guard oLock(m_oMutex);
+    if (m_bInitDone && osTraceFile == m_osTraceFilename)
+        return;
+    m_bInitDone = true;
+    if (m_fp)
+    {
+        FlushUnlocked();
+        VSIFCloseL(m_fp);
+        m_fp = nullptr;
+    }
+    m_osTraceFilename = osTraceFile;
+    if (osTraceFile.empty())
+        return;
+    if (STARTS_WITH(osTraceFile.c_str(), TRACE_PREFIX))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "CPL_VSIL_TRACE_FILE cannot be a /vsitrace/ file");
+        return;
+    }
+    m_fp = VSIFOpenL(osTraceFile.c_str(), "wb");
+    if (!m_fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osTraceFile.c_str());
+        return;
+    }
+    m_osBuffer.append(TRACE_SIGNATURE, TRACE_SIGNATURE_SIZE);
+}
+
+/************************************************************************/
+/*                        AppendRecordUnlocked()                        */
+/************************************************************************/
+
+void VSITraceWriter::AppendRecordUnlocked(TraceRecordType eType,
+                                          uint32_t nThread, uint32_t nHandle,
+                                          uint64_t nStart, uint64_t nDuration,
+                                          const std::string &osPayload)
+{
+    const auto AppendUInt32 = [this](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        m_osBuffer.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    const auto AppendUInt64 = [this](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        m_osBuffer.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    m_osBuffer.push_back(static_cast<char>(eType));
+    AppendUInt32(nThread);
+    AppendUInt32(nHandle);
+    AppendUInt64(nStart);
+    AppendUInt64(nDuration);
+    m_osBuffer.append(osPayload);
+    if (m_osBuffer.size() >= 65536)
+        FlushUnlocked();
+}
+
+/************************************************************************/
+/*                               Flush()                                */
+/************************************************************************/
+
+void VSITraceWriter::Flush()
+{
+    std::lock_guard oLock(m_oMutex);
+    if (m_fp)
+    {
+        FlushUnlocked();
+        m_fp->Flush();
+    }
+}
+
+/************************************************************************/
+/*                           FlushUnlocked()                            */
+/************************************************************************/
+
+void VSITraceWriter::FlushUnlocked()
+{
+    if (!m_osBuffer.empty() &&
+        VSIFWriteL(m_osBuffer.data(), 1, m_osBuffer.size(), m_fp) !=
+            m_osBuffer.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                 m_osTraceFilename.c_str());
+    }
+    m_osBuffer.clear();
+}
+
+/************************************************************************/
+/*                          Payload helpers                             */
+/************************************************************************/
+
+void AppendUInt32(std::string &osPayload, uint32_t nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    osPayload.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+void AppendUInt64(std::string &osPayload, uint64_t nVal)
+{
+    CPL_LSBPTR64(&nVal);
+    osPayload.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+void AppendString(std::string &osPayload, const std::string &osStr)
+{
+    AppendUInt32(osPayload, static_cast<uint32_t>(osStr.size()));
+    osPayload.append(osStr);
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSITraceHandle                            */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSITraceHandle final : public VSIVirtualHandle
+{
+    VSIVirtualHandleUniquePtr m_poBaseHandle;
+    VSITraceWriter &m_oWriter;
+    const uint32_t m_nHandle;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSITraceHandle)
+
+  public:
+    VSITraceHandle(VSIVirtualHandleUniquePtr &&poBaseHandle,
+                   VSITraceWriter &oWriter, uint32_t nHandle)
+        : m_poBaseHandle(std::move(poBaseHandle)), m_oWriter(oWriter),
+          m_nHandle(nHandle)
+    {
+    }
+
+    ~VSITraceHandle() override;
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+
+    vsi_l_offset Tell() override
+    {
+        return m_poBaseHandle->Tell();
+    }
+
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override
+    {
+        m_poBaseHandle->AdviseRead(nRanges, panOffsets, panSizes);
+    }
+
+    size_t GetAdviseReadTotalBytesLimit() const override
+    {
+        return m_poBaseHandle->GetAdviseReadTotalBytesLimit();
+    }
+
+    size_t Write(const void *pBuffer, size_t nSize, size_t nCount) override
+    {
+        return m_poBaseHandle->Write(pBuffer, nSize, nCount);
+    }
+
+    void ClearErr() override
+    {
+        m_poBaseHandle->ClearErr();
+    }
+
+    int Eof() override
+    {
+        return m_poBaseHandle->Eof();
+    }
+
+    int Error() override
+    {
+        return m_poBaseHandle->Error();
+    }
+
+    int Flush() override
+    {
+        return m_poBaseHandle->Flush();
+    }
+
+    int Close() override;
+
+    int Truncate(vsi_l_offset nNewSize) override
+    {
+        return m_poBaseHandle->Truncate(nNewSize);
+    }
+
+    void *GetNativeFileDescriptor() override
+    {
+        return m_poBaseHandle->GetNativeFileDescriptor();
+    }
+
+    VSIRangeStatus GetRangeStatus(vsi_l_offset nOffset,
+                                  vsi_l_offset nLength) override
+    {
+        return m_poBaseHandle->GetRangeStatus(nOffset, nLength);
+    }
+
+    bool HasPRead() const override
+    {
+        return m_poBaseHandle->HasPRead();
+    }
+
+    size_t PRead(void *pBuffer, size_t nSize,
+                 vsi_l_offset nOffset) const override;
+
+    bool HasPWrite() const override
+    {
+        return m_poBaseHandle->HasPWrite();
+    }
+
+    size_t PWrite(const void *pBuffer, size_t nSize,
+                  vsi_l_offset nOffset) override
+    {
+        return m_poBaseHandle->PWrite(pBuffer, nSize, nOffset);
+    }
+
+    void Interrupt() override
+    {
+        m_poBaseHandle->Interrupt();
+    }
+};
+
+/************************************************************************/
+/*                          ~VSITraceHandle()                           */
+/************************************************************************/
+
+VSITraceHandle::~VSITraceHandle()
+{
+    VSITraceHandle::Close();
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSITraceHandle::Close()
+{
+    if (!m_poBaseHandle)
+        return 0;
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    const int nRet = m_poBaseHandle->Close();
+    m_poBaseHandle.reset();
+    m_oWriter.AddRecord(TraceRecordType::CLOSE, m_nHandle, nStart,
+                        std::string(),
+                        []() { return std::string("Close()"); });
+    // Make the trace usable even if the process does not end gracefully
+    m_oWriter.Flush();
+    return nRet;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSITraceHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    const int nRet = m_poBaseHandle->Seek(nOffset, nWhence);
+    const vsi_l_offset nNewOffset = m_poBaseHandle->Tell();
+    std::string osPayload;
+    AppendUInt64(osPayload, nNewOffset);
+    m_oWriter.AddRecord(TraceRecordType::SEEK, m_nHandle, nStart, osPayload,
+                        [nNewOffset]()
+                        {
+                            return std::string(
+                                CPLSPrintf("Seek(" CPL_FRMT_GUIB ")",
+                                           static_cast<GUIntBig>(nNewOffset)));
+                        });
+    return nRet;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSITraceHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
+{
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    const vsi_l_offset nOffset = m_poBaseHandle->Tell();
+    const size_t nRet = m_poBaseHandle->Read(pBuffer, nSize, nCount);
+    std::string osPayload;
+    AppendUInt64(osPayload, nOffset);
+    AppendUInt64(osPayload, static_cast<uint64_t>(nSize) * nCount);
+    AppendUInt64(osPayload, static_cast<uint64_t>(nSize) * nRet);
+    m_oWriter.AddRecord(TraceRecordType::READ, m_nHandle, nStart, osPayload,
+                        [&]()
+                        {
+                            return std::string(CPLSPrintf(
+                                "Read(" CPL_FRMT_GUIB ", " CPL_FRMT_GUIB
+                                ") = " CPL_FRMT_GUIB,
+                                static_cast<GUIntBig>(nOffset),
+                                static_cast<GUIntBig>(nSize) * nCount,
+                                static_cast<GUIntBig>(nSize) * nRet));
+                        });
+    return nRet;
+}
+
+/************************************************************************/
+/*                               PRead()                                */
+/************************************************************************/
+
+size_t VSITraceHandle::PRead(void *pBuffer, size_t nSize,
+                             vsi_l_offset nOffset) const
+{
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    const size_t nRet = m_poBaseHandle->PRead(pBuffer, nSize, nOffset);
+    std::string osPayload;
+    AppendUInt64(osPayload, nOffset);
+    AppendUInt64(osPayload, nSize);
+    AppendUInt64(osPayload, nRet);
+    m_oWriter.AddRecord(TraceRecordType::READ, m_nHandle, nStart, osPayload,
+                        [&]()
+                        {
+                            return std::string(CPLSPrintf(
+                                "PRead(" CPL_FRMT_GUIB ", " CPL_FRMT_GUIB
+                                ") = " CPL_FRMT_GUIB,
+                                static_cast<GUIntBig>(nOffset),
+                                static_cast<GUIntBig>(nSize),
+                                static_cast<GUIntBig>(nRet)));
+                        });
+    return nRet;
+}
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSITraceHandle::ReadMultiRange(int nRanges, void **ppData,
+                                   const vsi_l_offset *panOffsets,
+                                   const size_t *panSizes)
+{
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    const int nRet =
+        m_poBaseHandle->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
+    std::string osPayload;
+    AppendUInt32(osPayload, static_cast<uint32_t>(nRet));
+    AppendUInt32(osPayload, static_cast<uint32_t>(nRanges));
+    GUIntBig nTotalSize = 0;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        AppendUInt64(osPayload, panOffsets[i]);
+        AppendUInt64(osPayload, panSizes[i]);
+        nTotalSize += panSizes[i];
+    }
+    m_oWriter.AddRecord(
+        TraceRecordType::READ_MULTI_RANGE, m_nHandle, nStart, osPayload,
+        [&]()
+        {
+            return std::string(CPLSPrintf(
+                "ReadMultiRange(%d ranges, " CPL_FRMT_GUIB " bytes) = %d",
+                nRanges, nTotalSize, nRet));
+        });
+    return nRet;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                      VSITraceFilesystemHandler                       */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSITraceFilesystemHandler final : public VSIFilesystemHandler
+{
+    VSITraceWriter m_oWriter{};
+
+    CPL_DISALLOW_COPY_ASSIGN(VSITraceFilesystemHandler)
+
+    static const char *GetUnderlyingFilename(const char *pszFilename)
+    {
+        if (!STARTS_WITH(pszFilename, TRACE_PREFIX))
+            return nullptr;
+        return pszFilename + strlen(TRACE_PREFIX);
+    }
+
+  public:
+    VSITraceFilesystemHandler() = default;
+
+    VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
+                           bool bSetError, CSLConstList papszOptions) override;
+    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
+             int nFlags) override;
+    char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
+
+    int Unlink(const char *pszFilename) override
+    {
+        const char *pszUnderlying = GetUnderlyingFilename(pszFilename);
+        return pszUnderlying ? VSIUnlink(pszUnderlying) : -1;
+    }
+
+    int Mkdir(const char *pszDirname, long nMode) override
+    {
+        const char *pszUnderlying = GetUnderlyingFilename(pszDirname);
+        return pszUnderlying ? VSIMkdir(pszUnderlying, nMode) : -1;
+    }
+
+    int Rmdir(const char *pszDirname) override
+    {
+        const char *pszUnderlying = GetUnderlyingFilename(pszDirname);
+        return pszUnderlying ? VSIRmdir(pszUnderlying) : -1;
+    }
+
+    bool IsLocal(const char *pszPath) override
+    {
+        const char *pszUnderlying = GetUnderlyingFilename(pszPath);
+        return pszUnderlying && VSIIsLocal(pszUnderlying);
+    }
+
+    char **GetFileMetadata(const char *pszFilename, const char *pszDomain,
+                           CSLConstList papszOptions) override
+    {
+        const char *pszUnderlying = GetUnderlyingFilename(pszFilename);
+        return pszUnderlying ? VSIGetFileMetadata(pszUnderlying, pszDomain,
+                                                  papszOptions)
+                             : nullptr;
+    }
+};
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+VSIVirtualHandle *VSITraceFilesystemHandler::Open(const char *pszFilename,
+                                                  const char *pszAccess,
+                                                  bool bSetError,
+                                                  CSLConstList papszOptions)
+{
+    const char *pszUnderlying = GetUnderlyingFilename(pszFilename);
+    if (!pszUnderlying)
+        return nullptr;
+
+    m_oWriter.UpdateFromConfig();
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    VSIVirtualHandleUniquePtr poBaseHandle(
+        VSIFOpenEx2L(pszUnderlying, pszAccess, bSetError, papszOptions));
+    const uint32_t nHandle = poBaseHandle ? m_oWriter.GetNewHandleNumber() : 0;
+    std::string osPayload;
+    osPayload.push_back(poBaseHandle ? 1 : 0);
+    AppendString(osPayload, pszUnderlying);
+    AppendString(osPayload, pszAccess);
+    m_oWriter.AddRecord(TraceRecordType::OPEN, nHandle, nStart, osPayload,
+                        [&]()
+                        {
+                            return std::string(CPLSPrintf(
+                                "Open(%s, %s) %s", pszUnderlying, pszAccess,
+                                poBaseHandle ? "succeeded" : "failed"));
+                        });
+    if (!poBaseHandle)
+        return nullptr;
+    return new VSITraceHandle(std::move(poBaseHandle), m_oWriter, nHandle);
+}
+
+/************************************************************************/
+/*                                Stat()                                */
+/************************************************************************/
+
+int VSITraceFilesystemHandler::Stat(const char *pszFilename,
+                                    VSIStatBufL *pStatBuf, int nFlags)
+{
+    const char *pszUnderlying = GetUnderlyingFilename(pszFilename);
+    if (!pszUnderlying)
+        return -1;
+
+    m_oWriter.UpdateFromConfig();
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    const int nRet = VSIStatExL(pszUnderlying, pStatBuf, nFlags);
+    std::string osPayload;
+    AppendUInt32(osPayload, static_cast<uint32_t>(nRet));
+    AppendString(osPayload, pszUnderlying);
+    m_oWriter.AddRecord(TraceRecordType::STAT, 0, nStart, osPayload,
+                        [&]()
+                        {
+                            return std::string(CPLSPrintf(
+                                "Stat(%s) = %d", pszUnderlying, nRet));
+                        });
+    return nRet;
+}
+
+/************************************************************************/
+/*                             ReadDirEx()                              */
+/************************************************************************/
+
+char **VSITraceFilesystemHandler::ReadDirEx(const char *pszDirname,
+                                            int nMaxFiles)
+{
+    const char *pszUnderlying = GetUnderlyingFilename(pszDirname);
+    if (!pszUnderlying)
+        return nullptr;
+
+    m_oWriter.UpdateFromConfig();
+    const uint64_t nStart = m_oWriter.GetTimeInNS();
+    char **papszRet = VSIReadDirEx(pszUnderlying, nMaxFiles);
+    const int nRet = papszRet ? CSLCount(papszRet) : -1;
+    std::string osPayload;
+    AppendUInt32(osPayload, static_cast<uint32_t>(nRet));
+    AppendString(osPayload, pszUnderlying);
+    m_oWriter.AddRecord(TraceRecordType::READDIR, 0, nStart, osPayload,
+                        [&]()
+                        {
+                            return std::string(CPLSPrintf(
+                                "ReadDir(%s) = %d", pszUnderlying, nRet));
+                        });
+    return papszRet;
+}
+
+}  // namespace
+
+//! @endcond
+
+/************************************************************************/
+/*                     VSIInstallTraceFileHandler()                     */
+/************************************************************************/
+
+/*!
+ \brief Install /vsitrace/ file system handler
+
+ \verbatim embed:rst
+ See :ref:`/vsitrace/ documentation <vsitrace>`
+ \endverbatim
+
+ @since GDAL 3.12
+ */
+void VSIInstallTraceFileHandler(void)
+{
+    VSIFileManager::InstallHandler(TRACE_PREFIX, new VSITraceFilesystemHandler);
+}
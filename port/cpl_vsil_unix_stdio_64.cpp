@@ -66,6 +66,20 @@
 #include <sys/uio.h>
 #endif
 
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+// Only used by ReadMultiRange(), which requires pread()
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) &&           \
+    (defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8))
+#define HAVE_VSI_IO_URING
+#endif
+#endif
+#endif
+
 #if defined(__MACH__) && defined(__APPLE__)
 #define HAS_CASE_INSENSITIVE_FILE_SYSTEM
 #include <stdio.h>
@@ -73,8 +87,13 @@
 #include <limits.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <new>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -82,6 +101,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi_error.h"
+#include "cpl_worker_thread_pool.h"
 
 #if defined(UNIX_STDIO_64)
 
@@ -139,6 +159,321 @@ static_assert(sizeof(VSIStatBufL::st_size) == sizeof(vsi_l_offset),
               "add the -DBUILD_WITHOUT_64BIT_OFFSET define");
 #endif
 
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+
+/************************************************************************/
+/*                     VSIUnixMultiRangeReadBackend                     */
+/************************************************************************/
+
+enum class VSIUnixMultiRangeReadBackend
+{
+    SEQUENTIAL,
+    THREADS,
+    IO_URING,
+};
+
+static VSIUnixMultiRangeReadBackend GetMultiRangeReadBackend()
+{
+    const char *pszVal =
+        CPLGetConfigOption("CPL_VSIL_UNIX_MULTI_RANGE_READ", "NO");
+    if (EQUAL(pszVal, "THREADS"))
+        return VSIUnixMultiRangeReadBackend::THREADS;
+    if (EQUAL(pszVal, "IO_URING") || CPLTestBool(pszVal))
+        return VSIUnixMultiRangeReadBackend::IO_URING;
+    return VSIUnixMultiRangeReadBackend::SEQUENTIAL;
+}
+
+/************************************************************************/
+/*                       GetMultiRangeQueueDepth()                      */
+/************************************************************************/
+
+static int GetMultiRangeQueueDepth()
+{
+    return std::clamp(atoi(CPLGetConfigOption(
+                          "CPL_VSIL_UNIX_MULTI_RANGE_READ_QUEUE_DEPTH", "32")),
+                      1, 1024);
+}
+
+// Maximum number of bytes requested by a single read system call
+constexpr size_t MAX_BYTES_PER_READ = 1024 * 1024 * 1024;
+
+#endif
+
+#ifdef HAVE_VSI_IO_URING
+
+/************************************************************************/
+/* ==================================================================== */
+/*                           VSIUnixIOURing                             */
+/* ==================================================================== */
+/************************************************************************/
+
+// Minimal io_uring instance, directly driven through the io_uring_setup()
+// and io_uring_enter() system calls, so that no dependency on liburing is
+// needed. Only used to submit at once all the reads of a ReadMultiRange()
+// request.
+
+class VSIUnixIOURing
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIUnixIOURing)
+
+    int m_fd = -1;
+    unsigned m_nEntries = 0;
+    bool m_bBroken = false;
+
+    void *m_pSQRing = MAP_FAILED;
+    size_t m_nSQRingSize = 0;
+    void *m_pCQRing = MAP_FAILED;
+    size_t m_nCQRingSize = 0;
+    struct io_uring_sqe *m_pasSQEs = nullptr;
+    size_t m_nSQEsSize = 0;
+
+    unsigned *m_pnSQHead = nullptr;
+    unsigned *m_pnSQTail = nullptr;
+    unsigned m_nSQMask = 0;
+    unsigned *m_panSQArray = nullptr;
+    unsigned *m_pnCQHead = nullptr;
+    unsigned *m_pnCQTail = nullptr;
+    unsigned m_nCQMask = 0;
+    struct io_uring_cqe *m_pasCQEs = nullptr;
+
+    VSIUnixIOURing() = default;
+
+  public:
+    ~VSIUnixIOURing();
+
+    static std::unique_ptr<VSIUnixIOURing> Create(unsigned nEntries);
+
+    bool ReadMultiRange(int fd, int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets,
+                        const size_t *panSizes);
+
+    bool IsBroken() const
+    {
+        return m_bBroken;
+    }
+};
+
+/************************************************************************/
+/*                          ~VSIUnixIOURing()                           */
+/************************************************************************/
+
+VSIUnixIOURing::~VSIUnixIOURing()
+{
+    if (m_pasSQEs)
+        munmap(m_pasSQEs, m_nSQEsSize);
+    if (m_pCQRing != MAP_FAILED && m_pCQRing != m_pSQRing)
+        munmap(m_pCQRing, m_nCQRingSize);
+    if (m_pSQRing != MAP_FAILED)
+        munmap(m_pSQRing, m_nSQRingSize);
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+std::unique_ptr<VSIUnixIOURing> VSIUnixIOURing::Create(unsigned nEntries)
+{
+    struct io_uring_params sParams;
+    memset(&sParams, 0, sizeof(sParams));
+    const int fd =
+        static_cast<int>(syscall(__NR_io_uring_setup, nEntries, &sParams));
+    if (fd < 0)
+    {
+        CPLDebug("VSI", "io_uring_setup() failed: %s", VSIStrerror(errno));
+        return nullptr;
+    }
+
+    auto poRing = std::unique_ptr<VSIUnixIOURing>(new VSIUnixIOURing());
+    poRing->m_fd = fd;
+    poRing->m_nEntries = sParams.sq_entries;
+    poRing->m_nSQRingSize =
+        sParams.sq_off.array + sParams.sq_entries * sizeof(unsigned);
+    poRing->m_nCQRingSize =
+        sParams.cq_off.cqes + sParams.cq_entries * sizeof(io_uring_cqe);
+    bool bSingleMMap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if (sParams.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        bSingleMMap = true;
+        poRing->m_nSQRingSize =
+            std::max(poRing->m_nSQRingSize, poRing->m_nCQRingSize);
+        poRing->m_nCQRingSize = poRing->m_nSQRingSize;
+    }
+#endif
+
+    poRing->m_pSQRing =
+        mmap(nullptr, poRing->m_nSQRingSize, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (poRing->m_pSQRing == MAP_FAILED)
+    {
+        CPLDebug("VSI", "mmap() of io_uring submission ring failed: %s",
+                 VSIStrerror(errno));
+        return nullptr;
+    }
+    if (bSingleMMap)
+    {
+        poRing->m_pCQRing = poRing->m_pSQRing;
+    }
+    else
+    {
+        poRing->m_pCQRing =
+            mmap(nullptr, poRing->m_nCQRingSize, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (poRing->m_pCQRing == MAP_FAILED)
+        {
+            CPLDebug("VSI", "mmap() of io_uring completion ring failed: %s",
+                     VSIStrerror(errno));
+            return nullptr;
+        }
+    }
+    poRing->m_nSQEsSize = sParams.sq_entries * sizeof(io_uring_sqe);
+    void *pSQEs =
+        mmap(nullptr, poRing->m_nSQEsSize, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (pSQEs == MAP_FAILED)
+    {
+        CPLDebug("VSI", "mmap() of io_uring submission entries failed: %s",
+                 VSIStrerror(errno));
+        return nullptr;
+    }
+    poRing->m_pasSQEs = static_cast<io_uring_sqe *>(pSQEs);
+
+    GByte *pabySQ = static_cast<GByte *>(poRing->m_pSQRing);
+    poRing->m_pnSQHead =
+        reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.head);
+    poRing->m_pnSQTail =
+        reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.tail);
+    poRing->m_nSQMask =
+        *reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.ring_mask);
+    poRing->m_panSQArray =
+        reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.array);
+
+    GByte *pabyCQ = static_cast<GByte *>(poRing->m_pCQRing);
+    poRing->m_pnCQHead =
+        reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.head);
+    poRing->m_pnCQTail =
+        reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.tail);
+    poRing->m_nCQMask =
+        *reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.ring_mask);
+    poRing->m_pasCQEs =
+        reinterpret_cast<io_uring_cqe *>(pabyCQ + sParams.cq_off.cqes);
+
+    return poRing;
+}
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+// Reads are submitted with IORING_OP_READV, which is available since the
+// first io_uring enabled kernels (5.1). At most one read is in flight for
+// each range: short reads are resubmitted for the remaining bytes.
+
+bool VSIUnixIOURing::ReadMultiRange(int fd, int nRanges, void **ppData,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+    std::vector<size_t> anDone(nRanges);
+    std::vector<struct iovec> asIOVec(nRanges);
+    std::vector<int> anToSubmit;
+    int iNextRange = 0;
+    unsigned nInFlight = 0;
+    bool bOK = true;
+
+    while (true)
+    {
+        // Fill the submission queue
+        unsigned nSQTail = *m_pnSQTail;
+        while (bOK && nInFlight < m_nEntries &&
+               (!anToSubmit.empty() || iNextRange < nRanges))
+        {
+            int iRange;
+            if (!anToSubmit.empty())
+            {
+                iRange = anToSubmit.back();
+                anToSubmit.pop_back();
+            }
+            else
+            {
+                iRange = iNextRange++;
+                if (panSizes[iRange] == 0)
+                    continue;
+            }
+
+            asIOVec[iRange].iov_base =
+                static_cast<GByte *>(ppData[iRange]) + anDone[iRange];
+            asIOVec[iRange].iov_len = std::min(
+                panSizes[iRange] - anDone[iRange], MAX_BYTES_PER_READ);
+
+            const unsigned nIdx = nSQTail & m_nSQMask;
+            struct io_uring_sqe *psSQE = &m_pasSQEs[nIdx];
+            memset(psSQE, 0, sizeof(*psSQE));
+            psSQE->opcode = IORING_OP_READV;
+            psSQE->fd = fd;
+            psSQE->addr = reinterpret_cast<uintptr_t>(&asIOVec[iRange]);
+            psSQE->len = 1;
+            psSQE->off = panOffsets[iRange] + anDone[iRange];
+            psSQE->user_data = static_cast<uint64_t>(iRange);
+            m_panSQArray[nIdx] = nIdx;
+            ++nSQTail;
+            ++nInFlight;
+        }
+        __atomic_store_n(m_pnSQTail, nSQTail, __ATOMIC_RELEASE);
+
+        if (nInFlight == 0)
+            break;
+
+        // Submit and wait for at least one completion
+        const unsigned nToSubmit =
+            nSQTail - __atomic_load_n(m_pnSQHead, __ATOMIC_ACQUIRE);
+        const int nRet = static_cast<int>(
+            syscall(__NR_io_uring_enter, m_fd, nToSubmit, 1,
+                    IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (nRet < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            // Should not happen. Requests already submitted may still be
+            // pending, so this instance must no longer be used.
+            CPLDebug("VSI", "io_uring_enter() failed: %s", VSIStrerror(errno));
+            m_bBroken = true;
+            return false;
+        }
+
+        // Process completions
+        unsigned nCQHead = *m_pnCQHead;
+        const unsigned nCQTail = __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE);
+        while (nCQHead != nCQTail)
+        {
+            const struct io_uring_cqe &sCQE = m_pasCQEs[nCQHead & m_nCQMask];
+            const int iRange = static_cast<int>(sCQE.user_data);
+            const int nRes = sCQE.res;
+            ++nCQHead;
+            --nInFlight;
+            if (nRes == -EINTR || nRes == -EAGAIN)
+            {
+                anToSubmit.push_back(iRange);
+            }
+            else if (nRes <= 0)
+            {
+                // Error, or end of file reached before the end of the range
+                bOK = false;
+            }
+            else
+            {
+                anDone[iRange] += static_cast<size_t>(nRes);
+                if (anDone[iRange] < panSizes[iRange])
+                    anToSubmit.push_back(iRange);
+            }
+        }
+        __atomic_store_n(m_pnCQHead, nCQHead, __ATOMIC_RELEASE);
+    }
+
+    return bOK;
+}
+
+#endif  // HAVE_VSI_IO_URING
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -154,6 +489,11 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
     CPLMutex *hMutex = nullptr;
 #endif
 
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+    std::mutex m_oMutexPool{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+#endif
+
   public:
     VSIUnixStdioFilesystemHandler() = default;
 #ifdef VSI_COUNT_BYTES_READ
@@ -180,6 +520,12 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
     bool SupportsRandomWrite(const char *pszPath,
                              bool /* bAllowLocalTempFile */) override;
 
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+    int HasOptimizedReadMultiRange(const char *pszPath) override;
+
+    CPLWorkerThreadPool *GetMultiRangeReadPool();
+#endif
+
     VSIDIR *OpenDir(const char *pszPath, int nRecurseDepth,
                     const char *const *papszOptions) override;
 
@@ -215,10 +561,22 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     // file and thus a call to our Seek(0, SEEK_SET) before a read will be a
     // no-op.
     bool bModeAppendReadWrite = false;
+    VSIUnixStdioFilesystemHandler *poFS = nullptr;
 #ifdef VSI_COUNT_BYTES_READ
     vsi_l_offset nTotalBytesRead = 0;
-    VSIUnixStdioFilesystemHandler *poFS = nullptr;
 #endif
+#ifdef HAVE_VSI_IO_URING
+    std::unique_ptr<VSIUnixIOURing> m_poIOURing{};
+    bool m_bIOURingInitDone = false;
+#endif
+
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+    bool PReadFully(void *pBuffer, size_t nSize, vsi_l_offset nOffset) const;
+    bool ReadMultiRangeThreaded(int nRanges, void **ppData,
+                                const vsi_l_offset *panOffsets,
+                                const size_t *panSizes);
+#endif
+
   public:
     VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn, FILE *fpIn,
                        bool bReadOnlyIn, bool bModeAppendReadWriteIn);
@@ -245,6 +603,15 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     bool HasPRead() const override;
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+    bool HasPWrite() const override;
+    size_t PWrite(const void * /*pBuffer*/, size_t /* nSize */,
+                  vsi_l_offset /*nOffset*/) override;
+
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
 #endif
 };
 
@@ -252,18 +619,11 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
 /*                       VSIUnixStdioHandle()                           */
 /************************************************************************/
 
-VSIUnixStdioHandle::VSIUnixStdioHandle(
-#ifndef VSI_COUNT_BYTES_READ
-    CPL_UNUSED
-#endif
-        VSIUnixStdioFilesystemHandler *poFSIn,
-    FILE *fpIn, bool bReadOnlyIn, bool bModeAppendReadWriteIn)
+VSIUnixStdioHandle::VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn,
+                                       FILE *fpIn, bool bReadOnlyIn,
+                                       bool bModeAppendReadWriteIn)
     : fp(fpIn), bReadOnly(bReadOnlyIn),
-      bModeAppendReadWrite(bModeAppendReadWriteIn)
-#ifdef VSI_COUNT_BYTES_READ
-      ,
-      poFS(poFSIn)
-#endif
+      bModeAppendReadWrite(bModeAppendReadWriteIn), poFS(poFSIn)
 {
 }
 
@@ -283,6 +643,10 @@ int VSIUnixStdioHandle::Close()
     poFS->AddToTotal(nTotalBytesRead);
 #endif
 
+#ifdef HAVE_VSI_IO_URING
+    m_poIOURing.reset();
+#endif
+
     int ret = fclose(fp);
     fp = nullptr;
     return ret;
@@ -680,6 +1044,188 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
     return pread(fileno(fp), pBuffer, nSize, static_cast<off_t>(nOffset));
 #endif
 }
+
+/************************************************************************/
+/*                            HasPWrite()                               */
+/************************************************************************/
+
+bool VSIUnixStdioHandle::HasPWrite() const
+{
+    return !bReadOnly && !bModeAppendReadWrite;
+}
+
+/************************************************************************/
+/*                              PWrite()                                */
+/************************************************************************/
+
+size_t VSIUnixStdioHandle::PWrite(const void *pBuffer, size_t nSize,
+                                  vsi_l_offset nOffset)
+{
+    // pwrite() may write less than requested, or be interrupted
+    const GByte *pabyBuffer = static_cast<const GByte *>(pBuffer);
+    size_t nWritten = 0;
+    while (nWritten < nSize)
+    {
+#ifdef HAVE_PREAD64
+        const auto nRet = pwrite64(fileno(fp), pabyBuffer + nWritten,
+                                   nSize - nWritten, nOffset + nWritten);
+#else
+        const auto nRet =
+            pwrite(fileno(fp), pabyBuffer + nWritten, nSize - nWritten,
+                   static_cast<off_t>(nOffset + nWritten));
+#endif
+        if (nRet < 0 && errno == EINTR)
+            continue;
+        if (nRet <= 0)
+            break;
+        nWritten += static_cast<size_t>(nRet);
+    }
+    return nWritten;
+}
+
+/************************************************************************/
+/*                             PReadFully()                             */
+/************************************************************************/
+
+bool VSIUnixStdioHandle::PReadFully(void *pBuffer, size_t nSize,
+                                    vsi_l_offset nOffset) const
+{
+    // pread() may read less than requested
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    size_t nRead = 0;
+    while (nRead < nSize)
+    {
+        const size_t nToRead = std::min(nSize - nRead, MAX_BYTES_PER_READ);
+#ifdef HAVE_PREAD64
+        const auto nRet =
+            pread64(fileno(fp), pabyBuffer + nRead, nToRead, nOffset + nRead);
+#else
+        const auto nRet = pread(fileno(fp), pabyBuffer + nRead, nToRead,
+                                static_cast<off_t>(nOffset + nRead));
+#endif
+        if (nRet < 0 && errno == EINTR)
+            continue;
+        if (nRet <= 0)
+            return false;
+        nRead += static_cast<size_t>(nRet);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       ReadMultiRangeThreaded()                       */
+/************************************************************************/
+
+bool VSIUnixStdioHandle::ReadMultiRangeThreaded(int nRanges, void **ppData,
+                                                const vsi_l_offset *panOffsets,
+                                                const size_t *panSizes)
+{
+    CPLWorkerThreadPool *poPool = poFS->GetMultiRangeReadPool();
+    if (!poPool)
+        return false;
+
+    std::atomic<bool> bOK{true};
+    auto poQueue = poPool->CreateJobQueue();
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] == 0)
+            continue;
+        poQueue->SubmitJob(
+            [this, &bOK, i, ppData, panOffsets, panSizes]()
+            {
+                if (bOK && !PReadFully(ppData[i], panSizes[i], panOffsets[i]))
+                    bOK = false;
+            });
+    }
+    poQueue->WaitCompletion();
+    return bOK;
+}
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    // Reading directly from the file descriptor would bypass pending data in
+    // the FILE* write buffer, hence restrict this to read-only handles.
+    const auto eBackend =
+        bReadOnly && nRanges > 1 ? GetMultiRangeReadBackend()
+                                 : VSIUnixMultiRangeReadBackend::SEQUENTIAL;
+    if (eBackend == VSIUnixMultiRangeReadBackend::SEQUENTIAL)
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+
+#ifdef HAVE_VSI_IO_URING
+    if (eBackend == VSIUnixMultiRangeReadBackend::IO_URING)
+    {
+        if (!m_bIOURingInitDone)
+        {
+            m_bIOURingInitDone = true;
+            m_poIOURing = VSIUnixIOURing::Create(
+                static_cast<unsigned>(GetMultiRangeQueueDepth()));
+            if (!m_poIOURing)
+            {
+                CPLDebugOnce("VSI", "io_uring not available. Using threads "
+                                    "for ReadMultiRange() instead");
+            }
+        }
+        if (m_poIOURing)
+        {
+            if (m_poIOURing->ReadMultiRange(fileno(fp), nRanges, ppData,
+                                            panOffsets, panSizes))
+            {
+                return 0;
+            }
+            if (!m_poIOURing->IsBroken())
+            {
+                // Let sequential reads deal with the error
+                return VSIVirtualHandle::ReadMultiRange(nRanges, ppData,
+                                                        panOffsets, panSizes);
+            }
+
+            // Leak the instance, since the kernel might still write into
+            // the buffers of pending requests, and retry with threads.
+            CPL_IGNORE_RET_VAL(m_poIOURing.release());
+        }
+    }
+#endif
+
+    if (ReadMultiRangeThreaded(nRanges, ppData, panOffsets, panSizes))
+        return 0;
+    return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                            panSizes);
+}
+
+/************************************************************************/
+/*                             AdviseRead()                             */
+/************************************************************************/
+
+void VSIUnixStdioHandle::AdviseRead(int nRanges,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+#if defined(POSIX_FADV_WILLNEED)
+    // Let the kernel start reading all ranges in the background, so that
+    // the following reads are served from the page cache.
+    if (GetMultiRangeReadBackend() == VSIUnixMultiRangeReadBackend::SEQUENTIAL)
+        return;
+    const int fd = fileno(fp);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i])
+            posix_fadvise(fd, static_cast<off_t>(panOffsets[i]),
+                          static_cast<off_t>(panSizes[i]),
+                          POSIX_FADV_WILLNEED);
+    }
+#else
+    CPL_IGNORE_RET_VAL(nRanges);
+    CPL_IGNORE_RET_VAL(panOffsets);
+    CPL_IGNORE_RET_VAL(panSizes);
+#endif
+}
 #endif
 
 /************************************************************************/
@@ -1021,6 +1567,41 @@ bool VSIUnixStdioFilesystemHandler::SupportsRandomWrite(
     return SupportsSequentialWrite(pszPath, false);
 }
 
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+
+/************************************************************************/
+/*                    HasOptimizedReadMultiRange()                      */
+/************************************************************************/
+
+int VSIUnixStdioFilesystemHandler::HasOptimizedReadMultiRange(
+    const char * /* pszPath */)
+{
+    return GetMultiRangeReadBackend() !=
+           VSIUnixMultiRangeReadBackend::SEQUENTIAL;
+}
+
+/************************************************************************/
+/*                       GetMultiRangeReadPool()                        */
+/************************************************************************/
+
+CPLWorkerThreadPool *VSIUnixStdioFilesystemHandler::GetMultiRangeReadPool()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexPool);
+    if (!m_poPool)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(GetMultiRangeQueueDepth(), nullptr, nullptr,
+                           false))
+        {
+            return nullptr;
+        }
+        m_poPool = std::move(poPool);
+    }
+    return m_poPool.get();
+}
+
+#endif
+
 /************************************************************************/
 /*                            VSIDIRUnixStdio                           */
 /************************************************************************/